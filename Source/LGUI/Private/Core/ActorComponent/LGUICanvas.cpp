@@ -26,6 +26,10 @@
 #include "Engine/TextureRenderTarget2D.h"
 #include "Math/TransformCalculus2D.h"
 #include "Core/LGUICanvasCustomClip.h"
+#include "Algo/Sort.h"
+#include "Algo/IsSorted.h"
+#include "UObject/UObjectIterator.h"
+#include "HAL/IConsoleManager.h"
 
 #if LGUI_CAN_DISABLE_OPTIMIZATION
 PRAGMA_DISABLE_OPTIMIZATION
@@ -637,11 +641,49 @@ void ULGUICanvas::MarkCanvasUpdateRecursive(bool bMaterialOrTextureChanged, bool
 }
 void ULGUICanvas::MarkItemTransformOrVertexPositionChanged(UUIBaseRenderable* InRenderable)
 {
-	if (CacheUIItemToCanvasTransformMap.Contains(InRenderable))
+	auto SlotIndex = InRenderable->CacheTransformSlotIndex;
+	if (CacheTransformSlotOwnerArray.IsValidIndex(SlotIndex) && CacheTransformSlotOwnerArray[SlotIndex] == InRenderable)
 	{
-		CacheUIItemToCanvasTransformMap.Remove(InRenderable);
+		CacheTransformDirtyBits[SlotIndex] = true;
 	}
 }
+void ULGUICanvas::MarkCanvasTransformChanged()
+{
+	bCacheInverseCanvasTransformDirty = true;
+	if (CacheTransformDirtyBits.Num() > 0)
+	{
+		CacheTransformDirtyBits.SetRange(0, CacheTransformDirtyBits.Num(), true);
+	}
+}
+void ULGUICanvas::ReleaseCacheTransformSlot(UUIBaseRenderable* InRenderable)
+{
+	auto SlotIndex = InRenderable->CacheTransformSlotIndex;
+	if (CacheTransformSlotOwnerArray.IsValidIndex(SlotIndex) && CacheTransformSlotOwnerArray[SlotIndex] == InRenderable)
+	{
+		CacheTransformSlotOwnerArray[SlotIndex] = nullptr;
+		CacheTransformDirtyBits[SlotIndex] = true;
+		FreeCacheTransformSlotArray.Add(SlotIndex);
+		InRenderable->CacheTransformSlotIndex = INDEX_NONE;
+	}
+}
+int32 ULGUICanvas::AllocateCacheTransformSlot(UUIBaseRenderable* InRenderable)
+{
+	int32 SlotIndex;
+	if (FreeCacheTransformSlotArray.Num() > 0)
+	{
+		SlotIndex = FreeCacheTransformSlotArray.Pop(false);
+		CacheTransformSlotOwnerArray[SlotIndex] = InRenderable;
+	}
+	else
+	{
+		SlotIndex = CacheTransformArray.AddUninitialized();
+		CacheTransformSlotOwnerArray.Add(InRenderable);
+		CacheTransformDirtyBits.Add(true);
+	}
+	CacheTransformDirtyBits[SlotIndex] = true;
+	InRenderable->CacheTransformSlotIndex = SlotIndex;
+	return SlotIndex;
+}
 
 #if WITH_EDITOR
 bool ULGUICanvas::CanEditChange(const FProperty* InProperty) const
@@ -894,14 +936,161 @@ bool ULGUICanvas::Is2DUITransform(const FTransform& Transform)
 	return true;
 }
 
+/**
+ * Sort list by flatten hierarchy index.
+ * When hierarchy changed, usually only a few elements are out of order, so take these out-of-order elements out and sort them, then merge back to the ordered ones, instead of sort the whole list.
+ */
+template<typename ElementType, typename GetIndexFunctionType>
+static void MergeUpdateSortedListByFlattenHierarchyIndex(TArray<ElementType>& InOutList, GetIndexFunctionType GetIndex)
+{
+	TArray<ElementType> OrderedList;
+	TArray<ElementType, TInlineAllocator<16>> OutOfOrderList;
+	OrderedList.Reserve(InOutList.Num());
+	for (auto& Item : InOutList)
+	{
+		auto Index = GetIndex(Item);
+		auto OrderedCount = OrderedList.Num();
+		if (OrderedCount == 0 || GetIndex(OrderedList[OrderedCount - 1]) <= Index)
+		{
+			OrderedList.Add(Item);
+		}
+		else if (OrderedCount == 1 || GetIndex(OrderedList[OrderedCount - 2]) <= Index)//the last ordered one is moved back, not this one
+		{
+			OutOfOrderList.Add(OrderedList.Pop(false));
+			OrderedList.Add(Item);
+		}
+		else
+		{
+			OutOfOrderList.Add(Item);
+		}
+	}
+	if (OutOfOrderList.Num() > 0)
+	{
+		//use Algo::Sort, because TArray::Sort will dereference pointer element
+		auto Predicate = [&GetIndex](const ElementType& A, const ElementType& B) {
+			return GetIndex(A) < GetIndex(B);
+		};
+		if (OutOfOrderList.Num() > InOutList.Num() / 4)//too many, just sort it
+		{
+			Algo::Sort(InOutList, Predicate);
+		}
+		else
+		{
+			Algo::Sort(OutOfOrderList, Predicate);
+			int OrderedIndex = 0, OutOfOrderIndex = 0;
+			for (int i = 0; i < InOutList.Num(); i++)
+			{
+				if (OutOfOrderIndex >= OutOfOrderList.Num()
+					|| (OrderedIndex < OrderedList.Num() && !Predicate(OutOfOrderList[OutOfOrderIndex], OrderedList[OrderedIndex]))
+					)
+				{
+					InOutList[i] = OrderedList[OrderedIndex++];
+				}
+				else
+				{
+					InOutList[i] = OutOfOrderList[OutOfOrderIndex++];
+				}
+			}
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Verify flatten hierarchy index and renderable order:
+ * merge update a list with random moved elements and compare with full sort; then check every root UIItem's flatten index is increasing in hierarchy order, and every canvas's sorted renderable list is in flatten index order.
+ */
+struct FLGUIFlattenHierarchyOrderCheck
+{
+	static bool IsIncreasingInHierarchy_Recursive(const UUIItem* InItem, int32& InOutPrevIndex)
+	{
+		const int32 Index = InItem->GetFlattenHierarchyIndex();
+		if (Index <= InOutPrevIndex)
+		{
+			UE_LOG(LGUI, Warning, TEXT("[%s] Flatten hierarchy index not increasing, item: %s, index: %d, previous index: %d"), ANSI_TO_TCHAR(__FUNCTION__), *InItem->GetPathName(), Index, InOutPrevIndex);
+			return false;
+		}
+		InOutPrevIndex = Index;
+		for (auto& Child : InItem->GetAttachUIChildren())
+		{
+			if (IsValid(Child) && !IsIncreasingInHierarchy_Recursive(Child, InOutPrevIndex))return false;
+		}
+		return true;
+	}
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 ListCount = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+		const int32 RoundCount = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 100;
+
+		int32 MergeMismatchCount = 0;
+		TArray<int32> List, SortedList;
+		for (int32 Round = 0; Round < RoundCount; Round++)
+		{
+			List.Reset();
+			for (int32 i = 0; i < ListCount; i++)
+			{
+				List.Add(i * 16);
+			}
+			//move a few elements, like reorder some rows
+			const int32 MoveCount = FMath::RandRange(1, FMath::Max(1, ListCount / (Round % 2 == 0 ? 100 : 2)));
+			for (int32 i = 0; i < MoveCount; i++)
+			{
+				List[FMath::RandHelper(ListCount)] = FMath::RandHelper(ListCount * 16);
+			}
+			SortedList = List;
+			Algo::Sort(SortedList);
+			MergeUpdateSortedListByFlattenHierarchyIndex(List, [](int32 Item) { return Item; });
+			if (List != SortedList)
+			{
+				MergeMismatchCount++;
+			}
+		}
+
+		int32 RootCount = 0, RootErrorCount = 0, CanvasCount = 0, CanvasErrorCount = 0;
+		for (TObjectIterator<UUIItem> Itr; Itr; ++Itr)
+		{
+			auto Item = *Itr;
+			if (!IsValid(Item) || Item->IsTemplate() || Item->GetWorld() == nullptr || Item->GetRootUIItemInHierarchy() != Item)continue;
+			RootCount++;
+			int32 PrevIndex = MIN_int32;
+			if (!IsIncreasingInHierarchy_Recursive(Item, PrevIndex))
+			{
+				RootErrorCount++;
+			}
+		}
+		for (TObjectIterator<ULGUICanvas> Itr; Itr; ++Itr)
+		{
+			auto Canvas = *Itr;
+			if (!IsValid(Canvas) || Canvas->IsTemplate() || Canvas->GetWorld() == nullptr || Canvas->bShouldSortRenderableOrder)continue;
+			CanvasCount++;
+			if (!Algo::IsSorted(Canvas->UIRenderableList, [](const TObjectPtr<UUIItem>& A, const TObjectPtr<UUIItem>& B) {
+				return A->GetFlattenHierarchyIndex() < B->GetFlattenHierarchyIndex();
+				}))
+			{
+				CanvasErrorCount++;
+				UE_LOG(LGUI, Warning, TEXT("[%s] Renderable list not in flatten hierarchy index order, canvas: %s"), ANSI_TO_TCHAR(__FUNCTION__), *Canvas->GetPathName());
+			}
+		}
+		UE_LOG(LGUI, Log, TEXT("[%s] Merge update: %d rounds of %d elements, mismatch: %d. Hierarchy: %d roots, error: %d. Renderable list: %d canvases, error: %d")
+			, ANSI_TO_TCHAR(__FUNCTION__), RoundCount, ListCount, MergeMismatchCount, RootCount, RootErrorCount, CanvasCount, CanvasErrorCount);
+	}
+};
+static FAutoConsoleCommand LGUIFlattenHierarchyOrderCheckCommand(
+	TEXT("lgui.Canvas.CheckHierarchyOrder"),
+	TEXT("Check merge update of sorted list against full sort, flatten hierarchy index order of all UIItems, and renderable order of all canvases. Args: [ListCount=1000] [RoundCount=100]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FLGUIFlattenHierarchyOrderCheck::Run));
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Canvas SortRenderableOrder"), STAT_SortRenderableOrder, STATGROUP_LGUI);
 void ULGUICanvas::UpdateGeometry_Implement()
 {
 	//hierarchy change, need to sort it
 	if (bShouldSortRenderableOrder)
 	{
+		SCOPE_CYCLE_COUNTER(STAT_SortRenderableOrder);
 		bShouldSortRenderableOrder = false;
-		UIRenderableList.Sort([](const UUIItem& A, const UUIItem& B) {
-			return A.GetFlattenHierarchyIndex() < B.GetFlattenHierarchyIndex();
+		MergeUpdateSortedListByFlattenHierarchyIndex(UIRenderableList, [](const TObjectPtr<UUIItem>& Item) {
+			return Item->GetFlattenHierarchyIndex();
 			});
 	}
 	//for sorted ui items, iterate from head to tail, compare drawcall from tail to head
@@ -1344,8 +1533,8 @@ void ULGUICanvas::BatchDrawcall_Implement(const FVector2D& InCanvasLeftBottom, c
 		if (DrawcallItem->bNeedToSortRenderObjectList)
 		{
 			DrawcallItem->bNeedToSortRenderObjectList = false;
-			DrawcallItem->RenderObjectList.Sort([](const TWeakObjectPtr<UUIBatchMeshRenderable>& A, const TWeakObjectPtr<UUIBatchMeshRenderable>& B) {
-				return A->GetFlattenHierarchyIndex() < B->GetFlattenHierarchyIndex();
+			MergeUpdateSortedListByFlattenHierarchyIndex(DrawcallItem->RenderObjectList, [](const TWeakObjectPtr<UUIBatchMeshRenderable>& Item) {
+				return Item->GetFlattenHierarchyIndex();
 				});
 		}
 	}
@@ -3272,27 +3461,28 @@ DECLARE_CYCLE_STAT(TEXT("Canvas 2DTransform"), STAT_Transform2D, STATGROUP_LGUI)
 void ULGUICanvas::GetCacheUIItemToCanvasTransform(UUIBaseRenderable* item, FLGUICacheTransformContainer& outResult)
 {
 	//SCOPE_CYCLE_COUNTER(STAT_Transform2D);
-	if (auto tfPtr = this->CacheUIItemToCanvasTransformMap.Find(item))
+	auto SlotIndex = item->CacheTransformSlotIndex;
+	if (!CacheTransformSlotOwnerArray.IsValidIndex(SlotIndex) || CacheTransformSlotOwnerArray[SlotIndex] != item)
 	{
-		outResult = *tfPtr;
+		SlotIndex = AllocateCacheTransformSlot(item);
 	}
-	else
+	auto& CacheTransform = CacheTransformArray[SlotIndex];
+	if (CacheTransformDirtyBits[SlotIndex])
 	{
-		auto inverseCanvasTf = this->UIItem->GetComponentTransform().Inverse();
+		CacheTransformDirtyBits[SlotIndex] = false;
+		if (bCacheInverseCanvasTransformDirty)
+		{
+			bCacheInverseCanvasTransformDirty = false;
+			CacheInverseCanvasTransform = this->UIItem->GetComponentTransform().Inverse();
+		}
 		const auto& itemTf = item->GetComponentTransform();
 
-		FTransform itemToCanvasTf;
-		FTransform::Multiply(&itemToCanvasTf, &itemTf, &inverseCanvasTf);
-		outResult.Transform = itemToCanvasTf;
-
-		auto itemToCanvasTf2D = ConvertTo2DTransform(itemToCanvasTf);
-		FVector2D itemMin, itemMax;
-		CalculateUIItem2DBounds(item, itemToCanvasTf2D, itemMin, itemMax);
+		FTransform::Multiply(&CacheTransform.Transform, &itemTf, &CacheInverseCanvasTransform);
 
-		outResult.BoundsMin2D = itemMin;
-		outResult.BoundsMax2D = itemMax;
-		CacheUIItemToCanvasTransformMap.Add(item, outResult);
+		auto itemToCanvasTf2D = ConvertTo2DTransform(CacheTransform.Transform);
+		CalculateUIItem2DBounds(item, itemToCanvasTf2D, CacheTransform.BoundsMin2D, CacheTransform.BoundsMax2D);
 	}
+	outResult = CacheTransform;
 }
 FTransform2D ULGUICanvas::ConvertTo2DTransform(const FTransform& Transform)
 {
@@ -109,7 +109,7 @@ void UUIBaseRenderable::OnUnregister()
 	Super::OnUnregister();
 	if (RenderCanvas.IsValid())
 	{
-		RenderCanvas->MarkItemTransformOrVertexPositionChanged(this);//call this can remove the reference from canvas
+		RenderCanvas->ReleaseCacheTransformSlot(this);//call this can remove the reference from canvas
 	}
 }
 
@@ -145,7 +145,7 @@ void UUIBaseRenderable::OnRenderCanvasChanged(ULGUICanvas* OldCanvas, ULGUICanva
 	{
 		OldCanvas->RemoveUIItem(this);
 		OldCanvas->RemoveUIRenderable(this);
-		OldCanvas->MarkItemTransformOrVertexPositionChanged(this);//call this can remove the reference from canvas
+		OldCanvas->ReleaseCacheTransformSlot(this);//call this can remove the reference from canvas
 	}
 	if (IsValid(NewCanvas))
 	{
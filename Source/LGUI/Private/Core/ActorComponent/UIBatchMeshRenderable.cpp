@@ -20,6 +20,7 @@ UUIBatchMeshRenderable::UUIBatchMeshRenderable(const FObjectInitializer& ObjectI
 	bLocalVertexPositionChanged = true;
 	bUVChanged = true;
 	bTriangleChanged = true;
+	bGeometryModifierDirty = false;
 }
 
 void UUIBatchMeshRenderable::BeginPlay()
@@ -116,6 +117,24 @@ void UUIBatchMeshRenderable::MarkMaterialDirty()
 	}
 }
 
+void UUIBatchMeshRenderable::MarkGeometryModifierDirty(class UUIGeometryModifierBase* InModifier, bool InVertexPositionDirty, bool InVertexUVDirty, bool InVertexColorDirty)
+{
+	if (!InModifier->GetEnable())return;//disabled modifier not affect geometry
+	for (auto& Stage : GeometryModifierStageArray)
+	{
+		if (Stage.Modifier == InModifier)
+		{
+			Stage.bVertexPositionDirty = Stage.bVertexPositionDirty || InVertexPositionDirty;
+			Stage.bUVDirty = Stage.bUVDirty || InVertexUVDirty;
+			Stage.bColorDirty = Stage.bColorDirty || InVertexColorDirty;
+			bGeometryModifierDirty = true;
+			MarkCanvasUpdate(false, InVertexPositionDirty, false);
+			return;
+		}
+	}
+	//stage not created yet, update as normal
+	MarkVerticesDirty(false, InVertexPositionDirty, InVertexUVDirty, InVertexColorDirty);
+}
 void UUIBatchMeshRenderable::AddGeometryModifier(class UUIGeometryModifierBase* InModifier)
 {
 	auto Index = GeometryModifierComponentArray.AddUnique(InModifier);
@@ -181,6 +200,26 @@ UMaterialInstanceDynamic* UUIBatchMeshRenderable::GetMaterialInstanceDynamic()co
 	}
 	return nullptr;
 }
+UMaterialInstanceDynamic* UUIBatchMeshRenderable::GetOrCreateAnimatedCustomUIMaterial(UMaterialInterface* InParentMaterial)
+{
+	for (auto& Item : AnimatedCustomUIMaterialPool)
+	{
+		if (Item != nullptr && Item->Parent == InParentMaterial)
+		{
+			Item->ClearParameterValues();//parameters from last play should not leak into this one
+			return Item;
+		}
+	}
+
+	TStringBuilder<128> DynamicName;
+	InParentMaterial->GetFName().ToString(DynamicName);
+	DynamicName.Append(TEXT("_Animated"));
+	FName UniqueDynamicName = MakeUniqueObjectName(this, UMaterialInstanceDynamic::StaticClass(), DynamicName.ToString());
+
+	auto MID = UMaterialInstanceDynamic::Create(InParentMaterial, this, UniqueDynamicName);
+	AnimatedCustomUIMaterialPool.Add(MID);
+	return MID;
+}
 bool UUIBatchMeshRenderable::HaveGeometryModifier(bool includeDisabled)
 {
 #if WITH_EDITOR
@@ -213,7 +252,7 @@ bool UUIBatchMeshRenderable::HaveGeometryModifier(bool includeDisabled)
 	}
 }
 
-void UUIBatchMeshRenderable::GeometryModifierWillChangeVertexData(bool& OutTriangleIndices, bool& OutVertexPosition, bool& OutUV, bool& OutColor)
+bool UUIBatchMeshRenderable::UpdateGeometryModifierStage()
 {
 #if WITH_EDITOR
 	if (!this->GetWorld()->IsGameWorld())
@@ -225,43 +264,156 @@ void UUIBatchMeshRenderable::GeometryModifierWillChangeVertexData(bool& OutTrian
 	}
 #endif
 
-	int count = GeometryModifierComponentArray.Num();
-	if (count > 0)
+	bool bStageChanged = false;
+	int StageCount = 0;
+	for (auto& Item : GeometryModifierComponentArray)
 	{
-		for (int i = 0; i < count; i++)
+		if (!Item->GetEnable())continue;
+		if (StageCount >= GeometryModifierStageArray.Num())
 		{
-			auto modifierComp = GeometryModifierComponentArray[i];
-			if (modifierComp->GetEnable())
+			GeometryModifierStageArray.AddDefaulted();
+			bStageChanged = true;
+		}
+		auto& Stage = GeometryModifierStageArray[StageCount];
+		if (Stage.Modifier != Item)
+		{
+			Stage.Modifier = Item;
+			bStageChanged = true;
+		}
+		StageCount++;
+	}
+	if (StageCount != GeometryModifierStageArray.Num())
+	{
+		GeometryModifierStageArray.SetNum(StageCount);
+		bStageChanged = true;
+	}
+
+	if (bStageChanged)
+	{
+		for (int i = 0; i < StageCount; i++)
+		{
+			auto& Stage = GeometryModifierStageArray[i];
+			if (i == StageCount - 1)//last stage output to geometry
+			{
+				Stage.OutputGeometry = geometry;
+			}
+			else if (!Stage.OutputGeometry.IsValid() || Stage.OutputGeometry == geometry)
+			{
+				Stage.OutputGeometry = MakeShared<UIGeometry>();
+			}
+			Stage.InputVertexCount = INDEX_NONE;
+			Stage.InputTriangleIndexCount = INDEX_NONE;
+		}
+		if (StageCount > 0)
+		{
+			if (!BaseGeometry.IsValid())
 			{
-				bool TempTriangleIndices = false, TempVertexPosition = false, TempUV = false, TempColor = false;
-				modifierComp->ModifierWillChangeVertexData(TempTriangleIndices, TempVertexPosition, TempUV, TempColor);
-				if (TempTriangleIndices)OutTriangleIndices = true;
-				if (TempVertexPosition)OutVertexPosition = true;
-				if (TempUV)OutUV = true;
-				if (TempColor)OutColor = true;
+				BaseGeometry = MakeShared<UIGeometry>();
 			}
 		}
+		else
+		{
+			BaseGeometry.Reset();
+		}
 	}
+	return bStageChanged;
 }
 
-void UUIBatchMeshRenderable::ApplyGeometryModifier(bool triangleChanged, bool uvChanged, bool colorChanged, bool vertexPositionChanged)
+/** Copy changed channel from source to target, target's data count will be the same as source, and unchanged data is kept. */
+static void CopyGeometryChannel(const UIGeometry& Source, UIGeometry& Target, bool InTriangleChanged, bool InVertexPositionChanged, bool InUVChanged, bool InColorChanged)
 {
-	SCOPE_CYCLE_COUNTER(STAT_ApplyModifier);
+	const int32 TriangleIndexCount = Source.triangles.Num();
+	const int32 OriginVertexCount = Source.originVertices.Num();
+	const int32 VertexCount = Source.vertices.Num();
+	//not allow shrinking, so the data after count is still there for incremental modifier
+	Target.triangles.SetNumUninitialized(TriangleIndexCount, false);
+	Target.originVertices.SetNumUninitialized(OriginVertexCount, false);
+	Target.vertices.SetNumUninitialized(VertexCount, false);
+	Target.texture = Source.texture;
+	Target.material = Source.material;
 
-	int count = GeometryModifierComponentArray.Num();
-	if (count > 0)
+	if (InTriangleChanged)
+	{
+		FMemory::Memcpy(Target.triangles.GetData(), Source.triangles.GetData(), TriangleIndexCount * sizeof(FLGUIMeshIndexBufferType));
+	}
+	if (InVertexPositionChanged)
+	{
+		FMemory::Memcpy(Target.originVertices.GetData(), Source.originVertices.GetData(), OriginVertexCount * sizeof(FLGUIOriginVertexData));
+	}
+	if (InVertexPositionChanged && InUVChanged && InColorChanged)
+	{
+		FMemory::Memcpy(Target.vertices.GetData(), Source.vertices.GetData(), VertexCount * sizeof(FLGUIMeshVertex));
+	}
+	else if (InUVChanged || InColorChanged)
 	{
-		for (int i = 0; i < count; i++)
+		for (int i = 0; i < VertexCount; i++)
 		{
-			auto modifierComp = GeometryModifierComponentArray[i];
-			if (modifierComp->GetEnable())
+			auto& SourceVert = Source.vertices[i];
+			auto& TargetVert = Target.vertices[i];
+			if (InUVChanged)
 			{
-				modifierComp->ModifyUIGeometry(*(geometry.Get()), triangleChanged, uvChanged, colorChanged, vertexPositionChanged);
+				for (int UVIndex = 0; UVIndex < LGUI_VERTEX_TEXCOORDINATE_COUNT; UVIndex++)
+				{
+					TargetVert.TextureCoordinate[UVIndex] = SourceVert.TextureCoordinate[UVIndex];
+				}
+			}
+			if (InColorChanged)
+			{
+				TargetVert.Color = SourceVert.Color;
 			}
 		}
 	}
 }
 
+void UUIBatchMeshRenderable::ApplyGeometryModifier(bool& InOutTriangleChanged, bool& InOutVertexPositionChanged, bool& InOutUVChanged, bool& InOutColorChanged)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ApplyModifier);
+
+	const UIGeometry* InputGeometry = BaseGeometry.Get();
+	for (auto& Stage : GeometryModifierStageArray)
+	{
+		auto ModifierComp = Stage.Modifier.Get();
+		auto OutputGeometry = Stage.OutputGeometry.Get();
+		bool bCountChanged = Stage.InputVertexCount != InputGeometry->vertices.Num() || Stage.InputTriangleIndexCount != InputGeometry->triangles.Num() || InputGeometry->originVertices.Num() != InputGeometry->vertices.Num();
+		Stage.InputVertexCount = InputGeometry->vertices.Num();
+		Stage.InputTriangleIndexCount = InputGeometry->triangles.Num();
+		//channel requested by modifier itself, also affect following stages
+		InOutVertexPositionChanged |= Stage.bVertexPositionDirty;
+		InOutUVChanged |= Stage.bUVDirty;
+		InOutColorChanged |= Stage.bColorDirty;
+		Stage.bVertexPositionDirty = Stage.bUVDirty = Stage.bColorDirty = false;
+		if (ModifierComp->SupportIncrementalModify())
+		{
+			if (bCountChanged)
+			{
+				InOutTriangleChanged = InOutVertexPositionChanged = InOutUVChanged = InOutColorChanged = true;
+			}
+			if (!InOutTriangleChanged && !InOutVertexPositionChanged && !InOutUVChanged && !InOutColorChanged)
+			{
+				InputGeometry = OutputGeometry;
+				continue;
+			}
+			ModifierComp->GetIncrementalModifyRequiredChannel(InOutTriangleChanged, InOutVertexPositionChanged, InOutUVChanged, InOutColorChanged);
+			CopyGeometryChannel(*InputGeometry, *OutputGeometry, InOutTriangleChanged, InOutVertexPositionChanged, InOutUVChanged, InOutColorChanged);
+			ModifierComp->ModifyUIGeometry(*OutputGeometry, InOutTriangleChanged, InOutUVChanged, InOutColorChanged, InOutVertexPositionChanged);
+			ModifierComp->GetIncrementalModifyChangedChannel(InOutTriangleChanged, InOutVertexPositionChanged, InOutUVChanged, InOutColorChanged);
+		}
+		else
+		{
+			//not support incremental, refresh all input data, and the data this modifier will change should be treat as changed
+			bool TempTriangleIndices = false, TempVertexPosition = false, TempUV = false, TempColor = false;
+			ModifierComp->ModifierWillChangeVertexData(TempTriangleIndices, TempVertexPosition, TempUV, TempColor);
+			InOutTriangleChanged |= TempTriangleIndices || bCountChanged;
+			InOutVertexPositionChanged |= TempVertexPosition || bCountChanged;
+			InOutUVChanged |= TempUV || bCountChanged;
+			InOutColorChanged |= TempColor || bCountChanged;
+			CopyGeometryChannel(*InputGeometry, *OutputGeometry, true, true, true, true);
+			ModifierComp->ModifyUIGeometry(*OutputGeometry, InOutTriangleChanged, InOutUVChanged, InOutColorChanged, InOutVertexPositionChanged);
+		}
+		InputGeometry = OutputGeometry;
+	}
+}
+
 DECLARE_CYCLE_STAT(TEXT("UIBatchMeshRenderable UpdateGeometry"), STAT_UpdateGeometry, STATGROUP_LGUI);
 void UUIBatchMeshRenderable::UpdateGeometry()
 {
@@ -270,14 +422,41 @@ void UUIBatchMeshRenderable::UpdateGeometry()
 	Super::UpdateGeometry();
 
 	OnBeforeCreateOrUpdateGeometry();
+	if (UpdateGeometryModifierStage())//stage changed, cached geometry is not valid
+	{
+		bTriangleChanged = true;
+		bLocalVertexPositionChanged = true;
+		bUVChanged = true;
+		bColorChanged = true;
+	}
+	//fill geometry before modifier. if have modifier then fill BaseGeometry, swap it with geometry so anything inside OnUpdateGeometry can still use geometry
+	auto UpdateBaseGeometry = [this](bool InTriangleChanged, bool InVertexPositionChanged, bool InUVChanged, bool InColorChanged) {
+		if (BaseGeometry.IsValid())
+		{
+			BaseGeometry->texture = geometry->texture;
+			BaseGeometry->material = geometry->material;
+			Swap(geometry, BaseGeometry);
+			geometry->Clear();
+			OnUpdateGeometry(*(geometry.Get()), InTriangleChanged, InVertexPositionChanged, InUVChanged, InColorChanged);
+			Swap(geometry, BaseGeometry);
+		}
+		else
+		{
+			geometry->Clear();
+			OnUpdateGeometry(*(geometry.Get()), InTriangleChanged, InVertexPositionChanged, InUVChanged, InColorChanged);
+		}
+	};
 	if (!drawcall.IsValid()//not add to render yet
 		)
 	{
-		geometry->Clear();
 		geometry->texture = GetTextureToCreateGeometry();
 		geometry->material = GetMaterialToCreateGeometry();
-		OnUpdateGeometry(*(geometry.Get()), true, true, true, true);
-		ApplyGeometryModifier(true, true, true, true);
+		UpdateBaseGeometry(true, true, true, true);
+		if (BaseGeometry.IsValid())
+		{
+			bool TempTriangleIndices = true, TempVertexPosition = true, TempUV = true, TempColor = true;
+			ApplyGeometryModifier(TempTriangleIndices, TempVertexPosition, TempUV, TempColor);
+		}
 		CalculateLocalBounds();//CalculateLocalBounds must stay before TransformVertices, because TransformVertices will also cache bounds for Canvas to check 2d overlap.
 		UIGeometry::TransformVertices(RenderCanvas.Get(), this, geometry.Get());
 	}
@@ -286,20 +465,27 @@ void UUIBatchMeshRenderable::UpdateGeometry()
 		//when use pixel-perfect, the pixel-perfect calculation will take consider transform matrix, so we need to recalculate geometry if pixel-perfect & bTransformChanged
 		bool pixelPerfect = this->GetShouldAffectByPixelPerfect() && this->GetRenderCanvas()->GetActualPixelPerfect();
 		bool pixelPerfectAffectTransform = pixelPerfect && bTransformChanged;
-		if (bTriangleChanged || bLocalVertexPositionChanged || pixelPerfectAffectTransform || bColorChanged || bUVChanged)
+		bool bBaseGeometryChanged = bTriangleChanged || bLocalVertexPositionChanged || pixelPerfectAffectTransform || bColorChanged || bUVChanged;
+		if (bBaseGeometryChanged || bGeometryModifierDirty)
 		{
-			geometry->Clear();
-			//check if GeometryModifier will affect vertex data, if so we need to update these data in OnUpdateGeometry
+			if (bBaseGeometryChanged)//only modifier dirty, BaseGeometry is still valid
 			{
-				bool TempTriangleIndices = false, TempVertexPosition = false, TempUV = false, TempColor = false;
-				GeometryModifierWillChangeVertexData(TempTriangleIndices, TempVertexPosition, TempUV, TempColor);
-				if (TempTriangleIndices)bTriangleChanged = true;
+				UpdateBaseGeometry(bTriangleChanged, bLocalVertexPositionChanged || pixelPerfectAffectTransform, bUVChanged, bColorChanged);
+			}
+			if (BaseGeometry.IsValid())
+			{
+				bool TempTriangleIndices = bTriangleChanged, TempVertexPosition = bLocalVertexPositionChanged || pixelPerfectAffectTransform, TempUV = bUVChanged, TempColor = bColorChanged;
+				ApplyGeometryModifier(TempTriangleIndices, TempVertexPosition, TempUV, TempColor);
+				//modifier may change other channel, pass them out so the data after modifier is updated
+				if (TempTriangleIndices)
+				{
+					bTriangleChanged = true;
+					bLocalVertexPositionChanged = true;//triangle change means vertex count may change, new vertices need to transform
+				}
 				if (TempVertexPosition)bLocalVertexPositionChanged = true;
 				if (TempUV)bUVChanged = true;
 				if (TempColor)bColorChanged = true;
 			}
-			OnUpdateGeometry(*(geometry.Get()), bTriangleChanged, bLocalVertexPositionChanged || pixelPerfectAffectTransform, bUVChanged, bColorChanged);
-			ApplyGeometryModifier(bTriangleChanged, bUVChanged, bColorChanged, bLocalVertexPositionChanged);
 			drawcall->bNeedToUpdateVertex = true;
 			if (bLocalVertexPositionChanged || pixelPerfectAffectTransform)//pixelPerfect is affected by transform, and can affect localVertex calculation
 			{
@@ -334,6 +520,22 @@ void UUIBatchMeshRenderable::UpdateGeometry()
 	bUVChanged = false;
 	bColorChanged = false;
 	bTransformChanged = false;
+	bGeometryModifierDirty = false;
+}
+
+bool UUIBatchMeshRenderable::CanModifyGeometryInPlace()const
+{
+	return drawcall.IsValid() && RenderCanvas.IsValid()
+		&& !BaseGeometry.IsValid()
+		&& !bTriangleChanged && !bLocalVertexPositionChanged && !bUVChanged && !bColorChanged
+		&& geometry->vertices.Num() > 0;
+}
+void UUIBatchMeshRenderable::ApplyGeometryModifiedInPlace()
+{
+	CalculateLocalBounds();//CalculateLocalBounds must stay before TransformVertices, because TransformVertices will also cache bounds for Canvas to check 2d overlap.
+	UIGeometry::TransformVertices(RenderCanvas.Get(), this, geometry.Get());
+	drawcall->bNeedToUpdateVertex = true;
+	MarkCanvasUpdate(false, true, false);
 }
 
 bool UUIBatchMeshRenderable::LineTraceUI(FHitResult& OutHit, const FVector& Start, const FVector& End)
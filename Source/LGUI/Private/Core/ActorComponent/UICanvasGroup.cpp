@@ -5,6 +5,8 @@
 #include "Utils/LGUIUtils.h"
 #include "LTweenManager.h"
 #include "Core/LGUISettings.h"
+#include "Core/LGUIManager.h"
+#include "HAL/IConsoleManager.h"
 
 UUICanvasGroup::UUICanvasGroup()
 {
@@ -42,6 +44,10 @@ void UUICanvasGroup::PostEditChangeProperty(FPropertyChangedEvent& PropertyChang
 void UUICanvasGroup::OnRegister()
 {
 	Super::OnRegister();
+	bPrevIsInteractable = CalculateFinalInteractable();
+	//start from current value, so deferred notify can compare with it. parent change after this will still notify if final alpha changed
+	bIsAlphaDirty = true;
+	NotifiedFinalAlpha = GetFinalAlpha();
 	if (CheckUIItem())
 	{
 		UIItem->RegisterCanvasGroup(this);
@@ -56,6 +62,11 @@ void UUICanvasGroup::OnUnregister()
 		UIItem->UnregisterCanvasGroup();
 		UIItem->UnregisterUIHierarchyChanged(UIHierarchyChangeDelegateHandle);
 	}
+	if (ParentUICanvasGroup.IsValid())
+	{
+		ParentUICanvasGroup->ChildrenUICanvasGroup.RemoveSwap(this);
+		ParentUICanvasGroup = nullptr;
+	}
 }
 
 void UUICanvasGroup::SetParentCanvasGroup(UUICanvasGroup* InParentCanvasGroup)
@@ -64,14 +75,12 @@ void UUICanvasGroup::SetParentCanvasGroup(UUICanvasGroup* InParentCanvasGroup)
 	{
 		if (ParentUICanvasGroup.IsValid())
 		{
-			ParentUICanvasGroup->UnregisterInteractableStateChange(this->ParentInteractableStateChangeDelegateHandle);
-			ParentUICanvasGroup->UnregisterAlphaChange(this->ParentAlphaChangeDelegteHandle);
+			ParentUICanvasGroup->ChildrenUICanvasGroup.RemoveSwap(this);
 		}
 		ParentUICanvasGroup = InParentCanvasGroup;
 		if (ParentUICanvasGroup.IsValid())
 		{
-			this->ParentInteractableStateChangeDelegateHandle = ParentUICanvasGroup->RegisterInteractableStateChange(FSimpleDelegate::CreateUObject(this, &UUICanvasGroup::OnParentInteractableStateChange));
-			this->ParentAlphaChangeDelegteHandle = ParentUICanvasGroup->RegisterAlphaChange(FSimpleDelegate::CreateUObject(this, &UUICanvasGroup::OnAlphaChange));
+			ParentUICanvasGroup->ChildrenUICanvasGroup.AddUnique(this);
 		}
 		OnParentInteractableStateChange();
 		OnAlphaChange();
@@ -104,13 +113,59 @@ void UUICanvasGroup::OnParentInteractableStateChange()
 	CheckInteractableStateChange();
 }
 
+static TAutoConsoleVariable<int32> CVarLGUIDeferCanvasGroupAlphaChange(
+	TEXT("lgui.CanvasGroup.DeferAlphaChange"),
+	0,
+	TEXT("1: In game world, alpha change of UICanvasGroup is notified to UI elements once per frame before update canvas, and only if final alpha actually changed.\n0: Notify UI elements immediately when alpha change."),
+	ECVF_Default);
+
 void UUICanvasGroup::OnAlphaChange()
+{
+	MarkFinalAlphaDirtyRecursive();
+	if (bIsAlphaChangeDeferred)return;
+	if (CVarLGUIDeferCanvasGroupAlphaChange.GetValueOnGameThread() != 0)
+	{
+		auto World = this->GetWorld();
+		if (World != nullptr && World->IsGameWorld() && this->IsRegistered())
+		{
+			if (auto Instance = ULGUIManagerWorldSubsystem::GetInstance(World))
+			{
+				Instance->AddDeferredAlphaChangeCanvasGroup(this);
+				bIsAlphaChangeDeferred = true;
+				return;
+			}
+		}
+	}
+	NotifyAlphaChange(false);
+}
+void UUICanvasGroup::MarkFinalAlphaDirtyRecursive()
 {
 	bIsAlphaDirty = true;
+	for (auto& Child : ChildrenUICanvasGroup)
+	{
+		if (Child.IsValid())
+		{
+			Child->MarkFinalAlphaDirtyRecursive();
+		}
+	}
+}
+void UUICanvasGroup::NotifyAlphaChange(bool InSkipIfNotChanged)
+{
+	bIsAlphaChangeDeferred = false;
+	auto NewFinalAlpha = GetFinalAlpha();
+	if (InSkipIfNotChanged && NotifiedFinalAlpha == NewFinalAlpha)return;//children's final alpha is not affected too
+	NotifiedFinalAlpha = NewFinalAlpha;
 	if (AlphaChangeDelegate.IsBound())
 	{
 		AlphaChangeDelegate.Broadcast();
 	}
+	for (auto& Child : ChildrenUICanvasGroup)
+	{
+		if (Child.IsValid())
+		{
+			Child->NotifyAlphaChange(InSkipIfNotChanged);
+		}
+	}
 }
 
 FDelegateHandle UUICanvasGroup::RegisterInteractableStateChange(const FSimpleDelegate& InCallback)
@@ -149,6 +204,10 @@ float UUICanvasGroup::GetFinalAlpha() const
 }
 
 bool UUICanvasGroup::GetFinalInteractable() const
+{
+	return bPrevIsInteractable;
+}
+bool UUICanvasGroup::CalculateFinalInteractable() const
 {
 	if (ParentUICanvasGroup.IsValid())
 	{
@@ -212,7 +271,7 @@ void UUICanvasGroup::SetAlpha(float value)
 
 void UUICanvasGroup::CheckInteractableStateChange()
 {
-	bool NewIsInteractable = GetFinalInteractable();
+	bool NewIsInteractable = CalculateFinalInteractable();
 	if (bPrevIsInteractable != NewIsInteractable)
 	{
 		bPrevIsInteractable = NewIsInteractable;
@@ -220,6 +279,13 @@ void UUICanvasGroup::CheckInteractableStateChange()
 		{
 			InteractableStateChangeDelegate.Broadcast();
 		}
+		for (auto& Child : ChildrenUICanvasGroup)
+		{
+			if (Child.IsValid())
+			{
+				Child->OnParentInteractableStateChange();
+			}
+		}
 	}
 }
 
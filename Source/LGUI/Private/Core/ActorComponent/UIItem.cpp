@@ -11,6 +11,7 @@
 #include "PrefabSystem/LGUIPrefabManager.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Layout/LGUICanvasScaler.h"
+#include "HAL/IConsoleManager.h"
 #if WITH_EDITOR
 #include "DrawDebugHelpers.h"
 #include "EditorViewportClient.h"
@@ -42,6 +43,7 @@ UUIItem::UUIItem(const FObjectInitializer& ObjectInitializer) :Super(ObjectIniti
 	bAnchorTopCached = false;
 	bNeedSortUIChildren = true;
 	bIsDetaching = false;
+	ClearDeferredHierarchyChange();
 #if WITH_EDITOR
 	bUIActiveStateDirty = true;
 #endif
@@ -210,6 +212,9 @@ void UUIItem::CallUILifeCycleBehavioursChildHierarchyIndexChanged(UUIItem* child
 #pragma endregion LGUILifeCycleUIBehaviour
 
 
+//flatten hierarchy index is only used for comparing render order, so leave a gap between neighbours, then new attached child can insert into the gap without recalculate whole hierarchy
+static constexpr int32 LGUIFlattenHierarchyIndexGap = 16;
+
 void UUIItem::CalculateFlattenHierarchyIndex_Recursive(int& index)const
 {
 	if (this->flattenHierarchyIndex != index)
@@ -221,7 +226,7 @@ void UUIItem::CalculateFlattenHierarchyIndex_Recursive(int& index)const
 	{
 		if (IsValid(child))
 		{
-			index++;
+			index += LGUIFlattenHierarchyIndexGap;
 			child->CalculateFlattenHierarchyIndex_Recursive(index);
 		}
 	}
@@ -255,6 +260,11 @@ void UUIItem::MarkFlattenHierarchyIndexDirty()
 	{
 		RootUIItem->bFlattenHierarchyIndexDirty = true;
 	}
+	NotifyFlattenHierarchyIndexChanged();
+}
+
+void UUIItem::NotifyFlattenHierarchyIndexChanged()
+{
 	//tell canvas to update
 	if (RenderCanvas.IsValid()
 		&& RenderCanvas->IsRegistered()//@todo: why need to check IsRegistered? the only way to set RenderCanvas is SetRenderCanvas function, but when I debug on SetRenderCanvas it's not called at all, so RenderCanvas should not valid here, no clue yet
@@ -272,6 +282,107 @@ void UUIItem::MarkFlattenHierarchyIndexDirty()
 	}
 }
 
+void UUIItem::CollectFlattenHierarchyIndex_Recursive(TArray<int32>& OutIndexArray)const
+{
+	OutIndexArray.Add(this->flattenHierarchyIndex);
+	EnsureUIChildrenSorted();
+	for (auto& child : UIChildren)
+	{
+		if (IsValid(child))
+		{
+			child->CollectFlattenHierarchyIndex_Recursive(OutIndexArray);
+		}
+	}
+}
+
+void UUIItem::AssignFlattenHierarchyIndex_Recursive(const TArray<int32>& InIndexArray, int32& InOutArrayIndex)const
+{
+	this->flattenHierarchyIndex = InIndexArray[InOutArrayIndex++];
+	EnsureUIChildrenSorted();
+	for (auto& child : UIChildren)
+	{
+		if (IsValid(child))
+		{
+			child->AssignFlattenHierarchyIndex_Recursive(InIndexArray, InOutArrayIndex);
+		}
+	}
+}
+
+int32 UUIItem::GetLastFlattenHierarchyIndexInHierarchy()const
+{
+	EnsureUIChildrenSorted();
+	for (int i = UIChildren.Num() - 1; i >= 0; i--)
+	{
+		if (IsValid(UIChildren[i]))
+		{
+			return UIChildren[i]->GetLastFlattenHierarchyIndexInHierarchy();
+		}
+	}
+	return this->flattenHierarchyIndex;
+}
+
+bool UUIItem::GetNextFlattenHierarchyIndexAfterHierarchy(int32& OutIndex)const
+{
+	const UUIItem* Item = this;
+	while (Item != RootUIItem.Get() && Item->ParentUIItem.IsValid())
+	{
+		auto Parent = Item->ParentUIItem.Get();
+		Parent->EnsureUIChildrenSorted();
+		int32 IndexInParent = Parent->UIChildren.IndexOfByKey(Item);
+		for (int i = IndexInParent + 1; i < Parent->UIChildren.Num(); i++)
+		{
+			if (IsValid(Parent->UIChildren[i]))
+			{
+				OutIndex = Parent->UIChildren[i]->flattenHierarchyIndex;
+				return true;
+			}
+		}
+		Item = Parent;
+	}
+	return false;
+}
+
+bool UUIItem::TryInsertFlattenHierarchyIndex(UUIItem* InChild)
+{
+	//only support the new child is the last one, which is the common case of attach
+	EnsureUIChildrenSorted();
+	if (UIChildren.Num() == 0 || UIChildren.Last() != InChild)return false;
+
+	int32 PrevIndex = this->flattenHierarchyIndex;
+	for (int i = UIChildren.Num() - 2; i >= 0; i--)
+	{
+		if (IsValid(UIChildren[i]))
+		{
+			PrevIndex = UIChildren[i]->GetLastFlattenHierarchyIndexInHierarchy();
+			break;
+		}
+	}
+
+	TArray<int32> ChildIndexArray;
+	InChild->CollectFlattenHierarchyIndex_Recursive(ChildIndexArray);
+	const int32 ChildCount = ChildIndexArray.Num();
+
+	int32 Step = LGUIFlattenHierarchyIndexGap;
+	int32 NextIndex;
+	if (this->GetNextFlattenHierarchyIndexAfterHierarchy(NextIndex))
+	{
+		Step = FMath::Min(Step, (NextIndex - PrevIndex) / (ChildCount + 1));
+		if (Step <= 0)return false;//gap is not enough
+	}
+	else if ((int64)PrevIndex + (int64)Step * ChildCount > MAX_int32)
+	{
+		return false;
+	}
+
+	for (int i = 0; i < ChildCount; i++)
+	{
+		ChildIndexArray[i] = PrevIndex + Step * (i + 1);
+	}
+	int32 ArrayIndex = 0;
+	InChild->AssignFlattenHierarchyIndex_Recursive(ChildIndexArray, ArrayIndex);
+	return true;
+}
+
 void UUIItem::SetHierarchyIndex(int32 InInt) 
 { 
 	if (InInt != hierarchyIndex)
@@ -296,6 +407,18 @@ void UUIItem::ApplyHierarchyIndex()
 			ParentUIItem->EnsureUIChildrenValid();
 			ParentUIItem->EnsureUIChildrenSorted();
 			hierarchyIndex = FMath::Clamp(hierarchyIndex, 0, ParentUIItem->UIChildren.Num() - 1);
+			int32 OldIndex = ParentUIItem->UIChildren.IndexOfByKey(this);
+			//if flatten hierarchy index is valid, then only the range between old and new index need to be renumbered, and these UIItems can reuse the same index set
+			bool bCanRenumberInRange = OldIndex != INDEX_NONE && RootUIItem.IsValid() && !RootUIItem->bFlattenHierarchyIndexDirty;
+			int32 RangeStart = FMath::Min(OldIndex, hierarchyIndex), RangeEnd = FMath::Max(OldIndex, hierarchyIndex);
+			TArray<int32> FlattenIndexArray;
+			if (bCanRenumberInRange)
+			{
+				for (int i = RangeStart; i <= RangeEnd; i++)
+				{
+					ParentUIItem->UIChildren[i]->CollectFlattenHierarchyIndex_Recursive(FlattenIndexArray);
+				}
+			}
 			ParentUIItem->UIChildren.Remove(this);
 			ParentUIItem->UIChildren.Insert(this, hierarchyIndex);
 			bool anythingChange = false;
@@ -310,7 +433,19 @@ void UUIItem::ApplyHierarchyIndex()
 			//flatten hierarchy index
 			if (anythingChange)
 			{
-				MarkFlattenHierarchyIndexDirty();
+				if (bCanRenumberInRange)
+				{
+					int32 ArrayIndex = 0;
+					for (int i = RangeStart; i <= RangeEnd; i++)
+					{
+						ParentUIItem->UIChildren[i]->AssignFlattenHierarchyIndex_Recursive(FlattenIndexArray, ArrayIndex);
+					}
+					NotifyFlattenHierarchyIndexChanged();
+				}
+				else
+				{
+					MarkFlattenHierarchyIndexDirty();
+				}
 				ParentUIItem->CallUILifeCycleBehavioursChildHierarchyIndexChanged(this);
 			}
 		}
@@ -658,6 +793,7 @@ void UUIItem::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETel
 		//This is mainly to mark LGUICanvas's bIsViewProjectionMatrixDirty to true.
 		//For the condition LGUI_Tutorials/Tutorials/UIRenderTarget, when move LGUIRenderTarget1 at runtime, the LGUICanvas's RenderTarget's matrix not update, result in wrong interaction.
 		this->RenderCanvas->MarkCanvasLayoutDirty();
+		this->RenderCanvas->MarkCanvasTransformChanged();
 	}
 }
 void UUIItem::CalculateAnchorFromTransform()
@@ -710,8 +846,14 @@ void UUIItem::OnChildAttached(USceneComponent* ChildComponent)
 	Super::OnChildAttached(ChildComponent);
 	if (!IsValid(this) || this->IsUnreachable())return;
 	if (GetWorld() == nullptr)return;
+	if (!ChildComponent->IsA<UUIItem>() && ChildComponent->GetOwner() != GetOwner())//non-UI actor is not indexed, but index need to know it
+	{
+		ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexChildrenChanged(GetOwner());
+	}
 	if (UUIItem* childUIItem = Cast<UUIItem>(ChildComponent))
 	{
+		//if flatten hierarchy index is valid before attach, then we can try to insert child's index instead of recalculate whole hierarchy
+		bool bFlattenHierarchyIndexValid = RootUIItem.IsValid() && !RootUIItem->bFlattenHierarchyIndexDirty;
 		childUIItem->OnUIAttachedToParent();
 
 		EnsureUIChildrenValid();//check
@@ -752,6 +894,13 @@ void UUIItem::OnChildAttached(USceneComponent* ChildComponent)
 			}
 		}
 
+		if (bFlattenHierarchyIndexValid && RootUIItem.IsValid() && childUIItem->RootUIItem == RootUIItem
+			&& !(PrefabManager && PrefabManager->IsPrefabSystemProcessingActor(this->GetOwner()))
+			&& TryInsertFlattenHierarchyIndex(childUIItem))
+		{
+			RootUIItem->bFlattenHierarchyIndexDirty = false;
+		}
+
 		MarkCanvasUpdate(false, false, false);
 	}
 }
@@ -793,6 +942,10 @@ void UUIItem::OnUIAttachedToParent()
 	UIHierarchyChanged(ParentCanvas, ParentCanvasGroup, ParentUIItem->RootUIItem.Get());
 	//callback
 	CallUILifeCycleBehavioursAttachmentChanged();
+	if (GetOwner()->GetRootComponent() == this)
+	{
+		ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexAttachmentChanged(GetOwner());
+	}
 }
 
 void UUIItem::OnChildDetached(USceneComponent* ChildComponent)
@@ -800,6 +953,10 @@ void UUIItem::OnChildDetached(USceneComponent* ChildComponent)
 	Super::OnChildDetached(ChildComponent);
 	if (!IsValid(this) || this->IsUnreachable())return;
 	if (GetWorld() == nullptr)return;
+	if (!ChildComponent->IsA<UUIItem>() && ChildComponent->GetOwner() != GetOwner())
+	{
+		ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexChildrenChanged(GetOwner());
+	}
 
 	if (auto childUIItem = Cast<UUIItem>(ChildComponent))
 	{
@@ -862,6 +1019,10 @@ void UUIItem::OnUIDetachedFromParent()
 	UIHierarchyChanged(nullptr, nullptr, nullptr);
 	//callback
 	CallUILifeCycleBehavioursAttachmentChanged();
+	if (GetOwner()->GetRootComponent() == this)
+	{
+		ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexAttachmentChanged(GetOwner());
+	}
 }
 
 void UUIItem::OnRegister()
@@ -924,6 +1085,7 @@ void UUIItem::OnRegister()
 
 	bCanSetAnchorFromTransform = true;
 	CheckRootUIItem();
+	ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexRegisterChanged(this, true);
 }
 void UUIItem::OnUnregister()
 {
@@ -944,7 +1106,9 @@ void UUIItem::OnUnregister()
 		}
 #endif
 	}
+	ClearDeferredHierarchyChange();//not resolve it anymore, LGUIManager will skip this one
 	CheckRootUIItem();
+	ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexRegisterChanged(this, false);
 }
 
 void UUIItem::OnComponentDestroyed(bool bDestroyingHierarchy)
@@ -2029,6 +2193,13 @@ void UUIItem::SetOnTransformChange(bool InPositionChanged, bool InScaleChanged)
 		}
 	}
 
+	if (TryDeferHierarchyChange())
+	{
+		bDeferredTransformPositionChanged |= InPositionChanged;
+		bDeferredTransformScaleChanged |= InScaleChanged;
+		return;
+	}
+
 	if (InPositionChanged || InScaleChanged)
 	{
 		CallUILifeCycleBehavioursDimensionsChanged(InPositionChanged, InPositionChanged, InScaleChanged, InScaleChanged);
@@ -2073,6 +2244,16 @@ void UUIItem::OnAnchorChange(bool InPivotChange, bool InWidthChange, bool InHeig
 		}
 	}
 
+	if (TryDeferHierarchyChange())
+	{
+		bDeferredAnchorChanged = true;
+		bDeferredHorizontalPositionChanged |= HorizontalPositionChanged;
+		bDeferredVerticalPositionChanged |= VerticalPositionChanged;
+		bDeferredWidthChanged |= InWidthChange;
+		bDeferredHeightChanged |= InHeightChange;
+		return;
+	}
+
 	if (HorizontalPositionChanged || VerticalPositionChanged || InWidthChange || InHeightChange)
 	{
 		CallUILifeCycleBehavioursDimensionsChanged(HorizontalPositionChanged, VerticalPositionChanged, InWidthChange, InHeightChange);
@@ -2096,6 +2277,81 @@ void UUIItem::OnAnchorChange(bool InPivotChange, bool InWidthChange, bool InHeig
 	}
 }
 
+static TAutoConsoleVariable<int32> CVarLGUIDeferUIItemHierarchyChange(
+	TEXT("lgui.UIItem.DeferHierarchyChange"),
+	0,
+	TEXT("1: In game world, anchor/transform change of UIItem only record dirty flags, and all children are updated once per frame before layout.\n0: Update children immediately when anchor/transform change."),
+	ECVF_Default);
+
+bool UUIItem::TryDeferHierarchyChange()
+{
+	if (bDeferredChangeRegistered)return true;
+	if (CVarLGUIDeferUIItemHierarchyChange.GetValueOnGameThread() == 0)return false;
+	auto World = this->GetWorld();
+	if (World == nullptr || !World->IsGameWorld())return false;
+	if (!this->IsRegistered())return false;
+	if (auto Instance = ULGUIManagerWorldSubsystem::GetInstance(World))
+	{
+		Instance->AddDeferredHierarchyChangeUIItem(this);
+		bDeferredChangeRegistered = true;
+		return true;
+	}
+	return false;
+}
+
+void UUIItem::ResolveDeferredHierarchyChange(bool InAnchorChange, bool InWidthChange, bool InHeightChange, bool InPositionChange, bool InScaleChange)
+{
+	//already in resolve pass, mark as registered so change from parent only need to be recorded and merged
+	bDeferredChangeRegistered = true;
+	if (InAnchorChange)
+	{
+		OnAnchorChange(false, InWidthChange, InHeightChange);
+	}
+	if (InPositionChange || InScaleChange)
+	{
+		SetOnTransformChange(InPositionChange, InScaleChange);
+	}
+
+	bool AnchorChanged = bDeferredAnchorChanged;
+	bool HorizontalPositionChanged = bDeferredHorizontalPositionChanged || bDeferredTransformPositionChanged;
+	bool VerticalPositionChanged = bDeferredVerticalPositionChanged || bDeferredTransformPositionChanged;
+	bool WidthChanged = bDeferredWidthChanged;
+	bool HeightChanged = bDeferredHeightChanged;
+	bool TransformPositionChanged = bDeferredTransformPositionChanged;
+	bool TransformScaleChanged = bDeferredTransformScaleChanged;
+	ClearDeferredHierarchyChange();
+
+	if (HorizontalPositionChanged || VerticalPositionChanged || WidthChanged || HeightChanged || TransformScaleChanged)
+	{
+		CallUILifeCycleBehavioursDimensionsChanged(HorizontalPositionChanged, VerticalPositionChanged, WidthChanged || TransformScaleChanged, HeightChanged || TransformScaleChanged);
+	}
+
+	if (AnchorChanged || TransformPositionChanged || TransformScaleChanged)
+	{
+		for (auto& UIChild : UIChildren)
+		{
+			if (IsValid(UIChild))
+			{
+				bool ChildWidthChange = WidthChanged && UIChild->AnchorData.IsHorizontalStretched();
+				bool ChildHeightChange = HeightChanged && UIChild->AnchorData.IsVerticalStretched();
+				UIChild->ResolveDeferredHierarchyChange(AnchorChanged, ChildWidthChange, ChildHeightChange, TransformPositionChanged, TransformScaleChanged);
+			}
+		}
+	}
+}
+
+void UUIItem::ClearDeferredHierarchyChange()
+{
+	bDeferredChangeRegistered = false;
+	bDeferredAnchorChanged = false;
+	bDeferredHorizontalPositionChanged = false;
+	bDeferredVerticalPositionChanged = false;
+	bDeferredWidthChanged = false;
+	bDeferredHeightChanged = false;
+	bDeferredTransformPositionChanged = false;
+	bDeferredTransformScaleChanged = false;
+}
+
 void UUIItem::MarkCanvasUpdate(bool bMaterialOrTextureChanged, bool bTransformOrVertexPositionChanged, bool bHierarchyOrderChanged, bool bForceRebuildDrawcall)
 {
 	if (RenderCanvas.IsValid())
@@ -371,7 +371,24 @@ void UUIProceduralRect::OnPostChangeSpriteProperty()
 
 void UUIProceduralRect::OnBeforeCreateOrUpdateGeometry()
 {
-	
+	if (bNeedUpdateBlockData)
+	{
+		if (UpdateBlockData())
+		{
+			MarkUVDirty();//block position is stored in uv1
+		}
+	}
+}
+
+bool UUIProceduralRect::UpdateBlockData()
+{
+	bNeedUpdateBlockData = false;
+
+	auto BlockSize = ProceduralRectData->GetBlockSizeInByte();
+	TArray<uint8, TInlineAllocator<256>> BlockBuffer;
+	BlockBuffer.SetNumZeroed(BlockSize);
+	FillData(BlockBuffer.GetData(), this->GetWidth(), this->GetHeight());
+	return ProceduralRectData->UpdateSharedBlock(DataStartPosition, BlockBuffer.GetData());
 }
 
 UTexture* UUIProceduralRect::GetTextureToCreateGeometry()
@@ -599,6 +616,11 @@ void UUIProceduralRect::OnUpdateGeometry(UIGeometry& InGeo, bool InTriangleChang
 
 	if (InTriangleChanged || InVertexPositionChanged || InVertexUVChanged || InVertexColorChanged)
 	{
+		if (UpdateBlockData())//before write uv1, block position may change
+		{
+			MarkUVDirty();//block position is stored in uv1, so uv channel is changed even if not requested. GeometryModifier read the flag after this
+		}
+
 		auto& vertices = InGeo.vertices;
 		if (this->bEnableOuterShadow)
 		{
@@ -619,18 +641,13 @@ void UUIProceduralRect::OnUpdateGeometry(UIGeometry& InGeo, bool InTriangleChang
 				vertices[i].TextureCoordinate[2] = FVector2f(0, 0);
 			}
 		}
-		bNeedUpdateBlockData = true;
 	}
-
-	if (bNeedUpdateBlockData)
+	else if (bNeedUpdateBlockData)
 	{
-		bNeedUpdateBlockData = false;
-
-		auto BlockSize = ProceduralRectData->GetBlockSizeInByte();
-		uint8* BlockBuffer = new uint8[BlockSize];
-		FMemory::Memzero(BlockBuffer, BlockSize);
-		FillData(BlockBuffer, this->GetWidth(), this->GetHeight());
-		ProceduralRectData->UpdateBlock(DataStartPosition, BlockBuffer);
+		if (UpdateBlockData())
+		{
+			MarkUVDirty();
+		}
 	}
 }
 
@@ -13,6 +13,8 @@
 #include "PrefabSystem/LGUIPrefabManager.h"
 #include "Utils/LGUIUtils.h"
 #include "Core/ActorComponent/UICanvasGroup.h"
+#include "UObject/UObjectIterator.h"
+#include "HAL/IConsoleManager.h"
 
 #if LGUI_CAN_DISABLE_OPTIMIZATION
 PRAGMA_DISABLE_OPTIMIZATION
@@ -45,6 +47,7 @@ void UUIText::ApplyFontTextureScaleUp()
 			uv *= 0.5f;
 		}
 	}
+	CacheTextGeometryData.ApplyFontTextureScaleUpToGlyphCache();
 	geometry->texture = GetTextureToCreateGeometry();
 	if (RenderCanvas.IsValid())
 	{
@@ -61,6 +64,7 @@ void UUIText::ApplyFontTextureScaleUp()
 
 void UUIText::ApplyFontTextureChange()
 {
+	CacheTextGeometryData.ClearGlyphCache();
 	if (IsValid(font))
 	{
 		MarkVerticesDirty(true, true, true, true);
@@ -100,6 +104,7 @@ void UUIText::ApplyFontMaterialChange()
 
 void UUIText::ApplyRecreateText()
 {
+	CacheTextGeometryData.ClearGlyphCache();
 	if (IsValid(font))
 	{
 		CacheTextGeometryData.MarkDirty();
@@ -143,6 +148,7 @@ void UUIText::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		font->RemoveUIText(this);
 		bHasAddToFont = false;
+		CacheTextGeometryData.ClearGlyphCache();//no longer receive font texture change
 	}
 	if (IsValid(richTextImageData))
 	{
@@ -205,6 +211,7 @@ void UUIText::OnUnregister()
 			{
 				font->RemoveUIText(this);
 				bHasAddToFont = false;
+				CacheTextGeometryData.ClearGlyphCache();//no longer receive font texture change
 			}
 			if (IsValid(richTextImageData))
 			{
@@ -383,6 +390,7 @@ void UUIText::UpdateMaterialClipType()
 
 void UUIText::OnCultureChanged_Implementation()
 {
+	ConditionalApplyPendingNumberText();
 	auto originText = text;
 	text = FText::GetEmpty();//just make it work, because SetText will compare text value
 	SetText(originText);
@@ -400,7 +408,8 @@ void UUIText::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent
 		auto MemberPropertyName = MemberProperty->GetFName();
 		if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UUIText, text))
 		{
-			
+			bHasNumberText = false;
+			bNumberTextPending = false;
 		}
 		else if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UUIText, font))
 		{
@@ -488,6 +497,7 @@ void UUIText::EditorForceUpdate()
 {
 	Super::EditorForceUpdate();
 
+	ConditionalApplyPendingNumberText();
 	visibleCharCount = VisibleCharCountInString(text.ToString());
 	if (!IsValid(font))
 	{
@@ -505,6 +515,7 @@ void UUIText::OnPreChangeFontProperty()
 	{
 		font->RemoveUIText(this);
 		bHasAddToFont = false;
+		CacheTextGeometryData.ClearGlyphCache();//no longer receive font texture change
 	}
 }
 void UUIText::OnPostChangeFontProperty()
@@ -584,6 +595,7 @@ void UUIText::SetFont(ULGUIFontData_BaseObject* newFont) {
 		{
 			font->RemoveUIText(this);
 			bHasAddToFont = false;
+			CacheTextGeometryData.ClearGlyphCache();//no longer receive font texture change
 		}
 		font = newFont;
 
@@ -597,6 +609,8 @@ void UUIText::SetFont(ULGUIFontData_BaseObject* newFont) {
 	}
 }
 void UUIText::SetText(const FText& newText) {
+	ConditionalApplyPendingNumberText();
+	bHasNumberText = false;
 	if (!text.EqualTo(newText))
 	{
 		text = newText;
@@ -614,6 +628,214 @@ void UUIText::SetText(const FText& newText) {
 	}
 }
 
+namespace LGUINumberText
+{
+	static const uint64 Pow10[] = { 1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull };
+	constexpr int32 MaxFractionDigits = 9;
+	constexpr int32 MaxIntegerDigits = 20;
+	constexpr int32 BufferSize = 64;
+	/** Write number from buffer end, return start index in buffer. */
+	static int32 Format(TCHAR(&OutBuffer)[BufferSize], bool InNegative, uint64 InIntegerPart, uint64 InFractionPart, int32 InFractionDigits, int32 InMinIntegerDigits, bool InUseGrouping)
+	{
+		int32 index = BufferSize;
+		for (int32 i = 0; i < InFractionDigits; i++)
+		{
+			OutBuffer[--index] = (TCHAR)(TEXT('0') + InFractionPart % 10);
+			InFractionPart /= 10;
+		}
+		if (InFractionDigits > 0)
+		{
+			OutBuffer[--index] = TEXT('.');
+		}
+		int32 integerDigits = 0;
+		do
+		{
+			if (InUseGrouping && integerDigits > 0 && integerDigits % 3 == 0)
+			{
+				OutBuffer[--index] = TEXT(',');
+			}
+			OutBuffer[--index] = (TCHAR)(TEXT('0') + InIntegerPart % 10);
+			InIntegerPart /= 10;
+			integerDigits++;
+		} while (InIntegerPart > 0 || integerDigits < InMinIntegerDigits);
+		if (InNegative)
+		{
+			OutBuffer[--index] = TEXT('-');
+		}
+		return index;
+	}
+}
+void UUIText::SetNumber(double InValue, int32 InFractionDigits, int32 InMinIntegerDigits, bool InUseGrouping)
+{
+	InFractionDigits = FMath::Clamp(InFractionDigits, 0, LGUINumberText::MaxFractionDigits);
+	InMinIntegerDigits = FMath::Clamp(InMinIntegerDigits, 1, LGUINumberText::MaxIntegerDigits);
+	const uint64 fractionScale = LGUINumberText::Pow10[InFractionDigits];
+	const double scaledValue = FMath::RoundToDouble(FMath::Abs(InValue) * fractionScale);
+	if (!FMath::IsFinite(scaledValue) || scaledValue >= 9.0e18)//can't fit in uint64, use FText
+	{
+		FNumberFormattingOptions Options;
+		Options.SetUseGrouping(InUseGrouping);
+		Options.SetMinimumIntegralDigits(InMinIntegerDigits);
+		Options.SetMinimumFractionalDigits(InFractionDigits);
+		Options.SetMaximumFractionalDigits(InFractionDigits);
+		SetText(FText::AsNumber(InValue, &Options));
+		return;
+	}
+	const uint64 scaledInteger = (uint64)scaledValue;
+	TCHAR buffer[LGUINumberText::BufferSize];
+	const int32 startIndex = LGUINumberText::Format(buffer, InValue < 0 && scaledInteger != 0
+		, scaledInteger / fractionScale, scaledInteger % fractionScale
+		, InFractionDigits, InMinIntegerDigits, InUseGrouping);
+	SetNumberText(FStringView(buffer + startIndex, LGUINumberText::BufferSize - startIndex));
+}
+void UUIText::SetInteger(int64 InValue, int32 InMinIntegerDigits, bool InUseGrouping)
+{
+	InMinIntegerDigits = FMath::Clamp(InMinIntegerDigits, 1, LGUINumberText::MaxIntegerDigits);
+	const uint64 absValue = InValue < 0 ? (uint64)(-(InValue + 1)) + 1 : (uint64)InValue;
+	TCHAR buffer[LGUINumberText::BufferSize];
+	const int32 startIndex = LGUINumberText::Format(buffer, InValue < 0, absValue, 0, 0, InMinIntegerDigits, InUseGrouping);
+	SetNumberText(FStringView(buffer + startIndex, LGUINumberText::BufferSize - startIndex));
+}
+void UUIText::SetNumberText(FStringView InNumberText)
+{
+	if (bHasNumberText && FStringView(numberText).Equals(InNumberText, ESearchCase::CaseSensitive))return;
+
+	const int32 currentLength = bHasNumberText ? numberText.Len() : text.ToString().Len();
+	if (currentLength == InNumberText.Len()
+		&& !bTextLayoutDirty
+		&& CanModifyGeometryInPlace()
+		&& CacheTextGeometryData.UpdateContentInPlace(InNumberText)
+		)
+	{
+		numberText.Reset(InNumberText.Len());
+		numberText.Append(InNumberText.GetData(), InNumberText.Len());
+		bHasNumberText = true;
+		bNumberTextPending = true;
+		ApplyGeometryModifiedInPlace();
+		return;
+	}
+	SetText(FText::AsCultureInvariant(FString(InNumberText)));
+	numberText.Reset(InNumberText.Len());
+	numberText.Append(InNumberText.GetData(), InNumberText.Len());
+	bHasNumberText = true;
+}
+void UUIText::ConditionalApplyPendingNumberText()const
+{
+	if (bNumberTextPending)
+	{
+		bNumberTextPending = false;
+		const_cast<UUIText*>(this)->text = FText::AsCultureInvariant(numberText);
+	}
+}
+const FText& UUIText::GetText()const
+{
+	ConditionalApplyPendingNumberText();
+	return text;
+}
+void UUIText::Serialize(FArchive& Ar)
+{
+	if (Ar.IsSaving())
+	{
+		ConditionalApplyPendingNumberText();
+	}
+	Super::Serialize(Ar);
+}
+#if !UE_BUILD_SHIPPING
+/** Update numbers of numeric labels in place as SetNumber does, then compare result with a full rebuild, to verify in place update and measure the time. */
+struct FLGUITextSetNumberCompare
+{
+	static bool IsNumericLabel(const FString& InText)
+	{
+		if (InText.Len() == 0)return false;
+		for (auto charCode : InText)
+		{
+			if (!FChar::IsDigit(charCode) && charCode != '.' && charCode != ',' && charCode != '-')return false;
+		}
+		return true;
+	}
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 UpdateCount = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+		const int32 IntegerDigits = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, 9) : 4;
+		const int32 FractionDigits = Args.Num() > 2 ? FMath::Clamp(FCString::Atoi(*Args[2]), 0, LGUINumberText::MaxFractionDigits) : 2;
+
+		int32 TextCount = 0, InPlaceCount = 0, FallbackCount = 0, MismatchCount = 0;
+		double InPlaceTime = 0, RebuildTime = 0;
+		TArray<FVector3f> InPlacePositionArray;
+		TArray<FVector2f> InPlaceUVArray;
+		auto FormatNumber = [=]() {
+			TCHAR buffer[LGUINumberText::BufferSize];
+			const int32 startIndex = LGUINumberText::Format(buffer, false
+				, (uint64)FMath::RandHelper((int32)LGUINumberText::Pow10[IntegerDigits]), (uint64)FMath::RandHelper((int32)LGUINumberText::Pow10[FractionDigits])
+				, FractionDigits, IntegerDigits, false);
+			return FString(LGUINumberText::BufferSize - startIndex, buffer + startIndex);
+		};
+		for (TObjectIterator<UUIText> Itr; Itr; ++Itr)
+		{
+			auto Text = *Itr;
+			if (!IsValid(Text) || Text->IsTemplate() || Text->GetWorld() == nullptr || !Text->GetRenderCanvas() || Text->GetRichText())continue;
+			if (!IsNumericLabel(Text->GetText().ToString()))continue;
+			auto Geometry = Text->GetGeometry();
+			if (Geometry == nullptr)continue;
+			TextCount++;
+			const FText OriginText = Text->GetText();
+			Text->SetText(FText::AsCultureInvariant(FormatNumber()));
+			if (!Text->UpdateCacheTextGeometry())continue;
+
+			auto& Cache = Text->CacheTextGeometryData;
+			for (int32 i = 0; i < UpdateCount; i++)
+			{
+				const FString NewContent = FormatNumber();
+				double StartTime = FPlatformTime::Seconds();
+				const bool bInPlace = Cache.UpdateContentInPlace(NewContent);
+				InPlaceTime += FPlatformTime::Seconds() - StartTime;
+				if (!bInPlace)
+				{
+					//same as SetNumber, fallback to full rebuild
+					FallbackCount++;
+					Text->SetText(FText::AsCultureInvariant(NewContent));
+					Text->UpdateCacheTextGeometry();
+					continue;
+				}
+				InPlaceCount++;
+				InPlacePositionArray.Reset();
+				InPlaceUVArray.Reset();
+				for (int32 vertIndex = 0; vertIndex < Geometry->originVertices.Num(); vertIndex++)
+				{
+					InPlacePositionArray.Add(Geometry->originVertices[vertIndex].Position);
+					InPlaceUVArray.Add(Geometry->vertices[vertIndex].TextureCoordinate[0]);
+				}
+
+				Text->text = FText::AsCultureInvariant(NewContent);
+				Cache.MarkDirty();
+				StartTime = FPlatformTime::Seconds();
+				Text->UpdateCacheTextGeometry();
+				RebuildTime += FPlatformTime::Seconds() - StartTime;
+
+				bool bMatch = InPlacePositionArray.Num() == Geometry->originVertices.Num();
+				for (int32 vertIndex = 0; bMatch && vertIndex < InPlacePositionArray.Num(); vertIndex++)
+				{
+					bMatch = InPlacePositionArray[vertIndex].Equals(Geometry->originVertices[vertIndex].Position, 0.01f)
+						&& InPlaceUVArray[vertIndex].Equals(Geometry->vertices[vertIndex].TextureCoordinate[0], 0.0001f);
+				}
+				if (!bMatch)
+				{
+					MismatchCount++;
+					UE_LOG(LGUI, Warning, TEXT("[%s] In place update not match full rebuild, text: %s, content: %s"), ANSI_TO_TCHAR(__FUNCTION__), *Text->GetPathName(), *NewContent);
+				}
+			}
+			//restore origin text, full update at next canvas update
+			Text->SetText(OriginText);
+		}
+		UE_LOG(LGUI, Log, TEXT("[%s] %d numeric labels x %d updates, in place: %d (mismatch: %d), fallback: %d, in place time: %.3fms, full rebuild time: %.3fms")
+			, ANSI_TO_TCHAR(__FUNCTION__), TextCount, UpdateCount, InPlaceCount, MismatchCount, FallbackCount, InPlaceTime * 1000.0, RebuildTime * 1000.0);
+	}
+};
+static FAutoConsoleCommand LGUITextSetNumberCompareCommand(
+	TEXT("lgui.Text.SetNumberCompare"),
+	TEXT("For every UIText showing a number, update random numbers in place as SetNumber does, compare with full rebuild and log mismatch and time. Origin text is restored after compare. Args: [UpdateCount=100] [IntegerDigits=4] [FractionDigits=2]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FLGUITextSetNumberCompare::Run));
+#endif
 
 void UUIText::SetFontSize(float newSize) {
 	if (size != newSize)
@@ -911,6 +1133,7 @@ bool UUIText::UpdateCacheTextGeometry()const
 {
 	if (!IsValid(this->GetFont()))return false;
 
+	ConditionalApplyPendingNumberText();
 	if (visibleCharCount == -1)visibleCharCount = VisibleCharCountInString(text.ToString());
 	auto CanvasGroupAlpha = (this->GetRichText() && CanvasGroup.IsValid()) ? CanvasGroup->GetFinalAlpha() : 1.0f;
 	CacheTextGeometryData.SetInputParameters(
@@ -1276,6 +1499,7 @@ void UUIText::FindCaretByIndex(int32& inOutCaretPositionIndex, FVector2f& outCar
 }
 void UUIText::FindCaret(FVector2f& inOutCaretPosition, int32 inCaretPositionLineIndex, int32& outCaretPositionIndex)
 {
+	ConditionalApplyPendingNumberText();
 	if (text.ToString().Len() == 0)//no text
 		return;
 	UpdateCacheTextGeometry();
@@ -1304,6 +1528,7 @@ void UUIText::FindCaret(FVector2f& inOutCaretPosition, int32 inCaretPositionLine
 //find caret by position, caret is on left side of char
 void UUIText::FindCaretByWorldPosition(FVector inWorldPosition, FVector2f& outCaretPosition, int32& outCaretPositionLineIndex, int32& outCaretPositionIndex)
 {
+	ConditionalApplyPendingNumberText();
 	if (text.ToString().Len() == 0)//no text
 	{
 		outCaretPositionIndex = 0;
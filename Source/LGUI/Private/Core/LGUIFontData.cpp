@@ -373,29 +373,49 @@ void ULGUIFontData::PushCharData(
 }
 
 
+FLGUICharDataTable* ULGUIFontData::FindCharDataTable(uint16 charSize)
+{
+	if (lastCharDataTable != nullptr && lastCharSize == charSize)
+	{
+		return lastCharDataTable;
+	}
+	if (auto tablePtr = charDataTableMap.Find(charSize))
+	{
+		lastCharSize = charSize;
+		lastCharDataTable = tablePtr->Get();
+		return lastCharDataTable;
+	}
+	return nullptr;
+}
 bool ULGUIFontData::GetCharDataFromCache(const TCHAR& charCode, const float& charSize, FLGUICharData_HighPrecision& OutResult)
 {
-	auto fontKey = FLGUIFontKeyData(charCode, charSize);
-	if (auto charData = charDataMap.Find(fontKey))
+	if (auto table = FindCharDataTable((uint16)charSize))
 	{
-		OutResult = FLGUICharData_HighPrecision(*charData);
-		return true;
+		if (auto charData = table->Find(charCode))
+		{
+			OutResult = FLGUICharData_HighPrecision(*charData);
+			return true;
+		}
 	}
 	return false;
 }
 void ULGUIFontData::AddCharDataToCache(const TCHAR& charCode, const float& charSize, const FLGUICharData& charData)
 {
-	charDataMap.Add(FLGUIFontKeyData(charCode, charSize), charData);
+	const uint16 charSizeKey = (uint16)charSize;
+	auto table = FindCharDataTable(charSizeKey);
+	if (table == nullptr)
+	{
+		table = charDataTableMap.Add(charSizeKey, MakeUnique<FLGUICharDataTable>()).Get();
+		lastCharSize = charSizeKey;
+		lastCharDataTable = table;
+	}
+	table->Add(charCode, charData);
 }
 void ULGUIFontData::ScaleDownUVofCachedChars()
 {
-	for (auto& charDataItem : charDataMap)
+	for (auto& tableItem : charDataTableMap)
 	{
-		auto& mapValue = charDataItem.Value;
-		mapValue.uv0X *= 0.5f;
-		mapValue.uv0Y *= 0.5f;
-		mapValue.uv3X *= 0.5f;
-		mapValue.uv3Y *= 0.5f;
+		tableItem.Value->ScaleDownUV();
 	}
 }
 bool ULGUIFontData::RenderGlyph(const TCHAR& charCode, const float& charSize, FGlyphBitmap& OutResult)
@@ -431,7 +451,8 @@ bool ULGUIFontData::RenderGlyph(const TCHAR& charCode, const float& charSize, FG
 }
 void ULGUIFontData::ClearCharDataCache()
 {
-	charDataMap.Empty();
+	charDataTableMap.Empty();
+	lastCharDataTable = nullptr;
 }
 
 UTexture2D* ULGUIFontData::CreateFontTexture(int InTextureSize)
@@ -476,13 +497,9 @@ void ULGUIFontData::ApplyPackingAtlasTextureExpand(UTexture2D* newTexture, int n
 {
 	Super::ApplyPackingAtlasTextureExpand(newTexture, newTextureSize);
 	//scale down uv of prev chars
-	for (auto& charDataItem : charDataMap)
+	for (auto& tableItem : charDataTableMap)
 	{
-		auto& mapValue = charDataItem.Value;
-		mapValue.uv0X *= 0.5f;
-		mapValue.uv0Y *= 0.5f;
-		mapValue.uv3X *= 0.5f;
-		mapValue.uv3Y *= 0.5f;
+		tableItem.Value->ScaleDownUV();
 	}
 }
 
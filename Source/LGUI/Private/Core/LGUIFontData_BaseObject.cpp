@@ -3,9 +3,75 @@
 #include "Core/LGUIFontData_BaseObject.h"
 #include "LGUI.h"
 #include "Utils/LGUIUtils.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE "LGUIFontData_BaseObject"
 
+void FUITextGlyphCache::Prepare(ULGUIFontData_BaseObject* InFont)
+{
+	if (Font.Get() != InFont)
+	{
+		Reset();
+		Font = InFont;
+	}
+}
+FLGUICharData_HighPrecision FUITextGlyphCache::GetCharData(ULGUIFontData_BaseObject* InFont, TCHAR InCharCode, float InCharSize)
+{
+	if ((uint32)InCharCode >= (uint32)CachedCharCount)
+	{
+		return InFont->GetCharData(InCharCode, InCharSize);
+	}
+	int32 PageIndex = PageArray.IndexOfByPredicate([InCharSize](const FCharSizePage& Item) { return Item.CharSize == InCharSize; });
+	if (PageIndex == INDEX_NONE)
+	{
+		if (PageArray.Num() < MaxCharSizeCount)
+		{
+			PageIndex = PageArray.AddDefaulted();
+		}
+		else
+		{
+			PageIndex = NextReplacePageIndex;
+			NextReplacePageIndex = (NextReplacePageIndex + 1) % MaxCharSizeCount;
+		}
+		auto& NewPage = PageArray[PageIndex];
+		NewPage.CharSize = InCharSize;
+		NewPage.CharDataArray.Reset();
+		FMemory::Memzero(NewPage.CharCodeToIndex);
+	}
+	auto CachedIndex = PageArray[PageIndex].CharCodeToIndex[InCharCode];
+	if (CachedIndex == 0)
+	{
+		//font may expand texture inside GetCharData and call ApplyFontTextureScaleUp, so only store data after get it
+		auto CharData = InFont->GetCharData(InCharCode, InCharSize);
+		auto& Page = PageArray[PageIndex];
+		if (Page.CharDataArray.Num() < MAX_uint8)
+		{
+			Page.CharDataArray.Add(CharData);
+			Page.CharCodeToIndex[InCharCode] = (uint8)Page.CharDataArray.Num();
+		}
+		return CharData;
+	}
+	return PageArray[PageIndex].CharDataArray[CachedIndex - 1];
+}
+void FUITextGlyphCache::ApplyFontTextureScaleUp()
+{
+	for (auto& Page : PageArray)
+	{
+		for (auto& CharData : Page.CharDataArray)
+		{
+			CharData.uv0X *= 0.5f;
+			CharData.uv0Y *= 0.5f;
+			CharData.uv3X *= 0.5f;
+			CharData.uv3Y *= 0.5f;
+		}
+	}
+}
+void FUITextGlyphCache::Reset()
+{
+	PageArray.Reset();
+	NextReplacePageIndex = 0;
+}
+
 ULGUIFontData_BaseObject* ULGUIFontData_BaseObject::GetDefaultFont()
 {
 	static auto defaultFont = LoadObject<ULGUIFontData_BaseObject>(NULL, TEXT("/LGUI/DefaultSDFFont"));
@@ -22,4 +88,84 @@ ULGUIFontData_BaseObject* ULGUIFontData_BaseObject::GetDefaultFont()
 	return defaultFont;
 }
 
+#if !UE_BUILD_SHIPPING
+/** Get glyphs of rapidly changing numeric labels from font directly and from per-label glyph cache, to measure the cost of glyph lookup when rebuild text. */
+struct FLGUINumericLabelBenchmark
+{
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 LabelCount = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+		const int32 UpdateCount = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 100;
+		const float FontSize = Args.Num() > 2 ? FMath::Max(FCString::Atof(*Args[2]), 1.0f) : 18.0f;
+		auto Font = ULGUIFontData_BaseObject::GetDefaultFont();
+		if (Font == nullptr)return;
+
+		//format all label text before timing, so both pass only measure glyph lookup
+		TArray<TArray<FString>> UpdateLabelTextArray;
+		UpdateLabelTextArray.SetNum(UpdateCount);
+		for (int32 UpdateIndex = 0; UpdateIndex < UpdateCount; UpdateIndex++)
+		{
+			auto& LabelTextArray = UpdateLabelTextArray[UpdateIndex];
+			LabelTextArray.SetNum(LabelCount);
+			for (int32 i = 0; i < LabelCount; i++)
+			{
+				LabelTextArray[i] = FString::Printf(TEXT("%d/%.2f"), UpdateIndex * 37 + i, (UpdateIndex + i) * 0.13f);
+			}
+		}
+		//warm up font
+		for (auto& LabelTextArray : UpdateLabelTextArray)
+		{
+			for (auto& Text : LabelTextArray)
+			{
+				for (auto CharCode : Text)
+				{
+					Font->GetCharData(CharCode, FontSize);
+				}
+			}
+		}
+
+		float Checksum = 0;
+		int32 CharCount = 0;
+		double StartTime = FPlatformTime::Seconds();
+		for (auto& LabelTextArray : UpdateLabelTextArray)
+		{
+			for (auto& Text : LabelTextArray)
+			{
+				for (auto CharCode : Text)
+				{
+					Checksum += Font->GetCharData(CharCode, FontSize).xadvance;
+				}
+				CharCount += Text.Len();
+			}
+		}
+		const double FontTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		TArray<FUITextGlyphCache> GlyphCacheArray;
+		GlyphCacheArray.SetNum(LabelCount);
+		float CachedChecksum = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (auto& LabelTextArray : UpdateLabelTextArray)
+		{
+			for (int32 i = 0; i < LabelCount; i++)
+			{
+				auto& GlyphCache = GlyphCacheArray[i];
+				GlyphCache.Prepare(Font);
+				for (auto CharCode : LabelTextArray[i])
+				{
+					CachedChecksum += GlyphCache.GetCharData(Font, CharCode, FontSize).xadvance;
+				}
+			}
+		}
+		const double CacheTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		UE_LOG(LGUI, Log, TEXT("[%s] %d labels x %d updates, %d glyphs, from font: %.3fms, from glyph cache: %.3fms, result %s")
+			, ANSI_TO_TCHAR(__FUNCTION__), LabelCount, UpdateCount, CharCount, FontTime, CacheTime, Checksum == CachedChecksum ? TEXT("match") : TEXT("MISMATCH"));
+	}
+};
+static FAutoConsoleCommand LGUINumericLabelBenchmarkCommand(
+	TEXT("lgui.Text.NumericLabelBenchmark"),
+	TEXT("Get glyphs of rapidly changing numeric labels from font and from per-label glyph cache, and log the time. Args: [LabelCount=100] [UpdateCount=100] [FontSize=18]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FLGUINumericLabelBenchmark::Run));
+#endif
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
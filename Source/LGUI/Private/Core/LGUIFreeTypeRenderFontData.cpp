@@ -11,6 +11,7 @@
 #include "Engine/Texture2D.h"
 #include "Engine/FontFace.h"
 #include "Rendering/Texture2DResource.h"
+#include "HAL/IConsoleManager.h"
 #if WITH_FREETYPE
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -191,6 +192,7 @@ void ULGUIFreeTypeRenderFontData::InitFreeType()
 		texture = nullptr;
 		textureSize = ULGUISettings::ConvertAtlasTextureSizeTypeToSize(initialSize);
 		binPack = rbp::MaxRectsBinPack(rectPackCellSize, rectPackCellSize);
+		skylineBinPack.Init(rectPackCellSize, rectPackCellSize);
 		if (initialSize != ELGUIAtlasTextureSizeType::SIZE_256x256)
 		{
 			binPack.PrepareExpendSizeForText(textureSize, textureSize, freeRects, rectPackCellSize, false);
@@ -221,6 +223,7 @@ void ULGUIFreeTypeRenderFontData::DeinitFreeType()
 	library = nullptr;
 	freeRects.Empty();
 	binPack = rbp::MaxRectsBinPack(256, 256);
+	skylineBinPack = rbp::SkylineBinPack(256, 256);
 #if WITH_EDITORONLY_DATA
 	subFaces.Reset();
 #endif
@@ -370,7 +373,7 @@ FLGUICharData_HighPrecision ULGUIFreeTypeRenderFontData::GetCharData(const TCHAR
 		auto& calcTexture = this->texture;
 		FLGUICharData uiCharData;
 	PACK_AND_INSERT:
-		if (PackRectAndInsertChar(glyphBitmap, calcBinpack, calcTexture, uiCharData))
+		if (PackRectAndInsertChar(glyphBitmap, calcTexture, uiCharData))
 		{
 
 		}
@@ -379,8 +382,7 @@ FLGUICharData_HighPrecision ULGUIFreeTypeRenderFontData::GetCharData(const TCHAR
 			int32 newTextureSize = 0;
 			if (freeRects.Num() > 0)
 			{
-				calcBinpack.DoExpendSizeForText(freeRects[freeRects.Num() - 1]);
-				freeRects.RemoveAt(freeRects.Num() - 1, 1, false);
+				UseNextRectPackCell();
 			}
 			else
 			{
@@ -388,8 +390,7 @@ FLGUICharData_HighPrecision ULGUIFreeTypeRenderFontData::GetCharData(const TCHAR
 				UE_LOG(LGUI, Log, TEXT("[%s].%d Expend font texture size to:%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, newTextureSize);
 				//expend by multiply 2
 				calcBinpack.PrepareExpendSizeForText(newTextureSize, newTextureSize, freeRects, rectPackCellSize);
-				calcBinpack.DoExpendSizeForText(freeRects[freeRects.Num() - 1]);
-				freeRects.RemoveAt(freeRects.Num() - 1, 1, false);
+				UseNextRectPackCell();
 
 				RenewFontTexture(textureSize, newTextureSize);
 				textureSize = newTextureSize;
@@ -416,7 +417,16 @@ FLGUICharData_HighPrecision ULGUIFreeTypeRenderFontData::GetCharData(const TCHAR
 	return Result;
 }
 
-bool ULGUIFreeTypeRenderFontData::PackRectAndInsertChar(const FGlyphBitmap& InGlyphBitmap, rbp::MaxRectsBinPack& InOutBinpack, UTexture2D* InTexture, FLGUICharData& OutResult)
+void ULGUIFreeTypeRenderFontData::UseNextRectPackCell()
+{
+	auto cellRect = freeRects[freeRects.Num() - 1];
+	freeRects.RemoveAt(freeRects.Num() - 1, 1, false);
+	binPack.DoExpendSizeForText(cellRect);
+	skylineBinPack.Init(cellRect.x, cellRect.y, cellRect.width, cellRect.height);
+}
+
+DECLARE_CYCLE_STAT(TEXT("FreeTypeFont PackGlyphRect"), STAT_FreeTypeFontPackGlyphRect, STATGROUP_LGUI);
+bool ULGUIFreeTypeRenderFontData::PackRectAndInsertChar(const FGlyphBitmap& InGlyphBitmap, UTexture2D* InTexture, FLGUICharData& OutResult)
 {
 	if (InGlyphBitmap.width <= 0 || InGlyphBitmap.height <= 0)//glyph no need to display, could be space
 	{
@@ -435,9 +445,18 @@ bool ULGUIFreeTypeRenderFontData::PackRectAndInsertChar(const FGlyphBitmap& InGl
 
 	int charRectWidth = InGlyphBitmap.width + SPACE_BETWEEN_GLYPH_RECTx2;
 	int charRectHeight = InGlyphBitmap.height + SPACE_BETWEEN_GLYPH_RECTx2;
-	auto method = rbp::MaxRectsBinPack::RectBestAreaFit;
-
-	auto packedRect = InOutBinpack.Insert(charRectWidth, charRectHeight, method);
+	rbp::Rect packedRect;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_FreeTypeFontPackGlyphRect);
+		if (useSkylineRectPack)
+		{
+			packedRect = skylineBinPack.Insert(charRectWidth, charRectHeight, rbp::SkylineBinPack::LevelBottomLeft);
+		}
+		else
+		{
+			packedRect = binPack.Insert(charRectWidth, charRectHeight, rbp::MaxRectsBinPack::RectBestAreaFit);
+		}
+	}
 	if (packedRect.height <= 0)//means this area cannot fit the char
 	{
 		return false;
@@ -580,6 +599,7 @@ void ULGUIFreeTypeRenderFontData::PostEditChangeProperty(FPropertyChangedEvent&
 			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, fontType)
 			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, lineHeightType)
 			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, unrealFont)
+			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, useSkylineRectPack)
 			)
 		{
 			if (PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, fontType))
@@ -612,3 +632,73 @@ void ULGUIFreeTypeRenderFontData::PostEditChangeProperty(FPropertyChangedEvent&
 }
 #endif
 
+
+#if !UE_BUILD_SHIPPING
+/** Pack same random glyph-like rects with MaxRectsBinPack and SkylineBinPack heuristics, compare speed and packing quality. */
+struct FLGUIBinPackBenchmark
+{
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 RectCount = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 2000, 1);
+		const int32 BinSize = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1024, 16);
+		const int32 MinRectSize = FMath::Max(Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 8, 1);
+		const int32 MaxRectSize = FMath::Max(Args.Num() > 3 ? FCString::Atoi(*Args[3]) : 32, MinRectSize);
+
+		//glyph-like: height is close to font size, width vary more
+		FRandomStream Random(RectCount);
+		TArray<rbp::RectSize> Rects;
+		Rects.SetNumUninitialized(RectCount);
+		for (auto& Rect : Rects)
+		{
+			Rect.height = Random.RandRange(MinRectSize, MaxRectSize);
+			Rect.width = Random.RandRange(FMath::Max(Rect.height / 3, 1), Rect.height);
+		}
+
+		auto Report = [&](const TCHAR* InName, int32 InPlacedCount, float InOccupancy, double InTime) {
+			UE_LOG(LGUI, Log, TEXT("[%s] %-22s placed: %d/%d, occupancy: %.2f%%, time: %.3fms")
+				, ANSI_TO_TCHAR(__FUNCTION__), InName, InPlacedCount, RectCount, InOccupancy * 100, InTime * 1000);
+		};
+		const TPair<const TCHAR*, rbp::MaxRectsBinPack::FreeRectChoiceHeuristic> MaxRectsMethods[] = {
+			{ TEXT("MaxRects BSSF"), rbp::MaxRectsBinPack::RectBestShortSideFit },
+			{ TEXT("MaxRects BAF"), rbp::MaxRectsBinPack::RectBestAreaFit },
+			{ TEXT("MaxRects BL"), rbp::MaxRectsBinPack::RectBottomLeftRule },
+		};
+		for (auto& Method : MaxRectsMethods)
+		{
+			rbp::MaxRectsBinPack BinPack(BinSize, BinSize);
+			int32 PlacedCount = 0;
+			auto StartTime = FPlatformTime::Seconds();
+			for (auto& Rect : Rects)
+			{
+				if (BinPack.Insert(Rect.width, Rect.height, Method.Value).height > 0)
+				{
+					PlacedCount++;
+				}
+			}
+			Report(Method.Key, PlacedCount, BinPack.Occupancy(), FPlatformTime::Seconds() - StartTime);
+		}
+		const TPair<const TCHAR*, rbp::SkylineBinPack::LevelChoiceHeuristic> SkylineMethods[] = {
+			{ TEXT("Skyline BottomLeft"), rbp::SkylineBinPack::LevelBottomLeft },
+			{ TEXT("Skyline MinWasteFit"), rbp::SkylineBinPack::LevelMinWasteFit },
+		};
+		for (auto& Method : SkylineMethods)
+		{
+			rbp::SkylineBinPack BinPack(BinSize, BinSize);
+			int32 PlacedCount = 0;
+			auto StartTime = FPlatformTime::Seconds();
+			for (auto& Rect : Rects)
+			{
+				if (BinPack.Insert(Rect.width, Rect.height, Method.Value).height > 0)
+				{
+					PlacedCount++;
+				}
+			}
+			Report(Method.Key, PlacedCount, BinPack.Occupancy(), FPlatformTime::Seconds() - StartTime);
+		}
+	}
+};
+static FAutoConsoleCommand LGUIBinPackBenchmarkCommand(
+	TEXT("lgui.Font.BinPackBenchmark"),
+	TEXT("Pack random glyph-like rects with MaxRects and Skyline bin pack, log placed count, occupancy and time. Args: [RectCount=2000] [BinSize=1024] [MinRectSize=8] [MaxRectSize=32]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FLGUIBinPackBenchmark::Run));
+#endif
@@ -19,6 +19,7 @@ ULGUILifeCycleBehaviour::ULGUILifeCycleBehaviour()
 	bCanExecuteUpdate = true;
 	bIsAddedToUpdate = false;
 	bPrevIsRootComponentVisible = false;
+	bIsListeningRootComponentRenderState = false;
 
 	bCanExecuteBlueprintEvent = GetClass()->HasAnyClassFlags(CLASS_CompiledFromBlueprint) || !GetClass()->HasAnyClassFlags(CLASS_Native);
 }
@@ -36,7 +37,7 @@ void ULGUILifeCycleBehaviour::BeginPlay()
 		else
 		{
 			bPrevIsRootComponentVisible = RootComp->GetVisibleFlag();
-			ComponentRenderStateDirtyDelegateHandle = UActorComponent::MarkRenderStateDirtyEvent.AddUObject(this, &ULGUILifeCycleBehaviour::OnComponentRenderStateDirty);
+			bIsListeningRootComponentRenderState = ULGUIManagerWorldSubsystem::AddRootComponentRenderStateListener(RootComp.Get(), this);
 		}
 	}
 }
@@ -64,15 +65,17 @@ void ULGUILifeCycleBehaviour::EndPlay(const EEndPlayReason::Type EndPlayReason)
 			}
 		}
 	}
-	if (ComponentRenderStateDirtyDelegateHandle.IsValid())
+	if (bIsListeningRootComponentRenderState)
 	{
-		UActorComponent::MarkRenderStateDirtyEvent.Remove(ComponentRenderStateDirtyDelegateHandle);
+		bIsListeningRootComponentRenderState = false;
+		ULGUIManagerWorldSubsystem::RemoveRootComponentRenderStateListener(RootComp.Get(), this);
 	}
 	Super::EndPlay(EndPlayReason);
 }
 void ULGUILifeCycleBehaviour::OnRegister()
 {
 	Super::OnRegister();
+	ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexRegisterChanged(this, true);
 #if WITH_EDITOR
 	if (GetWorld() && !GetWorld()->IsGameWorld())
 	{
@@ -93,6 +96,7 @@ void ULGUILifeCycleBehaviour::OnRegister()
 void ULGUILifeCycleBehaviour::OnUnregister()
 {
 	Super::OnUnregister();
+	ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexRegisterChanged(this, false);
 #if WITH_EDITOR
 	if (EditorTickDelegateHandle.IsValid())
 	{
@@ -337,6 +341,26 @@ void ULGUILifeCycleBehaviour::SetCanExecuteUpdate(bool value)
 	}
 }
 
+void ULGUILifeCycleBehaviour::SetUpdateRate(ELGUILifeCycleBehaviourUpdateRate value, int32 InFrameInterval)
+{
+	if (value == ELGUILifeCycleBehaviourUpdateRate::Count)
+	{
+		UE_LOG(LGUI, Error, TEXT("[%s].%d Invalid UpdateRate!"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__);
+		return;
+	}
+	InFrameInterval = FMath::Max(1, InFrameInterval);
+	if (UpdateRate != value || UpdateFrameInterval != InFrameInterval)
+	{
+		UpdateRate = value;
+		UpdateFrameInterval = InFrameInterval;
+		if (bIsAddedToUpdate)//UpdateRate is cached when add to update, so add it again
+		{
+			ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehavioursFromUpdate(this);
+			ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehavioursForUpdate(this);
+		}
+	}
+}
+
 void ULGUILifeCycleBehaviour::Awake()
 {
 	if (bCanExecuteBlueprintEvent)
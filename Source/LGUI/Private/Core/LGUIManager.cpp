@@ -19,6 +19,13 @@
 #include "Core/LGUIRender/LGUIRenderer.h"
 #include "Core/ILGUICultureChangedInterface.h"
 #include "Core/LGUILifeCycleBehaviour.h"
+#include "Core/ActorComponent/UICanvasGroup.h"
+#include "Extensions/UIWidget.h"
+#include "Core/LGUIProceduralRectData.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/BinarySearch.h"
 #include "Layout/ILGUILayoutInterface.h"
 #include "PrefabSystem/LGUIPrefabManager.h"
 #include "PrefabSystem/LGUIPrefabHelperObject.h"
@@ -956,6 +963,8 @@ void ULGUIManagerWorldSubsystem::PostInitialize()
 void ULGUIManagerWorldSubsystem::Deinitialize()
 {
 	Super::Deinitialize();
+	HierarchyComponentIndexCount -= HierarchyComponentIndexMap.Num();
+	HierarchyComponentIndexMap.Empty();
 #if WITH_EDITOR
 	InstanceArray.Remove(this);
 	if (EditorTickDelegateHandle.IsValid())
@@ -976,6 +985,12 @@ void ULGUIManagerWorldSubsystem::Deinitialize()
 	{
 		FInternationalization::Get().OnCultureChanged().Remove(OnCultureChangedDelegateHandle);
 	}
+	if (ComponentRenderStateDirtyDelegateHandle.IsValid())
+	{
+		UActorComponent::MarkRenderStateDirtyEvent.Remove(ComponentRenderStateDirtyDelegateHandle);
+		ComponentRenderStateDirtyDelegateHandle.Reset();
+	}
+	RootComponentRenderStateListenerMap.Empty();
 }
 TStatId ULGUIManagerWorldSubsystem::GetStatId() const
 {
@@ -992,6 +1007,390 @@ void ULGUIManagerWorldSubsystem::OnCultureChanged()
 	bShouldUpdateOnCultureChanged = true;
 }
 
+#pragma region HierarchyComponentIndex
+void FLGUIHierarchyComponentIndex::Rebuild()
+{
+	ActorToComponents.Reset();
+	ClassToComponents.Reset();
+	ActorRanges.Reset();
+	bHierarchyOrderDirty = true;
+	if (RootActor.IsValid())
+	{
+		AddActorRecursive(RootActor.Get());
+	}
+}
+bool FLGUIHierarchyComponentIndex::IsIndexedClass(UClass* InClass)
+{
+	return InClass != nullptr && (InClass->IsChildOf(UUIItem::StaticClass()) || InClass->IsChildOf(ULGUILifeCycleBehaviour::StaticClass()));
+}
+bool FLGUIHierarchyComponentIndex::IsIndexedActor(AActor* InActor)
+{
+	return InActor != nullptr && Cast<UUIItem>(InActor->GetRootComponent()) != nullptr;
+}
+bool FLGUIHierarchyComponentIndex::IsInHierarchy(AActor* InActor)const
+{
+	if (!RootActor.IsValid() || InActor == nullptr)return false;
+	return InActor == RootActor.Get() || InActor->IsAttachedTo(RootActor.Get());
+}
+void FLGUIHierarchyComponentIndex::AddActor(AActor* InActor)
+{
+	RemoveActor(InActor);
+	if (!IsIndexedActor(InActor))return;
+	auto& Components = ActorToComponents.Add(InActor);
+	for (auto Comp : InActor->GetComponents())
+	{
+		if (Comp == nullptr || !IsIndexedClass(Comp->GetClass()))continue;
+		Components.Add(Comp);
+		ClassToComponents.FindOrAdd(Comp->GetClass()).Add({ Comp, 0 });
+	}
+	bHierarchyOrderDirty = true;
+}
+void FLGUIHierarchyComponentIndex::RemoveActor(AActor* InActor)
+{
+	if (auto ComponentsPtr = ActorToComponents.Find(InActor))
+	{
+		for (auto& Comp : *ComponentsPtr)
+		{
+			if (Comp.IsValid())
+			{
+				if (auto ClassComponentsPtr = ClassToComponents.Find(Comp->GetClass()))
+				{
+					auto FoundIndex = ClassComponentsPtr->IndexOfByPredicate([&Comp](const FComponentEntry& Item) { return Item.Component == Comp; });
+					if (FoundIndex != INDEX_NONE)
+					{
+						ClassComponentsPtr->RemoveAt(FoundIndex, 1, false);//keep order
+					}
+				}
+			}
+		}
+		ActorToComponents.Remove(InActor);
+		bHierarchyOrderDirty = true;
+	}
+}
+void FLGUIHierarchyComponentIndex::AddActorRecursive(AActor* InActor)
+{
+	AddActor(InActor);
+	if (!Contains(InActor))return;//non-UI actor's hierarchy is not indexed
+	TArray<AActor*> ChildrenActors;
+	InActor->GetAttachedActors(ChildrenActors);
+	for (auto ChildActor : ChildrenActors)
+	{
+		AddActorRecursive(ChildActor);
+	}
+}
+void FLGUIHierarchyComponentIndex::RemoveActorRecursive(AActor* InActor)
+{
+	RemoveActor(InActor);
+	TArray<AActor*> ChildrenActors;
+	InActor->GetAttachedActors(ChildrenActors);
+	for (auto ChildActor : ChildrenActors)
+	{
+		RemoveActorRecursive(ChildActor);
+	}
+}
+void FLGUIHierarchyComponentIndex::AddComponent(UActorComponent* InComp)
+{
+	if (!IsIndexedClass(InComp->GetClass()))return;
+	if (auto ComponentsPtr = ActorToComponents.Find(InComp->GetOwner()))
+	{
+		if (!ComponentsPtr->Contains(InComp))
+		{
+			ComponentsPtr->Add(InComp);
+			auto& ClassComponents = ClassToComponents.FindOrAdd(InComp->GetClass());
+			auto RangePtr = bHierarchyOrderDirty ? nullptr : ActorRanges.Find(InComp->GetOwner());
+			if (RangePtr == nullptr)
+			{
+				ClassComponents.Add({ InComp, 0 });//will be sorted when needed
+				bHierarchyOrderDirty = true;
+			}
+			else
+			{
+				//actor not change, so insert at owner's order
+				auto Order = RangePtr->Start;
+				auto InsertIndex = Algo::UpperBoundBy(ClassComponents, Order, [](const FComponentEntry& Item) { return Item.Order; });
+				ClassComponents.Insert({ InComp, Order }, InsertIndex);
+			}
+		}
+	}
+}
+void FLGUIHierarchyComponentIndex::RemoveComponent(UActorComponent* InComp)
+{
+	if (auto ComponentsPtr = ActorToComponents.Find(InComp->GetOwner()))
+	{
+		if (ComponentsPtr->RemoveSwap(InComp) > 0)
+		{
+			if (auto ClassComponentsPtr = ClassToComponents.Find(InComp->GetClass()))
+			{
+				auto FoundIndex = ClassComponentsPtr->IndexOfByPredicate([InComp](const FComponentEntry& Item) { return Item.Component == InComp; });
+				if (FoundIndex != INDEX_NONE)
+				{
+					ClassComponentsPtr->RemoveAt(FoundIndex, 1, false);//keep order
+				}
+			}
+		}
+	}
+}
+bool FLGUIHierarchyComponentIndex::BuildHierarchyOrder_Recursive(AActor* InActor, int32& InOutOrder)const
+{
+	FActorRange Range;
+	Range.Start = InOutOrder++;
+	TArray<AActor*> ChildrenActors;
+	InActor->GetAttachedActors(ChildrenActors);
+	for (auto ChildActor : ChildrenActors)
+	{
+		if (ActorToComponents.Contains(ChildActor))
+		{
+			Range.bHasUnindexedChild |= BuildHierarchyOrder_Recursive(ChildActor, InOutOrder);
+		}
+		else
+		{
+			Range.bHasUnindexedChild = true;
+		}
+	}
+	Range.End = InOutOrder;
+	ActorRanges.Add(InActor, Range);
+	return Range.bHasUnindexedChild;
+}
+void FLGUIHierarchyComponentIndex::EnsureHierarchyOrder()const
+{
+	if (!bHierarchyOrderDirty)return;
+	bHierarchyOrderDirty = false;
+	ActorRanges.Reset();
+	if (RootActor.IsValid() && ActorToComponents.Contains(RootActor))
+	{
+		int32 Order = 0;
+		BuildHierarchyOrder_Recursive(RootActor.Get(), Order);
+	}
+	for (auto& ClassPair : ClassToComponents)
+	{
+		auto& Entries = ClassPair.Value;
+		for (int i = Entries.Num() - 1; i >= 0; i--)
+		{
+			auto Comp = Entries[i].Component.Get();
+			auto RangePtr = Comp != nullptr ? ActorRanges.Find(Comp->GetOwner()) : nullptr;
+			if (RangePtr == nullptr)
+			{
+				Entries.RemoveAt(i, 1, false);
+				continue;
+			}
+			Entries[i].Order = RangePtr->Start;
+		}
+		Entries.StableSort([](const FComponentEntry& A, const FComponentEntry& B) { return A.Order < B.Order; });
+	}
+}
+bool FLGUIHierarchyComponentIndex::Collect(AActor* InActor, UClass* InClass, bool InIncludeSelf, const TSet<AActor*>& InExcludeNode, bool InFirstOnly, TArray<UActorComponent*>& OutArray)const
+{
+	if (!IsIndexedClass(InClass))return false;
+	EnsureHierarchyOrder();
+	auto RangePtr = ActorRanges.Find(InActor);
+	if (RangePtr == nullptr || RangePtr->bHasUnindexedChild)return false;
+	if (InIncludeSelf && InExcludeNode.Contains(InActor))return true;
+	const int32 StartOrder = InIncludeSelf ? RangePtr->Start : RangePtr->Start + 1;
+	const int32 EndOrder = RangePtr->End;
+	if (StartOrder >= EndOrder)return true;
+	//excluded actor's hierarchy is skipped as a whole range
+	TArray<FActorRange, TInlineAllocator<8>> ExcludeRanges;
+	for (auto ExcludeActor : InExcludeNode)
+	{
+		if (auto ExcludeRangePtr = ActorRanges.Find(ExcludeActor))
+		{
+			if (ExcludeRangePtr->Start > RangePtr->Start && ExcludeRangePtr->Start < EndOrder)
+			{
+				ExcludeRanges.Add(*ExcludeRangePtr);
+			}
+		}
+	}
+	//each class is in hierarchy order, merge them if more than one class is found
+	TArray<FComponentEntry, TInlineAllocator<16>> FoundEntries;
+	int32 FoundClassCount = 0;
+	for (auto& ClassPair : ClassToComponents)
+	{
+		auto Class = ClassPair.Key.Get();
+		if (Class == nullptr || !Class->IsChildOf(InClass))continue;
+		auto& Entries = ClassPair.Value;
+		bool bFoundInClass = false;
+		auto GetOrder = [](const FComponentEntry& Item) { return Item.Order; };
+		for (int i = Algo::LowerBoundBy(Entries, StartOrder, GetOrder); i < Entries.Num() && Entries[i].Order < EndOrder;)
+		{
+			auto& Entry = Entries[i];
+			auto ExcludeRangePtr = ExcludeRanges.FindByPredicate([&Entry](const FActorRange& Range) { return Entry.Order >= Range.Start && Entry.Order < Range.End; });
+			if (ExcludeRangePtr != nullptr)
+			{
+				i = Algo::LowerBoundBy(Entries, ExcludeRangePtr->End, GetOrder);
+				continue;
+			}
+			auto Comp = Entry.Component.Get();
+			if (IsValid(Comp))
+			{
+				bFoundInClass = true;
+				if (InFirstOnly)
+				{
+					//nearest of this class, compare with other classes
+					if (FoundEntries.Num() == 0)
+					{
+						FoundEntries.Add(Entry);
+					}
+					else if (Entry.Order < FoundEntries[0].Order)
+					{
+						FoundEntries[0] = Entry;
+					}
+					break;
+				}
+				FoundEntries.Add(Entry);
+			}
+			i++;
+		}
+		if (bFoundInClass)
+		{
+			FoundClassCount++;
+		}
+	}
+	if (FoundClassCount > 1)
+	{
+		FoundEntries.StableSort([](const FComponentEntry& A, const FComponentEntry& B) { return A.Order < B.Order; });
+	}
+	OutArray.Reserve(OutArray.Num() + FoundEntries.Num());
+	for (auto& Entry : FoundEntries)
+	{
+		OutArray.Add(Entry.Component.Get());
+	}
+	return true;
+}
+
+int32 ULGUIManagerWorldSubsystem::HierarchyComponentIndexCount = 0;
+void ULGUIManagerWorldSubsystem::EnableHierarchyComponentIndex(AActor* InRootActor)
+{
+	if (!IsValid(InRootActor))return;
+	if (auto Instance = GetInstance(InRootActor->GetWorld()))
+	{
+		if (Instance->HierarchyComponentIndexMap.Contains(InRootActor))return;
+		auto& Index = Instance->HierarchyComponentIndexMap.Add(InRootActor);
+		Index.RootActor = InRootActor;
+		Index.Rebuild();
+		HierarchyComponentIndexCount++;
+	}
+}
+void ULGUIManagerWorldSubsystem::DisableHierarchyComponentIndex(AActor* InRootActor)
+{
+	if (InRootActor == nullptr)return;
+	if (auto Instance = GetInstance(InRootActor->GetWorld()))
+	{
+		if (Instance->HierarchyComponentIndexMap.Remove(InRootActor) > 0)
+		{
+			HierarchyComponentIndexCount--;
+		}
+	}
+}
+void ULGUIManagerWorldSubsystem::RefreshHierarchyComponentIndex(AActor* InRootActor)
+{
+	if (InRootActor == nullptr)return;
+	if (auto Instance = GetInstance(InRootActor->GetWorld()))
+	{
+		if (auto IndexPtr = Instance->HierarchyComponentIndexMap.Find(InRootActor))
+		{
+			IndexPtr->Rebuild();
+		}
+	}
+}
+const FLGUIHierarchyComponentIndex* ULGUIManagerWorldSubsystem::FindHierarchyComponentIndex(AActor* InActor)
+{
+	if (HierarchyComponentIndexCount <= 0 || InActor == nullptr)return nullptr;
+	if (auto Instance = GetInstance(InActor->GetWorld()))
+	{
+		for (auto& Pair : Instance->HierarchyComponentIndexMap)
+		{
+			if (Pair.Value.Contains(InActor))
+			{
+				return &Pair.Value;
+			}
+		}
+	}
+	return nullptr;
+}
+void ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexAttachmentChanged(AActor* InActor)
+{
+	if (HierarchyComponentIndexCount <= 0 || InActor == nullptr)return;
+	if (auto Instance = GetInstance(InActor->GetWorld()))
+	{
+		for (auto& Pair : Instance->HierarchyComponentIndexMap)
+		{
+			auto& Index = Pair.Value;
+			bool bWasIndexed = Index.Contains(InActor);
+			bool bIsInHierarchy = Index.IsInHierarchy(InActor);
+			if (bWasIndexed && !bIsInHierarchy)
+			{
+				Index.RemoveActorRecursive(InActor);
+			}
+			else if (!bWasIndexed && bIsInHierarchy)
+			{
+				Index.AddActorRecursive(InActor);
+			}
+		}
+	}
+}
+void ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexRegisterChanged(UActorComponent* InComp, bool InRegistered)
+{
+	if (HierarchyComponentIndexCount <= 0)return;
+	auto Owner = InComp->GetOwner();
+	if (Owner == nullptr)return;
+	if (auto Instance = GetInstance(InComp->GetWorld()))
+	{
+		const bool bIsRootComponent = Owner->GetRootComponent() == InComp;
+		for (auto& Pair : Instance->HierarchyComponentIndexMap)
+		{
+			auto& Index = Pair.Value;
+			if (bIsRootComponent)
+			{
+				if (InRegistered)
+				{
+					if (Index.IsInHierarchy(Owner))
+					{
+						Index.AddActor(Owner);
+					}
+				}
+				else
+				{
+					Index.RemoveActor(Owner);
+				}
+			}
+			else
+			{
+				if (InRegistered)
+				{
+					Index.AddComponent(InComp);
+				}
+				else
+				{
+					Index.RemoveComponent(InComp);
+				}
+			}
+		}
+		//root actor destroyed, remove the whole index
+		if (bIsRootComponent && !InRegistered && Owner->IsActorBeingDestroyed())
+		{
+			if (Instance->HierarchyComponentIndexMap.Remove(Owner) > 0)
+			{
+				HierarchyComponentIndexCount--;
+			}
+		}
+	}
+}
+void ULGUIManagerWorldSubsystem::NotifyHierarchyComponentIndexChildrenChanged(AActor* InActor)
+{
+	if (HierarchyComponentIndexCount <= 0 || InActor == nullptr)return;
+	if (auto Instance = GetInstance(InActor->GetWorld()))
+	{
+		for (auto& Pair : Instance->HierarchyComponentIndexMap)
+		{
+			if (Pair.Value.Contains(InActor))
+			{
+				Pair.Value.bHierarchyOrderDirty = true;//collect ActorRange::bHasUnindexedChild again
+			}
+		}
+	}
+}
+#pragma endregion HierarchyComponentIndex
+
 ULGUIManagerWorldSubsystem* ULGUIManagerWorldSubsystem::GetInstance(UWorld* InWorld)
 {
 	if (FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(InWorld))
@@ -1007,6 +1406,13 @@ bool ULGUIManagerWorldSubsystem::bIsPlaying = false;
 #endif
 
 DECLARE_CYCLE_STAT(TEXT("LGUILifeCycleBehaviour Update"), STAT_LGUILifeCycleBehaviourUpdate, STATGROUP_LGUI);
+DECLARE_CYCLE_STAT(TEXT("LGUILifeCycleBehaviour Update EveryFrame"), STAT_LGUILifeCycleBehaviourUpdate_EveryFrame, STATGROUP_LGUI);
+DECLARE_CYCLE_STAT(TEXT("LGUILifeCycleBehaviour Update EveryNFrames"), STAT_LGUILifeCycleBehaviourUpdate_EveryNFrames, STATGROUP_LGUI);
+DECLARE_CYCLE_STAT(TEXT("LGUILifeCycleBehaviour Update TimeSliced"), STAT_LGUILifeCycleBehaviourUpdate_TimeSliced, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LGUILifeCycleBehaviour Count EveryFrame"), STAT_LGUILifeCycleBehaviourCount_EveryFrame, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LGUILifeCycleBehaviour Count EveryNFrames"), STAT_LGUILifeCycleBehaviourCount_EveryNFrames, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LGUILifeCycleBehaviour Count TimeSliced"), STAT_LGUILifeCycleBehaviourCount_TimeSliced, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LGUILifeCycleBehaviour Updated TimeSliced"), STAT_LGUILifeCycleBehaviourUpdated_TimeSliced, STATGROUP_LGUI);
 DECLARE_CYCLE_STAT(TEXT("LGUILifeCycleBehaviour Start"), STAT_LGUILifeCycleBehaviourStart, STATGROUP_LGUI);
 DECLARE_CYCLE_STAT(TEXT("UpdateLayoutInterface"), STAT_UpdateLayoutInterface, STATGROUP_LGUI);
 DECLARE_CYCLE_STAT(TEXT("Canvas Update"), STAT_UpdateCanvas, STATGROUP_LGUI);
@@ -1087,7 +1493,7 @@ void ULGUIManagerWorldSubsystem::Tick(float DeltaTime)
 					if (item->bCanExecuteUpdate && !item->bIsAddedToUpdate)
 					{
 						item->bIsAddedToUpdate = true;
-						LGUILifeCycleBehavioursForUpdate.Add(item);
+						AddLGUILifeCycleBehaviourToUpdateBucket(item.Get());
 					}
 				}
 			}
@@ -1097,55 +1503,9 @@ void ULGUIManagerWorldSubsystem::Tick(float DeltaTime)
 	}
 
 	//LGUILifeCycleBehaviour update
-	{
-		bIsExecutingUpdate = true;
-		auto bIsGamePaused = GetWorld()->IsPaused();
-		auto Settings = GetDefault<ULGUISettings>();
-		SCOPE_CYCLE_COUNTER(STAT_LGUILifeCycleBehaviourUpdate);
-		for (int i = 0; i < LGUILifeCycleBehavioursForUpdate.Num(); i++)
-		{
-			CurrentExecutingUpdateIndex = i;
-			auto item = LGUILifeCycleBehavioursForUpdate[i];
-			if (item.IsValid())
-			{
-				if (item->GetRootSceneComponent() && item->GetRootSceneComponent()->IsA(UUIItem::StaticClass()))
-				{
-					auto uiItem = (UUIItem*)item->GetRootSceneComponent();
-					bool bAffectByGamePause;
-					if (uiItem->IsScreenSpaceOverlayUI())
-					{
-						bAffectByGamePause = Settings->bScreenSpaceUIAffectByGamePause;
-					}
-					else
-					{
-						bAffectByGamePause = Settings->bWorldSpaceUIAffectByGamePause;
-					}
-					if (!bIsGamePaused || (bIsGamePaused && !bAffectByGamePause))
-					{
-						item->Update(DeltaTime);
-					}
-				}
-				else
-				{
-					if (!bIsGamePaused || (bIsGamePaused && item->PrimaryComponentTick.bTickEvenWhenPaused))
-					{
-						item->Update(DeltaTime);
-					}
-				}
-			}
-		}
-		bIsExecutingUpdate = false;
-		CurrentExecutingUpdateIndex = -1;
-		//remove these padding things
-		if (LGUILifeCycleBehavioursNeedToRemoveFromUpdate.Num() > 0)
-		{
-			for (auto& item : LGUILifeCycleBehavioursNeedToRemoveFromUpdate)
-			{
-				LGUILifeCycleBehavioursForUpdate.Remove(item);
-			}
-			LGUILifeCycleBehavioursNeedToRemoveFromUpdate.Reset();
-		}
-	}
+	UpdateLGUILifeCycleBehaviours(DeltaTime);
+	//LGUIPlayTween update
+	PlayTweenDriver.Update(GetWorld());
 
 #if WITH_EDITOR
 	int ScreenSpaceOverlayCanvasCount = 0;
@@ -1180,7 +1540,12 @@ void ULGUIManagerWorldSubsystem::Tick(float DeltaTime)
 	}
 #endif
 
+	ResolvePendingViewportResize();//canvas size may change, so do it before resolve anchor
+	ResolveDeferredHierarchyChange();
 	UpdateLayout();
+	ResolveDeferredHierarchyChange();//layout may change anchor again
+	ResolveDeferredCanvasGroupAlphaChange();
+	DrawScheduledUIWidgets();
 
 	//update drawcall
 	{
@@ -1198,6 +1563,7 @@ void ULGUIManagerWorldSubsystem::Tick(float DeltaTime)
 		UpdateCanvas(WorldSpaceUECanvasArray);
 		UpdateCanvas(WorldSpaceLGUICanvasArray);
 		UpdateCanvas(RenderTargetSpaceLGUICanvasArray);
+		ULGUIProceduralRectData::FlushAllPendingUpdate();//upload procedural rect data changed by canvas update
 	}
 
 	//sort render order
@@ -1304,10 +1670,9 @@ void ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehavioursForUpdate(ULGUILifeCy
 	{
 		if (auto Instance = GetInstance(InComp->GetWorld()))
 		{
-			int32 index = INDEX_NONE;
-			if (!Instance->LGUILifeCycleBehavioursForUpdate.Find(InComp, index))
+			if (InComp->UpdateEntryIndex == INDEX_NONE)
 			{
-				Instance->LGUILifeCycleBehavioursForUpdate.Add(InComp);
+				Instance->AddLGUILifeCycleBehaviourToUpdateBucket(InComp);
 				return;
 			}
 			UE_LOG(LGUI, Warning, TEXT("[ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehavioursForUpdate]Already exist, comp:%s"), *(InComp->GetPathName()));
@@ -1320,44 +1685,252 @@ void ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehavioursFromUpdate(ULGUILi
 	{
 		if (auto Instance = GetInstance(InComp->GetWorld()))
 		{
-			auto& updateArray = Instance->LGUILifeCycleBehavioursForUpdate;
-			int32 index = INDEX_NONE;
-			if (updateArray.Find(InComp, index))
+			if (InComp->UpdateEntryIndex != INDEX_NONE)
 			{
-				if (Instance->bIsExecutingUpdate)
-				{
-					if (index > Instance->CurrentExecutingUpdateIndex)//not execute it yet, safe to remove
-					{
-						updateArray.RemoveAt(index);
-					}
-					else//already execute or current execute it, not safe to remove. should remove it after execute process complete
-					{
-						Instance->LGUILifeCycleBehavioursNeedToRemoveFromUpdate.Add(InComp);
-					}
-				}
-				else//not executing update, safe to remove
-				{
-					updateArray.RemoveAt(index);
-				}
+				Instance->RemoveLGUILifeCycleBehaviourFromUpdateBucket(InComp);
 			}
 			else
 			{
 				UE_LOG(LGUI, Warning, TEXT("[ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehavioursFromUpdate]Not exist, comp:%s"), *(InComp->GetPathName()));
 			}
+		}
+	}
+}
+void ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehaviourToUpdateBucket(ULGUILifeCycleBehaviour* InComp)
+{
+	//classify when add, so no need to check these every frame
+	auto UpdateRate = InComp->UpdateRate;
+	auto& Bucket = LGUILifeCycleBehaviourUpdateBuckets[(int32)UpdateRate];
+	FLGUILifeCycleBehaviourUpdateEntry Entry;
+	Entry.Behaviour = InComp;
+	Entry.RootComponent = InComp->GetRootSceneComponent();
+	Entry.bRootIsUIItem = Cast<UUIItem>(Entry.RootComponent.Get()) != nullptr;
+	Entry.FrameInterval = FMath::Max(1, InComp->UpdateFrameInterval);
+	Entry.NextUpdateFrame = LGUILifeCycleBehaviourUpdateFrame + 1 + Bucket.Entries.Num() % Entry.FrameInterval;//spread to different frames
+	Entry.LastUpdateTime = LGUILifeCycleBehaviourUpdateTime;
+	InComp->UpdateBucket = UpdateRate;
+	InComp->UpdateEntryIndex = Bucket.Entries.Add(Entry);
+}
+void ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehaviourFromUpdateBucket(ULGUILifeCycleBehaviour* InComp)
+{
+	auto& Bucket = LGUILifeCycleBehaviourUpdateBuckets[(int32)InComp->UpdateBucket];
+	auto Index = InComp->UpdateEntryIndex;
+	InComp->UpdateEntryIndex = INDEX_NONE;
+	if (bIsExecutingUpdate)//not safe to change array when executing, mark it and cleanup after execute process complete
+	{
+		auto& Entry = Bucket.Entries[Index];
+		Entry.Behaviour = nullptr;
+		Entry.bPendingRemove = true;
+		Bucket.PendingRemoveIndices.Add(Index);
+	}
+	else
+	{
+		Bucket.Entries.RemoveAtSwap(Index);
+		if (Index < Bucket.Entries.Num())//the last one is moved to Index
+		{
+			if (auto MovedComp = Bucket.Entries[Index].Behaviour.Get())
+			{
+				MovedComp->UpdateEntryIndex = Index;
+			}
+		}
+	}
+}
 
-			//cleanup array
-			int inValidCount = 0;
-			for (int i = updateArray.Num() - 1; i >= 0; i--)
+static TAutoConsoleVariable<float> CVarLGUILifeCycleBehaviourTimeSlicedUpdateBudget(
+	TEXT("lgui.LifeCycleBehaviour.TimeSlicedUpdateBudget"),
+	0.5f,
+	TEXT("Time budget in milliseconds for LGUILifeCycleBehaviour with TimeSliced UpdateRate, at least one behaviour is updated in a frame."),
+	ECVF_Default
+);
+void ULGUIManagerWorldSubsystem::UpdateLGUILifeCycleBehaviours(float DeltaTime)
+{
+	static_assert(LGUILifeCycleBehaviourUpdateBucketCount == (int32)ELGUILifeCycleBehaviourUpdateRate::Count, "bucket count must match ELGUILifeCycleBehaviourUpdateRate");
+	SCOPE_CYCLE_COUNTER(STAT_LGUILifeCycleBehaviourUpdate);
+	bIsExecutingUpdate = true;
+	LGUILifeCycleBehaviourUpdateTime += DeltaTime;
+	LGUILifeCycleBehaviourUpdateFrame++;
+	const bool bIsGamePaused = GetWorld()->IsPaused();
+	auto Settings = GetDefault<ULGUISettings>();
+
+	auto ExecuteUpdate = [this, bIsGamePaused, Settings](FLGUILifeCycleBehaviourUpdateBucket& Bucket, int32 Index, float ItemDeltaTime) {
+		auto& Entry = Bucket.Entries[Index];
+		auto Item = Entry.Behaviour.Get();
+		if (Item == nullptr)
+		{
+			if (!Entry.bPendingRemove)//destroyed without remove from update
+			{
+				Entry.bPendingRemove = true;
+				Bucket.PendingRemoveIndices.Add(Index);
+			}
+			return;
+		}
+		if (bIsGamePaused)//only need to check these when paused
+		{
+			bool bAffectByGamePause;
+			auto RootComponent = Item->GetRootSceneComponent();
+			if (Entry.RootComponent.Get() != RootComponent)//root component changed (reattach or destroyed), classify again
 			{
-				if (!updateArray[i].IsValid())
+				Entry.RootComponent = RootComponent;
+				Entry.bRootIsUIItem = Cast<UUIItem>(RootComponent) != nullptr;
+			}
+			auto RootUIItem = Entry.bRootIsUIItem ? (UUIItem*)RootComponent : nullptr;
+			if (RootUIItem != nullptr)
+			{
+				bAffectByGamePause = RootUIItem->IsScreenSpaceOverlayUI() ? Settings->bScreenSpaceUIAffectByGamePause : Settings->bWorldSpaceUIAffectByGamePause;
+			}
+			else
+			{
+				bAffectByGamePause = !Item->PrimaryComponentTick.bTickEvenWhenPaused;
+			}
+			if (bAffectByGamePause)
+			{
+				Entry.LastUpdateTime = LGUILifeCycleBehaviourUpdateTime;
+				return;
+			}
+		}
+		Entry.LastUpdateTime = LGUILifeCycleBehaviourUpdateTime;
+		Item->Update(ItemDeltaTime);
+	};
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_LGUILifeCycleBehaviourUpdate_EveryFrame);
+		auto& Bucket = LGUILifeCycleBehaviourUpdateBuckets[(int32)ELGUILifeCycleBehaviourUpdateRate::EveryFrame];
+		SET_DWORD_STAT(STAT_LGUILifeCycleBehaviourCount_EveryFrame, Bucket.Entries.Num());
+		for (int i = 0; i < Bucket.Entries.Num(); i++)
+		{
+			ExecuteUpdate(Bucket, i, DeltaTime);
+		}
+	}
+	{
+		SCOPE_CYCLE_COUNTER(STAT_LGUILifeCycleBehaviourUpdate_EveryNFrames);
+		auto& Bucket = LGUILifeCycleBehaviourUpdateBuckets[(int32)ELGUILifeCycleBehaviourUpdateRate::EveryNFrames];
+		SET_DWORD_STAT(STAT_LGUILifeCycleBehaviourCount_EveryNFrames, Bucket.Entries.Num());
+		for (int i = 0; i < Bucket.Entries.Num(); i++)
+		{
+			auto& Entry = Bucket.Entries[i];
+			if (Entry.NextUpdateFrame > LGUILifeCycleBehaviourUpdateFrame)continue;
+			Entry.NextUpdateFrame = LGUILifeCycleBehaviourUpdateFrame + Entry.FrameInterval;
+			ExecuteUpdate(Bucket, i, (float)(LGUILifeCycleBehaviourUpdateTime - Entry.LastUpdateTime));
+		}
+	}
+	{
+		SCOPE_CYCLE_COUNTER(STAT_LGUILifeCycleBehaviourUpdate_TimeSliced);
+		auto& Bucket = LGUILifeCycleBehaviourUpdateBuckets[(int32)ELGUILifeCycleBehaviourUpdateRate::TimeSliced];
+		const int32 Count = Bucket.Entries.Num();//added during update will execute in next frame
+		SET_DWORD_STAT(STAT_LGUILifeCycleBehaviourCount_TimeSliced, Count);
+		int32 UpdatedCount = 0;
+		if (Count > 0)
+		{
+			const double BudgetSeconds = CVarLGUILifeCycleBehaviourTimeSlicedUpdateBudget.GetValueOnGameThread() * 0.001;
+			const double StartTime = FPlatformTime::Seconds();
+			if (Bucket.Cursor >= Count)
+			{
+				Bucket.Cursor = 0;
+			}
+			while (UpdatedCount < Count)
+			{
+				auto Index = Bucket.Cursor;
+				Bucket.Cursor = (Bucket.Cursor + 1) % Count;
+				ExecuteUpdate(Bucket, Index, (float)(LGUILifeCycleBehaviourUpdateTime - Bucket.Entries[Index].LastUpdateTime));
+				UpdatedCount++;
+				if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)break;
+			}
+		}
+		SET_DWORD_STAT(STAT_LGUILifeCycleBehaviourUpdated_TimeSliced, UpdatedCount);
+	}
+	bIsExecutingUpdate = false;
+
+	//remove these padding things, from back to front so swap will not move pending items
+	for (auto& Bucket : LGUILifeCycleBehaviourUpdateBuckets)
+	{
+		if (Bucket.PendingRemoveIndices.Num() == 0)continue;
+		Bucket.PendingRemoveIndices.Sort([](const int32& A, const int32& B) { return A > B; });
+		for (auto Index : Bucket.PendingRemoveIndices)
+		{
+			Bucket.Entries.RemoveAtSwap(Index);
+			if (Index < Bucket.Entries.Num())
+			{
+				if (auto MovedComp = Bucket.Entries[Index].Behaviour.Get())
 				{
-					updateArray.RemoveAt(i);
-					inValidCount++;
+					MovedComp->UpdateEntryIndex = Index;
 				}
 			}
-			if (inValidCount > 0)
+		}
+		Bucket.PendingRemoveIndices.Reset();
+	}
+}
+
+bool ULGUIManagerWorldSubsystem::AddRootComponentRenderStateListener(USceneComponent* InRootComp, ULGUILifeCycleBehaviour* InComp)
+{
+	if (IsValid(InRootComp) && IsValid(InComp))
+	{
+		if (auto Instance = GetInstance(InComp->GetWorld()))
+		{
+			auto& ListenerArray = Instance->RootComponentRenderStateListenerMap.FindOrAdd(InRootComp);
+			ListenerArray.AddUnique(InComp);
+			if (!Instance->ComponentRenderStateDirtyDelegateHandle.IsValid())//only one global listener for all behaviours
+			{
+				Instance->ComponentRenderStateDirtyDelegateHandle = UActorComponent::MarkRenderStateDirtyEvent.AddUObject(Instance, &ULGUIManagerWorldSubsystem::OnComponentRenderStateDirty);
+			}
+			return true;
+		}
+	}
+	return false;
+}
+void ULGUIManagerWorldSubsystem::RemoveRootComponentRenderStateListener(USceneComponent* InRootComp, ULGUILifeCycleBehaviour* InComp)
+{
+	if (IsValid(InComp))
+	{
+		if (auto Instance = GetInstance(InComp->GetWorld()))
+		{
+			auto& ListenerMap = Instance->RootComponentRenderStateListenerMap;
+			if (InRootComp != nullptr)
+			{
+				if (auto ListenerArrayPtr = ListenerMap.Find(InRootComp))
+				{
+					ListenerArrayPtr->RemoveSwap(InComp);
+					if (ListenerArrayPtr->Num() == 0)
+					{
+						ListenerMap.Remove(InRootComp);
+					}
+				}
+			}
+			else//root component is destroyed, cleanup all invalid
+			{
+				for (auto Itr = ListenerMap.CreateIterator(); Itr; ++Itr)
+				{
+					Itr->Value.RemoveSwap(InComp);
+					if (!Itr->Key.IsValid() || Itr->Value.Num() == 0)
+					{
+						Itr.RemoveCurrent();
+					}
+				}
+			}
+			if (ListenerMap.Num() == 0 && Instance->ComponentRenderStateDirtyDelegateHandle.IsValid())
 			{
-				UE_LOG(LGUI, Warning, TEXT("[ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehavioursFromUpdate]Cleanup %d invalid LGUILifeCycleBehaviour"), inValidCount);
+				UActorComponent::MarkRenderStateDirtyEvent.Remove(Instance->ComponentRenderStateDirtyDelegateHandle);
+				Instance->ComponentRenderStateDirtyDelegateHandle.Reset();
+			}
+		}
+	}
+}
+DECLARE_CYCLE_STAT(TEXT("LGUILifeCycleBehaviour RenderStateDirty Dispatch"), STAT_LGUILifeCycleBehaviourRenderStateDirtyDispatch, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LGUILifeCycleBehaviour RenderStateDirty Received"), STAT_LGUILifeCycleBehaviourRenderStateDirtyReceived, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LGUILifeCycleBehaviour RenderStateDirty Delivered"), STAT_LGUILifeCycleBehaviourRenderStateDirtyDelivered, STATGROUP_LGUI);
+void ULGUIManagerWorldSubsystem::OnComponentRenderStateDirty(UActorComponent& InComp)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LGUILifeCycleBehaviourRenderStateDirtyDispatch);
+	INC_DWORD_STAT(STAT_LGUILifeCycleBehaviourRenderStateDirtyReceived);
+	if (auto ListenerArrayPtr = RootComponentRenderStateListenerMap.Find(&InComp))
+	{
+		//copy, because callback may add or remove listener
+		TArray<TWeakObjectPtr<ULGUILifeCycleBehaviour>, TInlineAllocator<8>> ListenerArray(*ListenerArrayPtr);
+		INC_DWORD_STAT_BY(STAT_LGUILifeCycleBehaviourRenderStateDirtyDelivered, ListenerArray.Num());
+		for (auto& Item : ListenerArray)
+		{
+			if (Item.IsValid())
+			{
+				Item->OnComponentRenderStateDirty(InComp);
 			}
 		}
 	}
@@ -1439,6 +2012,275 @@ void ULGUIManagerWorldSubsystem::UnregisterLGUICultureChangedEvent(TScriptInterf
 	}
 }
 
+DECLARE_CYCLE_STAT(TEXT("UIItem ResolveDeferredHierarchyChange"), STAT_ResolveDeferredHierarchyChange, STATGROUP_LGUI);
+void ULGUIManagerWorldSubsystem::AddDeferredHierarchyChangeUIItem(UUIItem* InItem)
+{
+	DeferredHierarchyChangeUIItemArray.Add(InItem);
+}
+void ULGUIManagerWorldSubsystem::ResolveDeferredHierarchyChange()
+{
+	if (DeferredHierarchyChangeUIItemArray.Num() == 0)return;
+	SCOPE_CYCLE_COUNTER(STAT_ResolveDeferredHierarchyChange);
+
+	//take the cached buffer, so a nested resolve (eg. from lifecycle callback) will use it's own array
+	auto SortedItemArray = MoveTemp(DeferredHierarchyChangeSortedArray);
+	const int32 MaxResolveCount = 8;//lifecycle callback may change anchor again, so loop until nothing left, and prevent infinite loop
+	int32 ResolveCount = 0;
+	while (DeferredHierarchyChangeUIItemArray.Num() > 0 && ResolveCount < MaxResolveCount)
+	{
+		ResolveCount++;
+		SortedItemArray.Reset();
+		for (auto& Item : DeferredHierarchyChangeUIItemArray)
+		{
+			if (Item.IsValid() && Item->bDeferredChangeRegistered)
+			{
+				int32 Depth = 0;
+				for (auto Parent = Item->GetParentUIItem(); Parent != nullptr; Parent = Parent->GetParentUIItem())
+				{
+					Depth++;
+				}
+				SortedItemArray.Add(TPair<int32, UUIItem*>(Depth, Item.Get()));
+			}
+		}
+		DeferredHierarchyChangeUIItemArray.Reset();
+		//parent first, so child's recorded change is merged into parent's pass
+		SortedItemArray.StableSort([](const TPair<int32, UUIItem*>& A, const TPair<int32, UUIItem*>& B) {
+			return A.Key < B.Key;
+			});
+		for (auto& Pair : SortedItemArray)
+		{
+			if (Pair.Value->bDeferredChangeRegistered)//could be already resolved by parent
+			{
+				Pair.Value->ResolveDeferredHierarchyChange(false, false, false, false, false);
+			}
+		}
+	}
+	if (DeferredHierarchyChangeUIItemArray.Num() > 0)
+	{
+		UE_LOG(LGUI, Warning, TEXT("[%s].%d Anchor/transform change still exist after resolve %d times, maybe UIItem's change is triggered by it's own dimensions changed callback. Rest will be resolved in next frame."), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, MaxResolveCount);
+	}
+	SortedItemArray.Reset();
+	DeferredHierarchyChangeSortedArray = MoveTemp(SortedItemArray);
+}
+
+DECLARE_CYCLE_STAT(TEXT("UICanvasGroup ResolveDeferredAlphaChange"), STAT_ResolveDeferredCanvasGroupAlphaChange, STATGROUP_LGUI);
+void ULGUIManagerWorldSubsystem::AddDeferredAlphaChangeCanvasGroup(UUICanvasGroup* InCanvasGroup)
+{
+	DeferredAlphaChangeCanvasGroupArray.Add(InCanvasGroup);
+}
+void ULGUIManagerWorldSubsystem::ResolveDeferredCanvasGroupAlphaChange()
+{
+	if (DeferredAlphaChangeCanvasGroupArray.Num() == 0)return;
+	SCOPE_CYCLE_COUNTER(STAT_ResolveDeferredCanvasGroupAlphaChange);
+	//notify go down from each CanvasGroup, a child CanvasGroup that already notified by parent will not broadcast again because final alpha not change
+	for (int i = 0; i < DeferredAlphaChangeCanvasGroupArray.Num(); i++)
+	{
+		auto& Item = DeferredAlphaChangeCanvasGroupArray[i];
+		if (Item.IsValid() && Item->bIsAlphaChangeDeferred)
+		{
+			Item->NotifyAlphaChange(true);
+		}
+	}
+	DeferredAlphaChangeCanvasGroupArray.Reset();
+}
+
+void ULGUIManagerWorldSubsystem::AddPendingViewportResizeCanvasScaler(ULGUICanvasScaler* InCanvasScaler)
+{
+	PendingViewportResizeCanvasScalerArray.Add(InCanvasScaler);
+}
+void ULGUIManagerWorldSubsystem::ResolvePendingViewportResize()
+{
+	if (PendingViewportResizeCanvasScalerArray.Num() == 0)return;
+	for (int i = 0; i < PendingViewportResizeCanvasScalerArray.Num(); i++)
+	{
+		auto& Item = PendingViewportResizeCanvasScalerArray[i];
+		if (Item.IsValid() && Item->bIsViewportResizePending)
+		{
+			Item->ApplyPendingViewportResize();
+		}
+	}
+	PendingViewportResizeCanvasScalerArray.Reset();
+}
+
+static TAutoConsoleVariable<int32> CVarLGUIUIWidgetMaxRedrawPerFrame(
+	TEXT("lgui.UIWidget.MaxRedrawPerFrame"),
+	0,
+	TEXT("Max count of UIWidget that can redraw render target in a single frame. Widgets that exceed the budget will wait to next frames, bigger on screen and longer waited widget is drawn first. 0 means no limit, every UIWidget draw itself when tick."),
+	ECVF_Default);
+
+DECLARE_CYCLE_STAT(TEXT("UIWidget DrawScheduled"), STAT_DrawScheduledUIWidgets, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UIWidget Redraw Requested"), STAT_UIWidgetRedrawRequested, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UIWidget Redraw Drawn"), STAT_UIWidgetRedrawDrawn, STATGROUP_LGUI);
+bool ULGUIManagerWorldSubsystem::IsUIWidgetRedrawScheduled(UWorld* InWorld)
+{
+	return CVarLGUIUIWidgetMaxRedrawPerFrame.GetValueOnGameThread() > 0 && InWorld != nullptr && InWorld->IsGameWorld();
+}
+void ULGUIManagerWorldSubsystem::AddUIWidgetRedrawRequest(UUIWidget* InWidget)
+{
+	UIWidgetRedrawRequestArray.AddUnique(InWidget);
+}
+namespace LGUIUIWidgetRedrawScheduler
+{
+	struct FRedrawRequest
+	{
+		UUIWidget* Widget;
+		float Priority;
+	};
+	/** Put requests that should draw this frame at front (bigger priority first), return count of them. */
+	template<typename RequestType, typename AllocatorType>
+	static int32 SelectRedraw(TArray<RequestType, AllocatorType>& InOutRequests, int32 InMaxRedrawCount)
+	{
+		InMaxRedrawCount = FMath::Max(InMaxRedrawCount, 1);
+		if (InOutRequests.Num() > InMaxRedrawCount)
+		{
+			InOutRequests.Sort([](const RequestType& A, const RequestType& B) {
+				return A.Priority > B.Priority;
+				});
+		}
+		return FMath::Min(InOutRequests.Num(), InMaxRedrawCount);
+	}
+}
+void ULGUIManagerWorldSubsystem::DrawScheduledUIWidgets()
+{
+	if (UIWidgetRedrawRequestArray.Num() == 0)return;
+	SCOPE_CYCLE_COUNTER(STAT_DrawScheduledUIWidgets);
+	SET_DWORD_STAT(STAT_UIWidgetRedrawRequested, UIWidgetRedrawRequestArray.Num());
+
+	FVector ViewLocation = FVector::ZeroVector;
+	float ViewProjectionScale = 0;
+	if (auto PC = this->GetWorld()->GetFirstPlayerController())
+	{
+		if (PC->PlayerCameraManager)
+		{
+			ViewLocation = PC->PlayerCameraManager->GetCameraLocation();
+			int32 ViewportSizeX = 0, ViewportSizeY = 0;
+			PC->GetViewportSize(ViewportSizeX, ViewportSizeY);
+			auto HalfFOVTan = FMath::Tan(FMath::DegreesToRadians(PC->PlayerCameraManager->GetFOVAngle() * 0.5f));
+			if (ViewportSizeX > 0 && HalfFOVTan > KINDA_SMALL_NUMBER)
+			{
+				ViewProjectionScale = ViewportSizeX * 0.5f / HalfFOVTan;
+			}
+		}
+	}
+
+	using namespace LGUIUIWidgetRedrawScheduler;
+	TArray<FRedrawRequest, TInlineAllocator<32>> Requests;
+	for (auto& Item : UIWidgetRedrawRequestArray)
+	{
+		if (Item.IsValid())
+		{
+			Requests.Add({ Item.Get(), Item->GetScheduledRedrawPriority(ViewLocation, ViewProjectionScale) });
+		}
+	}
+	UIWidgetRedrawRequestArray.Reset();
+
+	const int32 DrawCount = SelectRedraw(Requests, CVarLGUIUIWidgetMaxRedrawPerFrame.GetValueOnGameThread());
+	for (int i = 0; i < Requests.Num(); i++)
+	{
+		if (i < DrawCount)
+		{
+			Requests[i].Widget->DrawScheduledRedraw();
+		}
+		else
+		{
+			Requests[i].Widget->ScheduledRedrawWaitFrames++;//widget will request again next frame, with higher priority
+		}
+	}
+	SET_DWORD_STAT(STAT_UIWidgetRedrawDrawn, DrawCount);
+}
+#if !UE_BUILD_SHIPPING
+/**
+ * Headless test of UIWidget redraw scheduling: simulate widgets with random screen size that request redraw every frame, verify budget and priority order of every frame's decision, and log how long widgets wait.
+ */
+struct FLGUIUIWidgetRedrawSchedulerTest
+{
+	static void Run(const TArray<FString>& Args)
+	{
+		using namespace LGUIUIWidgetRedrawScheduler;
+		const int32 WidgetCount = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 50;
+		const int32 MaxRedrawCount = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 4;
+		const int32 FrameCount = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 1) : 600;
+
+		struct FSimulatedWidget
+		{
+			float ScreenPixelArea = 0;
+			int32 WaitFrames = 0;
+			int32 MaxWaitFrames = 0;
+			int32 DrawCount = 0;
+		};
+		TArray<FSimulatedWidget> Widgets;
+		Widgets.SetNum(WidgetCount);
+		for (auto& Item : Widgets)
+		{
+			Item.ScreenPixelArea = FMath::Pow(10.0f, FMath::FRandRange(2.0f, 6.0f));//from 10x10 to 1000x1000 pixels
+		}
+
+		struct FSimulatedRequest
+		{
+			int32 WidgetIndex;
+			float Priority;
+		};
+		int32 BudgetErrorCount = 0, OrderErrorCount = 0;
+		TArray<FSimulatedRequest> Requests;
+		for (int32 Frame = 0; Frame < FrameCount; Frame++)
+		{
+			Requests.Reset();
+			for (int32 i = 0; i < WidgetCount; i++)
+			{
+				Requests.Add({ i, UUIWidget::CalculateScheduledRedrawPriority(Widgets[i].ScreenPixelArea, Widgets[i].WaitFrames) });
+			}
+			const int32 DrawCount = SelectRedraw(Requests, MaxRedrawCount);
+			if (DrawCount != FMath::Min(WidgetCount, MaxRedrawCount))
+			{
+				BudgetErrorCount++;
+			}
+			float MinDrawnPriority = MAX_flt, MaxSkippedPriority = 0;
+			for (int32 i = 0; i < Requests.Num(); i++)
+			{
+				auto& Item = Widgets[Requests[i].WidgetIndex];
+				if (i < DrawCount)
+				{
+					MinDrawnPriority = FMath::Min(MinDrawnPriority, Requests[i].Priority);
+					Item.WaitFrames = 0;
+					Item.DrawCount++;
+				}
+				else
+				{
+					MaxSkippedPriority = FMath::Max(MaxSkippedPriority, Requests[i].Priority);
+					Item.WaitFrames++;
+					Item.MaxWaitFrames = FMath::Max(Item.MaxWaitFrames, Item.WaitFrames);
+				}
+			}
+			if (MaxSkippedPriority > MinDrawnPriority)
+			{
+				OrderErrorCount++;
+			}
+		}
+
+		int32 NeverDrawnCount = 0, MaxWaitFrames = 0, SmallestWidgetMaxWaitFrames = 0;
+		float SmallestArea = MAX_flt;
+		for (auto& Item : Widgets)
+		{
+			if (Item.DrawCount == 0)NeverDrawnCount++;
+			MaxWaitFrames = FMath::Max(MaxWaitFrames, Item.MaxWaitFrames);
+			if (Item.ScreenPixelArea < SmallestArea)
+			{
+				SmallestArea = Item.ScreenPixelArea;
+				SmallestWidgetMaxWaitFrames = Item.MaxWaitFrames;
+			}
+		}
+		const bool bPass = BudgetErrorCount == 0 && OrderErrorCount == 0 && NeverDrawnCount == 0;
+		UE_LOG(LGUI, Log, TEXT("[%s] %s. %d widgets, %d redraws per frame, %d frames. Budget error frames: %d, order error frames: %d, never drawn widgets: %d, max wait frames: %d, smallest widget max wait frames: %d")
+			, ANSI_TO_TCHAR(__FUNCTION__), bPass ? TEXT("PASS") : TEXT("FAIL"), WidgetCount, MaxRedrawCount, FrameCount
+			, BudgetErrorCount, OrderErrorCount, NeverDrawnCount, MaxWaitFrames, SmallestWidgetMaxWaitFrames);
+	}
+};
+static FAutoConsoleCommand LGUIUIWidgetRedrawSchedulerTestCommand(
+	TEXT("lgui.UIWidget.RedrawSchedulerTest"),
+	TEXT("Simulate widgets request redraw every frame without world, verify budget and priority of redraw scheduling, and log wait frames. Args: [WidgetCount=50] [MaxRedrawPerFrame=4] [FrameCount=600]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FLGUIUIWidgetRedrawSchedulerTest::Run));
+#endif
+
 void ULGUIManagerWorldSubsystem::UpdateLayout()
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateLayoutInterface);
@@ -10,6 +10,23 @@
 
 #define LOCTEXT_NAMESPACE "LGUIProceduralRectData"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("ProceduralRectData Block Count"), STAT_ProceduralRectData_BlockCount, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ProceduralRectData Upload Block"), STAT_ProceduralRectData_UploadBlock, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ProceduralRectData Upload Region"), STAT_ProceduralRectData_UploadRegion, STATGROUP_LGUI);
+
+TArray<TWeakObjectPtr<ULGUIProceduralRectData>> ULGUIProceduralRectData::PendingFlushArray;
+
+namespace LGUIProceduralRectDataHelper
+{
+	struct FNotUsingPositionPredicate
+	{
+		bool operator()(const FIntVector2& A, const FIntVector2& B)const
+		{
+			return A.Y != B.Y ? A.Y < B.Y : A.X < B.X;
+		}
+	};
+}
+
 #if WITH_EDITOR
 void ULGUIProceduralRectData::PreEditChange(FProperty* PropertyAboutToChange)
 {
@@ -50,6 +67,17 @@ bool ULGUIProceduralRectData::ExpandTexture()
 	TextureSize = NewTextureSize;
 	CreateTexture();
 
+	//copy cpu side data, row pitch is changed
+	{
+		TArray<uint8> NewShadowData;
+		NewShadowData.SetNumZeroed(TextureSize * TextureSize * 4);
+		for (int h = 0; h < OldTextureSize; h++)
+		{
+			FMemory::Memcpy(NewShadowData.GetData() + h * TextureSize * 4, ShadowData.GetData() + h * OldTextureSize * 4, OldTextureSize * 4);
+		}
+		ShadowData = MoveTemp(NewShadowData);
+	}
+
 	//copy existing data
 	auto NewTexture = Texture;
 	if (OldTexture->GetResource() != nullptr && NewTexture->GetResource() != nullptr)
@@ -74,14 +102,20 @@ bool ULGUIProceduralRectData::ExpandTexture()
 	{
 		OldTexture->RemoveFromRoot();//ready for gc
 	}
-	// right top quater as not using position
+	// right top quater as not using position. old rows are filled with blocks until the remaining pixels can't fit one, so start from that block
+	int RightTopStartX = 0;
+	while (RightTopStartX + BlockPixelCount < OldTextureSize)
+	{
+		RightTopStartX += BlockPixelCount;
+	}
 	for (int h = 0; h < OldTextureSize; h += 1)
 	{
-		for (int w = CurrentPosition.X; w + BlockPixelCount < TextureSize; w += BlockPixelCount)
+		for (int w = RightTopStartX; w + BlockPixelCount < TextureSize; w += BlockPixelCount)
 		{
 			NotUsingPositionArray.Add(FIntVector2(w, h));
 		}
 	}
+	NotUsingPositionArray.Heapify(LGUIProceduralRectDataHelper::FNotUsingPositionPredicate());
 	// set start position to left bottom quater
 	CurrentPosition.X = 0;
 	CurrentPosition.Y = OldTextureSize;
@@ -105,15 +139,24 @@ void ULGUIProceduralRectData::Init(int InBlockSizeInByte)
 	{
 		TextureSize += TextureSize;
 	}
+	ShadowData.SetNumZeroed(TextureSize * TextureSize * 4);
 	CreateTexture();
 }
 
 FIntVector2 ULGUIProceduralRectData::RegisterBuffer()
+{
+	auto Pos = AllocateBlock();
+	BlockInfoMap.Add(PositionToKey(Pos)).RefCount = 1;
+	AllocatedBlockCount++;
+	INC_DWORD_STAT(STAT_ProceduralRectData_BlockCount);
+	return Pos;
+}
+FIntVector2 ULGUIProceduralRectData::AllocateBlock()
 {
 	if (NotUsingPositionArray.Num() > 0)
 	{
-		auto Pos = NotUsingPositionArray[0];
-		NotUsingPositionArray.RemoveSwap(Pos);
+		FIntVector2 Pos;
+		NotUsingPositionArray.HeapPop(Pos, LGUIProceduralRectDataHelper::FNotUsingPositionPredicate());
 		return Pos;
 	}
 	auto PrevPos = CurrentPosition;
@@ -129,8 +172,8 @@ FIntVector2 ULGUIProceduralRectData::RegisterBuffer()
 	{
 		if (ExpandTexture())
 		{
-			auto Pos = NotUsingPositionArray[0];
-			NotUsingPositionArray.RemoveSwap(Pos);
+			FIntVector2 Pos;
+			NotUsingPositionArray.HeapPop(Pos, LGUIProceduralRectDataHelper::FNotUsingPositionPredicate());
 			return Pos;
 		}
 	}
@@ -138,25 +181,203 @@ FIntVector2 ULGUIProceduralRectData::RegisterBuffer()
 }
 void ULGUIProceduralRectData::UnregisterBuffer(const FIntVector2& InPosition)
 {
-	NotUsingPositionArray.Add(InPosition);
+	ReleaseBlock(InPosition);
+}
+void ULGUIProceduralRectData::ReleaseBlock(const FIntVector2& InPosition)
+{
+	auto Key = PositionToKey(InPosition);
+	auto BlockInfoPtr = BlockInfoMap.Find(Key);
+	if (!ensure(BlockInfoPtr != nullptr))
+	{
+		return;
+	}
+	BlockInfoPtr->RefCount--;
+	if (BlockInfoPtr->RefCount > 0)
+	{
+		return;
+	}
+	if (BlockInfoPtr->bHasHash)
+	{
+		HashToBlockMap.RemoveSingle(BlockInfoPtr->Hash, Key);
+	}
+	BlockInfoMap.Remove(Key);
+	NotUsingPositionArray.HeapPush(InPosition, LGUIProceduralRectDataHelper::FNotUsingPositionPredicate());
+	DEC_DWORD_STAT(STAT_ProceduralRectData_BlockCount);
+}
+void ULGUIProceduralRectData::WriteBlock(const FIntVector2& InPosition, const uint8* InData)
+{
+	auto ShadowBlock = GetShadowBlock(InPosition);
+	if (FMemory::Memcmp(ShadowBlock, InData, BlockSizeInByte) == 0)
+	{
+		return;
+	}
+	FMemory::Memcpy(ShadowBlock, InData, BlockSizeInByte);
+	UploadBlockCount++;
+	INC_DWORD_STAT(STAT_ProceduralRectData_UploadBlock);
+
+	auto& RowRange = DirtyRowRangeMap.FindOrAdd(InPosition.Y, FIntPoint(MAX_int32, MIN_int32));
+	RowRange.X = FMath::Min(RowRange.X, InPosition.X);
+	RowRange.Y = FMath::Max(RowRange.Y, InPosition.X + BlockPixelCount - 1);
+	if (!bIsPendingFlush)
+	{
+		bIsPendingFlush = true;
+		PendingFlushArray.Add(this);
+	}
+}
+void ULGUIProceduralRectData::UpdateBlock(const FIntVector2& InPosition, const uint8* InData)
+{
+	auto BlockInfoPtr = BlockInfoMap.Find(PositionToKey(InPosition));
+	if (!ensure(BlockInfoPtr != nullptr && BlockInfoPtr->RefCount == 1))
+	{
+		return;
+	}
+	if (BlockInfoPtr->bHasHash)
+	{
+		HashToBlockMap.RemoveSingle(BlockInfoPtr->Hash, PositionToKey(InPosition));
+		BlockInfoPtr->bHasHash = false;
+	}
+	WriteBlock(InPosition, InData);
+}
+bool ULGUIProceduralRectData::UpdateSharedBlock(FIntVector2& InOutPosition, const uint8* InData)
+{
+	auto CurrentKey = PositionToKey(InOutPosition);
+	auto CurrentBlockInfoPtr = BlockInfoMap.Find(CurrentKey);
+	if (!ensure(CurrentBlockInfoPtr != nullptr))
+	{
+		return false;
+	}
+	auto Hash = FCrc::MemCrc32(InData, BlockSizeInByte);
+	if (CurrentBlockInfoPtr->bHasHash && CurrentBlockInfoPtr->Hash == Hash
+		&& FMemory::Memcmp(GetShadowBlock(InOutPosition), InData, BlockSizeInByte) == 0)
+	{
+		return false;//same data
+	}
+
+	//find block with identical data
+	TArray<uint64, TInlineAllocator<4>> SameHashBlocks;
+	HashToBlockMap.MultiFind(Hash, SameHashBlocks);
+	for (auto& BlockKey : SameHashBlocks)
+	{
+		auto BlockPosition = KeyToPosition(BlockKey);
+		if (FMemory::Memcmp(GetShadowBlock(BlockPosition), InData, BlockSizeInByte) == 0)
+		{
+			BlockInfoMap[BlockKey].RefCount++;
+			ReleaseBlock(InOutPosition);
+			InOutPosition = BlockPosition;
+			SharedBlockCount++;
+			return true;
+		}
+	}
+
+	bool bPositionChanged = false;
+	if (CurrentBlockInfoPtr->RefCount > 1)//shared with others, split to a new block
+	{
+		CurrentBlockInfoPtr->RefCount--;
+		InOutPosition = RegisterBuffer();
+		CurrentKey = PositionToKey(InOutPosition);
+		bPositionChanged = true;
+	}
+	else if (CurrentBlockInfoPtr->bHasHash)
+	{
+		HashToBlockMap.RemoveSingle(CurrentBlockInfoPtr->Hash, CurrentKey);
+	}
+	auto& BlockInfo = BlockInfoMap[CurrentKey];
+	BlockInfo.Hash = Hash;
+	BlockInfo.bHasHash = true;
+	HashToBlockMap.Add(Hash, CurrentKey);
+	WriteBlock(InOutPosition, InData);
+	return bPositionChanged;
 }
-void ULGUIProceduralRectData::UpdateBlock(const FIntVector2& InPosition, uint8* InData)
+
+void ULGUIProceduralRectData::FlushPendingUpdate()
 {
-	if (Texture->GetResource())
+	if (DirtyRowRangeMap.Num() == 0)
+	{
+		return;
+	}
+	if (Texture == nullptr || Texture->GetResource() == nullptr)
 	{
-		auto TextureRes = (FTexture2DDynamicResource*)Texture->GetResource();
-		ENQUEUE_RENDER_COMMAND(FLGUIProceduralRectData_UpdateBlock)(
-			[TextureRes, InPosition, InData, BlockSizeInByte = this->BlockSizeInByte, BlockPixelCount = this->BlockPixelCount](FRHICommandListImmediate& RHICmdList)
+		return;//keep it for next flush
+	}
+
+	TArray<int32> DirtyRows;
+	DirtyRowRangeMap.GenerateKeyArray(DirtyRows);
+	DirtyRows.Sort();
+
+	//merge adjacent rows into single region, use union of their range
+	TArray<FUpdateTextureRegion2D> Regions;
+	int32 TotalPixelCount = 0;
+	for (int i = 0; i < DirtyRows.Num(); )
+	{
+		auto StartRow = DirtyRows[i];
+		auto Range = DirtyRowRangeMap[StartRow];
+		int EndRow = StartRow;
+		for (i++; i < DirtyRows.Num() && DirtyRows[i] == EndRow + 1; i++)
+		{
+			EndRow = DirtyRows[i];
+			const auto& RowRange = DirtyRowRangeMap[EndRow];
+			Range.X = FMath::Min(Range.X, RowRange.X);
+			Range.Y = FMath::Max(Range.Y, RowRange.Y);
+		}
+		auto Width = FMath::Min(Range.Y + 1, TextureSize) - Range.X;
+		auto Height = EndRow - StartRow + 1;
+		Regions.Add(FUpdateTextureRegion2D(Range.X, StartRow, 0, 0, Width, Height));
+		TotalPixelCount += Width * Height;
+	}
+	DirtyRowRangeMap.Reset();
+
+	//copy regions' data from cpu side buffer, all region data in a single allocation
+	uint8* RegionData = new uint8[TotalPixelCount * 4];
+	TArray<int32> RegionDataOffsets;
+	RegionDataOffsets.Reserve(Regions.Num());
+	int32 DataOffset = 0;
+	for (auto& Region : Regions)
+	{
+		RegionDataOffsets.Add(DataOffset);
+		for (uint32 h = 0; h < Region.Height; h++)
+		{
+			FMemory::Memcpy(RegionData + DataOffset, GetShadowBlock(FIntVector2(Region.DestX, Region.DestY + h)), Region.Width * 4);
+			DataOffset += Region.Width * 4;
+		}
+	}
+	UploadRegionCount += Regions.Num();
+	INC_DWORD_STAT_BY(STAT_ProceduralRectData_UploadRegion, Regions.Num());
+
+	auto TextureRes = (FTexture2DDynamicResource*)Texture->GetResource();
+	ENQUEUE_RENDER_COMMAND(FLGUIProceduralRectData_UpdateRegions)(
+		[TextureRes, Regions = MoveTemp(Regions), RegionDataOffsets = MoveTemp(RegionDataOffsets), RegionData](FRHICommandListImmediate& RHICmdList)
+		{
+			for (int i = 0; i < Regions.Num(); i++)
 			{
 				RHICmdList.UpdateTexture2D(
 					TextureRes->GetTexture2DRHI(),
 					0,
-					FUpdateTextureRegion2D(InPosition.X, InPosition.Y, 0, 0, BlockPixelCount, 1),
-					BlockSizeInByte,
-					InData
+					Regions[i],
+					Regions[i].Width * 4,
+					RegionData + RegionDataOffsets[i]
 				);
-				delete InData;
-			});
+			}
+			delete[] RegionData;
+		});
+}
+void ULGUIProceduralRectData::FlushAllPendingUpdate()
+{
+	if (PendingFlushArray.Num() == 0)
+	{
+		return;
+	}
+	for (int i = PendingFlushArray.Num() - 1; i >= 0; i--)
+	{
+		if (auto Item = PendingFlushArray[i].Get())
+		{
+			Item->FlushPendingUpdate();
+			if (Item->DirtyRowRangeMap.Num() > 0)//texture resource not ready, keep it
+			{
+				continue;
+			}
+			Item->bIsPendingFlush = false;
+		}
+		PendingFlushArray.RemoveAt(i);
 	}
 }
 
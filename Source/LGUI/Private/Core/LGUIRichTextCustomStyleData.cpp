@@ -52,10 +52,16 @@ void FLGUIRichTextCustomStyleItemData::ApplyToRichTextParseResult(LGUIRichTextPa
 	}
 }
 
+void ULGUIRichTextCustomStyleData::NotifyDataChange()
+{
+	DataVersion++;
+	OnDataChange.Broadcast();
+}
+
 #if WITH_EDITOR
 void ULGUIRichTextCustomStyleData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
-	OnDataChange.Broadcast();
+	NotifyDataChange();
 }
 #endif
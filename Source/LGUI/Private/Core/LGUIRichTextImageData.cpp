@@ -14,23 +14,44 @@
 void ULGUIRichTextImageData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
-	OnDataChange.Broadcast();
+	NotifyDataChange();
 }
 #endif
 
 void ULGUIRichTextImageData::SetImageMap(const TMap<FName, FLGUIRichTextImageItemData>& value)
 {
 	imageMap = value;
-	OnDataChange.Broadcast();
+	NotifyDataChange();
 }
 void ULGUIRichTextImageData::SetAnimationFps(float value)
 {
 	animationFps = value;
-	OnDataChange.Broadcast();
+	NotifyDataChange();
 }
 void ULGUIRichTextImageData::BroadcastOnDataChange()
 {
-	OnDataChange.Broadcast();
+	NotifyDataChange();
+}
+int32 ULGUIRichTextImageData::GetImageHandle(const FName& InImageName)const
+{
+	auto Id = imageMap.FindId(InImageName);
+	return Id.IsValidId() ? Id.AsInteger() : INDEX_NONE;
+}
+const FLGUIRichTextImageItemData* ULGUIRichTextImageData::FindImageItem(const FUIText_RichTextImageTag& InImageTag)const
+{
+	if (InImageTag.ImageHandle != INDEX_NONE)
+	{
+		auto Id = FSetElementId::FromInteger(InImageTag.ImageHandle);
+		if (imageMap.IsValidId(Id))
+		{
+			auto& Pair = imageMap.Get(Id);
+			if (Pair.Key == InImageTag.TagName)//handle is outdated if imageMap is modified by GetMutableImageMap without BroadcastOnDataChange
+			{
+				return &Pair.Value;
+			}
+		}
+	}
+	return imageMap.Find(InImageTag.TagName);
 }
 
 void ULGUIRichTextImageData::CreateOrUpdateObject(UUIItem* parent, const TArray<FUIText_RichTextImageTag>& imageTagData, TArray<UUIItem*>& createdImageObjectArray, bool listImageObjectInEditorOutliner)
@@ -63,7 +84,7 @@ void ULGUIRichTextImageData::CreateOrUpdateObject(UUIItem* parent, const TArray<
 			bListedInSceneOutliner_Property->SetPropertyValue_InContainer(imageObj->GetOwner(), listImageObjectInEditorOutliner);
 		}
 #endif
-		if (auto imageItemPtr = imageMap.Find(imageTagData[i].TagName))
+		if (auto imageItemPtr = FindImageItem(imageTagData[i]))
 		{
 			auto& spriteFrames = imageItemPtr->frames;
 			auto sequencePlayerComp = imageObj->GetOwner()->FindComponentByClass<UUISpriteSequencePlayer>();
@@ -24,7 +24,7 @@ ULGUISDFFontData::ULGUISDFFontData()
 
 bool ULGUISDFFontData::GetCharDataFromCache(const TCHAR& charCode, const float& charSize, FLGUICharData_HighPrecision& OutResult)
 {
-	if (auto charData = charDataMap.Find(charCode))
+	if (auto charData = charDataTable.Find(charCode))
 	{
 		OutResult = FLGUICharData_HighPrecision(*charData);
 		float vertexOffset = SDFRadius - SDFRadius * BoldRatio;
@@ -49,18 +49,11 @@ bool ULGUISDFFontData::GetCharDataFromCache(const TCHAR& charCode, const float&
 }
 void ULGUISDFFontData::AddCharDataToCache(const TCHAR& charCode, const float& charSize, const FLGUICharData& charData)
 {
-	charDataMap.Add(charCode, charData);
+	charDataTable.Add(charCode, charData);
 }
 void ULGUISDFFontData::ScaleDownUVofCachedChars()
 {
-	for (auto& charDataItem : charDataMap)
-	{
-		auto& mapValue = charDataItem.Value;
-		mapValue.uv0X *= 0.5f;
-		mapValue.uv0Y *= 0.5f;
-		mapValue.uv3X *= 0.5f;
-		mapValue.uv3Y *= 0.5f;
-	}
+	charDataTable.ScaleDownUV();
 }
 bool ULGUISDFFontData::RenderGlyph(const TCHAR& charCode, const float& charSize, FGlyphBitmap& OutResult)
 {
@@ -104,7 +97,7 @@ bool ULGUISDFFontData::RenderGlyph(const TCHAR& charCode, const float& charSize,
 }
 void ULGUISDFFontData::ClearCharDataCache()
 {
-	charDataMap.Empty();
+	charDataTable.Empty();
 	LineHeight = VerticalOffset = -1;
 }
 
@@ -146,14 +139,7 @@ void ULGUISDFFontData::ApplyPackingAtlasTextureExpand(UTexture2D* newTexture, in
 {
 	Super::ApplyPackingAtlasTextureExpand(newTexture, newTextureSize);
 	//scale down uv of prev chars
-	for (auto& charDataItem : charDataMap)
-	{
-		auto& mapValue = charDataItem.Value;
-		mapValue.uv0X *= 0.5f;
-		mapValue.uv0Y *= 0.5f;
-		mapValue.uv3X *= 0.5f;
-		mapValue.uv3Y *= 0.5f;
-	}
+	charDataTable.ScaleDownUV();
 }
 
 void ULGUISDFFontData::PrepareForPushCharData(UUIText* InText)
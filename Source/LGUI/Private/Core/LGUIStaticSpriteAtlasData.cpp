@@ -304,7 +304,7 @@ bool ULGUIStaticSpriteAtlasData::PackAtlas()
 	uint32 packSize = 16;//start from minimal size 16
 	TArray<rbp::Rect> packResult;
 	packResult.SetNumUninitialized(spriteArray.Num());
-	while (!PackAtlasTest(packSize, packResult))
+	while (!PackAtlasTest(spriteArray, packSize, packResult))
 	{
 		packSize *= 2;
 	}
@@ -512,14 +512,14 @@ bool ULGUIStaticSpriteAtlasData::PackAtlas()
 
 	return true;
 }
-bool ULGUIStaticSpriteAtlasData::PackAtlasTest(uint32 size, TArray<rbp::Rect>& result)
+bool ULGUIStaticSpriteAtlasData::PackAtlasTest(const TArray<TObjectPtr<ULGUISpriteData>>& InSpriteArray, uint32 size, TArray<rbp::Rect>& result)const
 {
 	rbp::MaxRectsBinPack atlasBinPack;
 	atlasBinPack.Init(size, size, false);
 	auto methold = rbp::MaxRectsBinPack::FreeRectChoiceHeuristic::RectBestAreaFit;
-	for (int i = 0; i < spriteArray.Num(); i++)
+	for (int i = 0; i < InSpriteArray.Num(); i++)
 	{
-		auto spriteDataItem = spriteArray[i];
+		auto spriteDataItem = InSpriteArray[i];
 		auto calculatedEdgePixelPadding = spriteDataItem->GetUseEdgePixelPadding() ? edgePixelPadding : 0;
 		auto spriteTexture = spriteDataItem->GetSpriteTexture();
 		auto space = spaceBetweenSprites + calculatedEdgePixelPadding + calculatedEdgePixelPadding;
@@ -544,6 +544,295 @@ bool ULGUIStaticSpriteAtlasData::PackAtlasTest(uint32 size, TArray<rbp::Rect>& r
 	}
 	return true;
 }
+FIntPoint ULGUIStaticSpriteAtlasData::GetSpritePackSize(ULGUISpriteData* InSpriteData)const
+{
+	auto calculatedEdgePixelPadding = InSpriteData->GetUseEdgePixelPadding() ? edgePixelPadding : 0;
+	auto space = spaceBetweenSprites + calculatedEdgePixelPadding + calculatedEdgePixelPadding;
+	auto spriteTexture = InSpriteData->GetSpriteTexture();
+	FTextureCompilingManager::Get().FinishCompilation({ spriteTexture });
+	return FIntPoint(spriteTexture->GetSizeX() + space, spriteTexture->GetSizeY() + space);
+}
+int64 ULGUIStaticSpriteAtlasData::GetSpritePackArea(ULGUISpriteData* InSpriteData)const
+{
+	auto Size = GetSpritePackSize(InSpriteData);
+	return (int64)Size.X * Size.Y;
+}
+bool ULGUIStaticSpriteAtlasData::RegroupSpritesByUsage(const TArray<ULGUIStaticSpriteAtlasData*>& InAtlasArray, const TArray<TArray<ULGUISpriteData*>>& InUsageArray)
+{
+	//MaxRects can't fill the whole atlas, so only count this ratio of atlas area as usable
+	const float UsableAreaRatio = 0.8f;
+
+	TArray<ULGUIStaticSpriteAtlasData*> AtlasArray;
+	TArray<ULGUISpriteData*> SpriteArray;
+	TMap<ULGUISpriteData*, int32> SpriteToAtlasIndex;//INDEX_NONE means not assigned yet
+	TMap<ULGUISpriteData*, int64> SpriteSourcePackArea;//area in the atlas where sprite come from, for sorting
+	for (auto Atlas : InAtlasArray)
+	{
+		if (!IsValid(Atlas) || AtlasArray.Contains(Atlas))continue;
+		AtlasArray.Add(Atlas);
+		for (auto& Sprite : Atlas->spriteArray)
+		{
+			if (IsValid(Sprite) && IsValid(Sprite->GetSpriteTexture()) && !SpriteToAtlasIndex.Contains(Sprite))
+			{
+				SpriteToAtlasIndex.Add(Sprite, INDEX_NONE);
+				SpriteSourcePackArea.Add(Sprite, Atlas->GetSpritePackArea(Sprite));
+				SpriteArray.Add(Sprite);
+			}
+		}
+	}
+	if (AtlasArray.Num() == 0 || SpriteArray.Num() == 0)return false;
+
+	TArray<int64> RemainArea;
+	for (auto Atlas : AtlasArray)
+	{
+		RemainArea.Add((int64)((double)Atlas->maxAtlasTextureSize * Atlas->maxAtlasTextureSize * UsableAreaRatio));
+	}
+	auto TryAssign = [&](ULGUISpriteData* Sprite, int32 AtlasIndex) {
+		auto Atlas = AtlasArray[AtlasIndex];
+		auto Size = Atlas->GetSpritePackSize(Sprite);
+		if ((uint32)Size.X > Atlas->maxAtlasTextureSize || (uint32)Size.Y > Atlas->maxAtlasTextureSize)return false;//too large for this atlas, no matter how much area remain
+		auto Area = (int64)Size.X * Size.Y;
+		if (Area > RemainArea[AtlasIndex])return false;
+		RemainArea[AtlasIndex] -= Area;
+		SpriteToAtlasIndex[Sprite] = AtlasIndex;
+		return true;
+	};
+	auto ReportFail = [](ULGUISpriteData* Sprite) {
+		auto ErrMsg = FText::Format(LOCTEXT("RegroupSpritesByUsageError", "{0} Regroup sprites fail! Sprite: '{1}' can't fit into these atlases, please increase maxAtlasTextureSize or add more atlas.")
+			, FText::FromString(FString::Printf(TEXT("[%s].%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__))
+			, FText::FromString(Sprite->GetPathName()));
+		UE_LOG(LGUI, Error, TEXT("%s"), *ErrMsg.ToString());
+		LGUIUtils::EditorNotification(ErrMsg, 10.0f);
+	};
+
+	//only care sprites of these atlases, and bigger group first so it have more chance to stay in one atlas
+	TArray<TArray<ULGUISpriteData*>> UsageArray;
+	for (auto& Usage : InUsageArray)
+	{
+		TArray<ULGUISpriteData*> FilteredUsage;
+		for (auto Sprite : Usage)
+		{
+			if (SpriteToAtlasIndex.Contains(Sprite))
+			{
+				FilteredUsage.AddUnique(Sprite);
+			}
+		}
+		if (FilteredUsage.Num() > 0)
+		{
+			UsageArray.Add(MoveTemp(FilteredUsage));
+		}
+	}
+	UsageArray.StableSort([](const TArray<ULGUISpriteData*>& A, const TArray<ULGUISpriteData*>& B) {
+		return A.Num() > B.Num();
+		});
+
+	TArray<int32> UsageCountInAtlas;
+	TArray<int32> AtlasOrder;
+	TArray<ULGUISpriteData*> NotAssignedSprites;
+	for (auto& Usage : UsageArray)
+	{
+		UsageCountInAtlas.Reset();
+		UsageCountInAtlas.SetNumZeroed(AtlasArray.Num());
+		NotAssignedSprites.Reset();
+		for (auto Sprite : Usage)
+		{
+			auto AtlasIndex = SpriteToAtlasIndex[Sprite];
+			if (AtlasIndex != INDEX_NONE)
+			{
+				UsageCountInAtlas[AtlasIndex]++;
+			}
+			else
+			{
+				NotAssignedSprites.Add(Sprite);
+			}
+		}
+		if (NotAssignedSprites.Num() == 0)continue;
+
+		//prefer atlas that already have more sprites of this usage, then atlas that have more space
+		AtlasOrder.Reset();
+		for (int i = 0; i < AtlasArray.Num(); i++)
+		{
+			AtlasOrder.Add(i);
+		}
+		AtlasOrder.StableSort([&](int32 A, int32 B) {
+			if (UsageCountInAtlas[A] != UsageCountInAtlas[B])return UsageCountInAtlas[A] > UsageCountInAtlas[B];
+			return RemainArea[A] > RemainArea[B];
+			});
+		//find atlas that can hold all not assigned sprites of this usage
+		int32 TargetAtlasIndex = INDEX_NONE;
+		for (auto AtlasIndex : AtlasOrder)
+		{
+			int64 Area = 0;
+			for (auto Sprite : NotAssignedSprites)
+			{
+				Area += AtlasArray[AtlasIndex]->GetSpritePackArea(Sprite);
+			}
+			if (Area <= RemainArea[AtlasIndex])
+			{
+				TargetAtlasIndex = AtlasIndex;
+				break;
+			}
+		}
+		for (auto Sprite : NotAssignedSprites)
+		{
+			if (TargetAtlasIndex != INDEX_NONE && TryAssign(Sprite, TargetAtlasIndex))continue;
+			//no atlas can hold the whole usage, split it
+			bool bAssigned = false;
+			for (auto AtlasIndex : AtlasOrder)
+			{
+				if (TryAssign(Sprite, AtlasIndex))
+				{
+					bAssigned = true;
+					break;
+				}
+			}
+			if (!bAssigned)
+			{
+				ReportFail(Sprite);
+				return false;
+			}
+		}
+	}
+	//sprites not used by any usage, bigger first
+	NotAssignedSprites.Reset();
+	for (auto Sprite : SpriteArray)
+	{
+		if (SpriteToAtlasIndex[Sprite] == INDEX_NONE)
+		{
+			NotAssignedSprites.Add(Sprite);
+		}
+	}
+	NotAssignedSprites.StableSort([&](const ULGUISpriteData& A, const ULGUISpriteData& B) {
+		return SpriteSourcePackArea[&A] > SpriteSourcePackArea[&B];
+		});
+	for (auto Sprite : NotAssignedSprites)
+	{
+		//atlas with more remain area first
+		AtlasOrder.Reset();
+		for (int i = 0; i < AtlasArray.Num(); i++)
+		{
+			AtlasOrder.Add(i);
+		}
+		AtlasOrder.StableSort([&](int32 A, int32 B) {
+			return RemainArea[A] > RemainArea[B];
+			});
+		bool bAssigned = false;
+		for (auto AtlasIndex : AtlasOrder)
+		{
+			if (TryAssign(Sprite, AtlasIndex))
+			{
+				bAssigned = true;
+				break;
+			}
+		}
+		if (!bAssigned)
+		{
+			ReportFail(Sprite);
+			return false;
+		}
+	}
+
+	//find changed atlas
+	TArray<bool> AtlasChanged;
+	AtlasChanged.SetNumZeroed(AtlasArray.Num());
+	for (auto Sprite : SpriteArray)
+	{
+		auto AtlasIndex = SpriteToAtlasIndex[Sprite];
+		if (Sprite->packingAtlas == AtlasArray[AtlasIndex])continue;
+		auto PrevAtlasIndex = AtlasArray.IndexOfByKey(Sprite->packingAtlas);
+		if (PrevAtlasIndex != INDEX_NONE)
+		{
+			AtlasChanged[PrevAtlasIndex] = true;
+		}
+		AtlasChanged[AtlasIndex] = true;
+	}
+	//area is only an estimate, test pack every changed atlas before change anything
+	TArray<TArray<TObjectPtr<ULGUISpriteData>>> NewSpriteArrays;
+	NewSpriteArrays.SetNum(AtlasArray.Num());
+	for (auto Sprite : SpriteArray)
+	{
+		NewSpriteArrays[SpriteToAtlasIndex[Sprite]].Add(Sprite);
+	}
+	TArray<rbp::Rect> PackResult;
+	for (int i = 0; i < AtlasArray.Num(); i++)
+	{
+		if (!AtlasChanged[i])continue;
+		auto Atlas = AtlasArray[i];
+		PackResult.SetNumUninitialized(NewSpriteArrays[i].Num(), false);
+		if (!Atlas->PackAtlasTest(NewSpriteArrays[i], Atlas->maxAtlasTextureSize, PackResult))
+		{
+			auto ErrMsg = FText::Format(LOCTEXT("RegroupSpritesByUsagePackError", "{0} Regroup sprites fail! Regrouped sprites can't pack into atlas: '{1}' with size {2}, please increase maxAtlasTextureSize or add more atlas.")
+				, FText::FromString(FString::Printf(TEXT("[%s].%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__))
+				, FText::FromString(Atlas->GetPathName())
+				, Atlas->maxAtlasTextureSize);
+			UE_LOG(LGUI, Error, TEXT("%s"), *ErrMsg.ToString());
+			LGUIUtils::EditorNotification(ErrMsg, 10.0f);
+			return false;
+		}
+	}
+
+	//apply
+	for (auto Sprite : SpriteArray)
+	{
+		auto TargetAtlas = AtlasArray[SpriteToAtlasIndex[Sprite]];
+		if (Sprite->packingAtlas == TargetAtlas)continue;
+		Sprite->Modify();
+		Sprite->packingAtlas = TargetAtlas;
+		Sprite->isInitialized = false;
+		Sprite->MarkPackageDirty();
+	}
+	for (int i = 0; i < AtlasArray.Num(); i++)
+	{
+		if (!AtlasChanged[i])continue;
+		auto Atlas = AtlasArray[i];
+		Atlas->Modify();
+		Atlas->spriteArray = MoveTemp(NewSpriteArrays[i]);
+		//render sprite should follow the sprite, so they can get new atlas texture
+		for (int RenderSpriteIndex = Atlas->renderSpriteArray.Num() - 1; RenderSpriteIndex >= 0; RenderSpriteIndex--)
+		{
+			auto RenderSprite = Atlas->renderSpriteArray[RenderSpriteIndex];
+			if (!RenderSprite.IsValid())continue;
+			if (auto Sprite = Cast<ULGUISpriteData>(IUISpriteRenderableInterface::Execute_SpriteRenderableGetSprite(RenderSprite.Get())))
+			{
+				if (Sprite->packingAtlas != Atlas && IsValid(Sprite->packingAtlas))
+				{
+					Atlas->renderSpriteArray.RemoveAt(RenderSpriteIndex);
+					Sprite->packingAtlas->renderSpriteArray.AddUnique(RenderSprite);
+				}
+			}
+		}
+		Atlas->MarkPackageDirty();
+	}
+	for (int i = 0; i < AtlasArray.Num(); i++)
+	{
+		if (!AtlasChanged[i])continue;
+		AtlasArray[i]->MarkNotInitialized();
+		AtlasArray[i]->InitCheck();
+	}
+	return true;
+}
+int32 ULGUIStaticSpriteAtlasData::GetExpectedTextureCount(const TArray<ULGUISpriteData*>& InSpriteArray)
+{
+	TSet<const UObject*> TextureSet;
+	TSet<FName> PackingTagSet;
+	for (auto Sprite : InSpriteArray)
+	{
+		if (!IsValid(Sprite))continue;
+		if (IsValid(Sprite->packingAtlas))
+		{
+			TextureSet.Add(Sprite->packingAtlas);
+		}
+		else if (Sprite->packingTag != NAME_None)
+		{
+			PackingTagSet.Add(Sprite->packingTag);
+		}
+		else
+		{
+			TextureSet.Add(Sprite->GetSpriteTexture());
+		}
+	}
+	return TextureSet.Num() + PackingTagSet.Num();
+}
 void ULGUIStaticSpriteAtlasData::BeginCacheForCookedPlatformData(const ITargetPlatform* TargetPlatform)
 {
 	
@@ -10,6 +10,19 @@ FTextGeometryCache::FTextGeometryCache(UUIText* InUIText)
 {
 	this->UIText = InUIText;
 }
+FUITextGlyphCache* FTextGeometryCache::GetGlyphCacheForBuild()
+{
+	if (!bHasBuiltGeometry)
+	{
+		bHasBuiltGeometry = true;
+		return nullptr;
+	}
+	if (!glyphCache.IsValid())
+	{
+		glyphCache = MakeShared<FUITextGlyphCache>();
+	}
+	return glyphCache.Get();
+}
 bool FTextGeometryCache::SetInputParameters(
 	const FString& InContent,
 	int32 InVisibleCharCount,
@@ -171,8 +184,57 @@ void FTextGeometryCache::ConditaionalCalculateGeometry()
 			, this->font.Get()
 			, this->richText
 			, this->richTextFilterFlags
+			, GetGlyphCacheForBuild()
 			);
 		this->UIText->GenerateRichTextImageObject();
 	}
 }
 
+void FTextGeometryCache::ApplyFontTextureScaleUpToGlyphCache()
+{
+	if (glyphCache.IsValid())
+	{
+		glyphCache->ApplyFontTextureScaleUp();
+	}
+}
+void FTextGeometryCache::ClearGlyphCache()
+{
+	if (glyphCache.IsValid())
+	{
+		glyphCache->Reset();
+	}
+}
+
+bool FTextGeometryCache::UpdateContentInPlace(FStringView InContent)
+{
+	if (bIsDirty || richText)return false;
+	if (!this->UIText.IsValid() || !this->UIText->GetRenderCanvas() || !this->font.IsValid())return false;
+	if (useKerning && this->font->HasKerning())return false;//kerning depend on neighbour char
+	if (!charsUpdateBuffer.IsValid())
+	{
+		charsUpdateBuffer = MakeShared<FUITextCharsUpdateBuffer>();
+	}
+	if (!UIGeometry::UpdateUITextChars(
+		this->content
+		, InContent
+		, this->color
+		, this->fontSpace
+		, this->UIText->GetGeometry()
+		, this->fontSize
+		, this->fontStyle
+		, this->overflowType
+		, this->UIText->GetRenderCanvas()
+		, this->UIText.Get()
+		, this->cacheCharPropertyArray
+		, this->font.Get()
+		, *charsUpdateBuffer
+		, GetGlyphCacheForBuild()
+	))
+	{
+		return false;
+	}
+	this->content.Reset(InContent.Len());
+	this->content.Append(InContent.GetData(), InContent.Len());
+	return true;
+}
+
@@ -2393,6 +2393,137 @@ void UIGeometry_AlignUITextLineVertexForRichText(EUITextParagraphHorizontalAlign
 	}
 }
 #include "Core/LGUIRichTextCustomStyleData.h"
+#include "Core/LGUIRichTextImageData_BaseObject.h"
+#include "HAL/IConsoleManager.h"
+static TAutoConsoleVariable<int32> CVarRichTextParseCacheSize(
+	TEXT("lgui.RichText.ParseCacheSize"),
+	0,
+	TEXT("How many rich text parse results are cached, so UIText with same rich text content don't need to parse again. 0 means no cache."),
+	ECVF_Default);
+static TAutoConsoleVariable<int32> CVarRichTextParseCacheMaxLength(
+	TEXT("lgui.RichText.ParseCacheMaxLength"),
+	256,
+	TEXT("Rich text longer than this don't use parse cache, hash and compare a long text could cost near as much as parse it."),
+	ECVF_Default);
+DECLARE_CYCLE_STAT(TEXT("UIGeometry ParseRichText"), STAT_ParseRichText, STATGROUP_LGUI);
+/**
+ * Parse rich text to content without tags and parse result of each char of content.
+ * @param parser				should be prepared and cleared
+ * @param inOutParseResult		prepared parse result, also used as current state when parse
+ */
+static void UIGeometry_ParseRichText(const FString& text, LGUIRichTextParser::RichTextParser& parser, LGUIRichTextParser::RichTextTokenArena& tokenArena
+	, ULGUIRichTextCustomStyleData* customStyleData, ULGUIRichTextImageData_BaseObject* imageData
+	, LGUIRichTextParser::RichTextParseResult& inOutParseResult, FString& outContent, TArray<LGUIRichTextParser::RichTextParseResult>& outParseResultArray)
+{
+	using namespace LGUIRichTextParser;
+	const int32 textLength = text.Len();
+	outContent.Reset(textLength);
+	outParseResultArray.Reset(textLength);
+	tokenArena.Tokenize(text);
+	const auto& tokenArray = tokenArena.tokenArray;
+	int32 tokenIndex = 0;
+	//custom style is resolved once per tag, instead of map lookup for every char
+	const FLGUIRichTextCustomStyleItemData* noneTagStyleItemData = customStyleData != nullptr ? customStyleData->GetDataMap().Find(NAME_None) : nullptr;
+	FName prevCustomTag = NAME_None;
+	const FLGUIRichTextCustomStyleItemData* prevCustomStyleItemData = noneTagStyleItemData;
+	auto& richTextParseResult = inOutParseResult;
+	for (int charIndex = 0; charIndex < textLength; charIndex++)
+	{
+		richTextParseResult.customTag = NAME_None;
+		richTextParseResult.customTagMode = CustomTagMode::None;
+		richTextParseResult.charIndex = charIndex;
+		parser.ClearImageTag();
+		//tags before this char did not take effect, they are displayed as plain text
+		while (tokenIndex < tokenArray.Num() && tokenArray[tokenIndex].startIndex < charIndex)
+		{
+			tokenIndex++;
+		}
+		while (tokenIndex < tokenArray.Num() && tokenArray[tokenIndex].startIndex == charIndex)
+		{
+			const auto& token = tokenArray[tokenIndex];
+			if (!parser.ApplyToken(token, richTextParseResult))break;
+			tokenIndex++;
+			charIndex = token.endIndex + 1;
+			if (!richTextParseResult.imageTag.IsNone())//get image, append a blank placeholder
+			{
+				richTextParseResult.imageHandle = imageData != nullptr ? imageData->GetImageHandle(richTextParseResult.imageTag) : INDEX_NONE;
+				outContent.AppendChar(' ');
+				outParseResultArray.Add(richTextParseResult);
+				richTextParseResult.imageTag = NAME_None;//clear it
+				richTextParseResult.imageHandle = INDEX_NONE;
+				parser.ClearImageTag();
+			}
+			if (charIndex >= textLength)break;
+		}
+		//if find end symbol, then mark the prev one as end
+		if (richTextParseResult.customTagMode == CustomTagMode::End && outParseResultArray.Num() > 0)
+		{
+			auto& last = outParseResultArray[outParseResultArray.Num() - 1];
+			last.customTag = richTextParseResult.customTag;
+			last.customTagMode = richTextParseResult.customTagMode;
+			richTextParseResult.customTag = NAME_None;
+			richTextParseResult.customTagMode = CustomTagMode::None;
+		}
+
+		if (charIndex >= textLength)break;
+		outContent.AppendChar(text[charIndex]);
+		richTextParseResult.charIndex = charIndex;
+		//convert custom tag to style
+		if (customStyleData != nullptr)
+		{
+			if (richTextParseResult.customTag != prevCustomTag)
+			{
+				prevCustomTag = richTextParseResult.customTag;
+				prevCustomStyleItemData = prevCustomTag.IsNone() ? noneTagStyleItemData : customStyleData->GetDataMap().Find(prevCustomTag);
+			}
+			if (prevCustomStyleItemData != nullptr)
+			{
+				prevCustomStyleItemData->ApplyToRichTextParseResult(richTextParseResult);
+			}
+		}
+		outParseResultArray.Add(richTextParseResult);
+	}
+}
+#if !UE_BUILD_SHIPPING
+/** Parse a large marked-up document without cache, to measure rich text parse throughput. */
+struct FLGUIRichTextParseBenchmark
+{
+	static void Run(const TArray<FString>& Args)
+	{
+		using namespace LGUIRichTextParser;
+		const int32 LineCount = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+		const int32 ParseCount = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 100;
+
+		FString Document;
+		for (int32 i = 0; i < LineCount; i++)
+		{
+			Document += FString::Printf(TEXT("<b>[Player%d]</b> found <color=#ffcc00>golden <i>key</i></color> x<size=+4>%d</size><sup>%d</sup>, <u>reward</u>: <quest>Elder's <s>old</s> ring</quest> <img=coin/>\n"), i, i * 3, i % 10);
+		}
+		RichTextParser Parser;
+		RichTextTokenArena TokenArena;
+		FString Content;
+		TArray<RichTextParseResult> ParseResultArray;
+		const int32 AllFlags = 0xFFFF;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < ParseCount; i++)
+		{
+			RichTextParseResult ParseResult;
+			Parser.Clear();
+			Parser.Prepare(18, FColor::White, 255, false, false, AllFlags, ParseResult);
+			UIGeometry_ParseRichText(Document, Parser, TokenArena, nullptr, nullptr, ParseResult, Content, ParseResultArray);
+		}
+		const double TotalTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		UE_LOG(LGUI, Log, TEXT("[%s] %d chars (%d chars after parse, %d tags) x %d parses, total: %.3fms, per parse: %.3fms, throughput: %.1f chars/ms")
+			, ANSI_TO_TCHAR(__FUNCTION__), Document.Len(), Content.Len(), TokenArena.tokenArray.Num(), ParseCount, TotalTime, TotalTime / ParseCount, (double)Document.Len() * ParseCount / FMath::Max(TotalTime, 0.001));
+	}
+};
+static FAutoConsoleCommand LGUIRichTextParseBenchmarkCommand(
+	TEXT("lgui.RichText.ParseBenchmark"),
+	TEXT("Parse a large marked-up rich text document without cache, and log the throughput. Args: [LineCount=500] [ParseCount=100]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FLGUIRichTextParseBenchmark::Run));
+#endif
+DECLARE_CYCLE_STAT(TEXT("UIGeometry UpdateUIText"), STAT_UpdateUIText, STATGROUP_LGUI);
 void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float width, float height, const FVector2f& pivot
 	, const FColor& color, uint8 canvasGroupAlpha, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
 	, EUITextParagraphHorizontalAlign paragraphHAlign, EUITextParagraphVerticalAlign paragraphVAlign, EUITextOverflowType overflowType
@@ -2401,9 +2532,11 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	, ULGUICanvas* renderCanvas, UUIText* uiComp
 	, TArray<FUITextLineProperty>& cacheLinePropertyArray, TArray<FUITextCharProperty>& cacheCharPropertyArray, TArray<FUIText_RichTextCustomTag>& cacheRichTextCustomTagArray
 	, TArray<FUIText_RichTextImageTag>& cacheRichTextImageTagArray
-	, ULGUIFontData_BaseObject* font, bool richText, int32 richTextFilterFlags)
+	, ULGUIFontData_BaseObject* font, bool richText, int32 richTextFilterFlags
+	, FUITextGlyphCache* glyphCache)
 {
-	FString content = text;
+	SCOPE_CYCLE_COUNTER(STAT_UpdateUIText);
+	const FString* contentPtr = &text;//point to parsed content if rich text, so no need to copy
 
 	float maxFontSize = font->GetFontSizeLimit();
 	fontSize = FMath::Clamp(fontSize, 0.0f, maxFontSize);
@@ -2438,10 +2571,19 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 
 	font->PrepareForPushCharData(uiComp);
 	bool useKerning = kerning && font->HasKerning();
+	if (glyphCache != nullptr)
+	{
+		glyphCache->Prepare(font);
+	}
+	auto GetFontCharData = [&](TCHAR charCode, float inFontSize)
+	{
+		return glyphCache != nullptr ? glyphCache->GetCharData(font, charCode, inFontSize) : font->GetCharData(charCode, inFontSize);
+	};
 
 	//rich text
 	using namespace LGUIRichTextParser;
 	static RichTextParser richTextParser;
+	static RichTextParseCache richTextParseCache;
 	RichTextParseResult richTextParseResult;
 	if (richText)
 	{
@@ -2464,7 +2606,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	cacheCharPropertyArray.Reset();
 	cacheRichTextCustomTagArray.Reset();
 	cacheRichTextImageTagArray.Reset();
-	int contentLength = content.Len();
+	int contentLength = text.Len();
 	FVector2f currentLineOffset(0, 0);
 	float originLineHeight = font->GetLineHeight(fontSize);
 	float currentLineWidth = 0, currentLineHeight = originLineHeight, paragraphHeight = 0;//single line width, height, all line height
@@ -2572,7 +2714,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	};
 	auto GetCharGeo = [&](TCHAR prevCharCode, TCHAR charCode, float inFontSize)
 	{
-		auto charData = font->GetCharData(charCode, inFontSize);
+		auto charData = GetFontCharData(charCode, inFontSize);
 		float calculatedCharFixedOffset = richText ? font->GetVerticalOffset(inFontSize) : verticalOffset;
 
 		auto overrideCharData = charData;
@@ -2588,7 +2730,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				}
 				else
 				{
-					overrideCharData = font->GetCharData(charCode, inFontSize);
+					overrideCharData = GetFontCharData(charCode, inFontSize);
 
 					overrideCharData.width = overrideCharData.width * oneDivideRootCanvasScale;
 					overrideCharData.height = overrideCharData.height * oneDivideRootCanvasScale;
@@ -2607,7 +2749,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				}
 				else
 				{
-					overrideCharData = font->GetCharData(charCode, inFontSize);
+					overrideCharData = GetFontCharData(charCode, inFontSize);
 
 					overrideCharData.width = overrideCharData.width * oneDivideDynamicPixelsPerUnit;
 					overrideCharData.height = overrideCharData.height * oneDivideDynamicPixelsPerUnit;
@@ -2626,7 +2768,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				}
 				else
 				{
-					overrideCharData = font->GetCharData(charCode, inFontSize);
+					overrideCharData = GetFontCharData(charCode, inFontSize);
 
 					overrideCharData.width = overrideCharData.width * oneDivideRootCanvasScale;
 					overrideCharData.height = overrideCharData.height * oneDivideRootCanvasScale;
@@ -2662,7 +2804,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 		else
 		{
 			auto overrideFontSize = richText ? richTextResult.size : fontSize;
-			auto charData = font->GetCharData(charCode, overrideFontSize);
+			auto charData = GetFontCharData(charCode, overrideFontSize);
 			if (useKerning && prevCharCode != charCode)
 			{
 				auto kerning = font->GetKerning(prevCharCode, charCode, overrideFontSize);
@@ -2676,66 +2818,57 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	};
 
 	//pre parse rich text
-	static TArray<RichTextParseResult> richTextPropertyArray;
-	richTextPropertyArray.Reset();
+	static TArray<RichTextParseResult> parsedRichTextPropertyArray;
+	const TArray<RichTextParseResult>* richTextPropertyArrayPtr = &parsedRichTextPropertyArray;//point to cached result if found, so no need to copy
 	if (richText)
 	{
-		FString richTextContent;
-		richTextContent.Reserve(content.Len());
+		SCOPE_CYCLE_COUNTER(STAT_ParseRichText);
 		auto richTextCustomStyleData = uiComp->GetRichTextCustomStyleData();
 		bool useCustomStyle = IsValid(richTextCustomStyleData);
-		for (int charIndex = 0; charIndex < contentLength; charIndex++)
-		{
-			auto charCode = content[charIndex];
-			richTextParseResult.customTag = NAME_None;
-			richTextParseResult.customTagMode = CustomTagMode::None;
-			richTextParseResult.charIndex = charIndex;
-			richTextParser.ClearImageTag();
-			while (richTextParser.Parse(content, contentLength, charIndex, richTextParseResult))
-			{
-				if (!richTextParseResult.imageTag.IsNone())//get image, append a blank placeholder
-				{
-					richTextContent.AppendChar(' ');
-					richTextPropertyArray.Add(richTextParseResult);
-					richTextParseResult.imageTag = NAME_None;//clear it
-					richTextParser.ClearImageTag();
-				}
-				if (charIndex < contentLength)
-				{
-					charCode = content[charIndex];
-				}
-				else
-				{
-					break;
-				}
-			}
-			//if find end symbol, then mark the prev one as end
-			if (richTextParseResult.customTagMode == LGUIRichTextParser::CustomTagMode::End)
-			{
-				auto& last = richTextPropertyArray[richTextPropertyArray.Num() - 1];
-				last.customTag = richTextParseResult.customTag;
-				last.customTagMode = richTextParseResult.customTagMode;
-				richTextParseResult.customTag = NAME_None;
-				richTextParseResult.customTagMode = LGUIRichTextParser::CustomTagMode::None;
-			}
-
-			if (charIndex >= contentLength)break;
-			richTextContent.AppendChar(charCode);
-			richTextParseResult.charIndex = charIndex;
-			//convert custom tag to style
-			if (useCustomStyle)
-			{
-				if (auto customStyleItemDataPtr = richTextCustomStyleData->GetDataMap().Find(richTextParseResult.customTag))
-				{
-					customStyleItemDataPtr->ApplyToRichTextParseResult(richTextParseResult);
-				}
-			}
-			richTextPropertyArray.Add(richTextParseResult);
+		auto richTextImageData = uiComp->GetRichTextImageData();
+		bool useImageData = IsValid(richTextImageData);
+		//same parameters as richTextParser.Prepare
+		RichTextParseParameter parseParameter;
+		parseParameter.size = richTextParseResult.size;
+		parseParameter.color = color;
+		parseParameter.canvasGroupAlpha = canvasGroupAlpha;
+		parseParameter.bold = richTextParseResult.bold;
+		parseParameter.italic = richTextParseResult.italic;
+		parseParameter.flags = richTextFilterFlags;
+		parseParameter.customStyleData = FObjectKey(useCustomStyle ? richTextCustomStyleData : nullptr);
+		parseParameter.customStyleDataVersion = useCustomStyle ? richTextCustomStyleData->GetDataVersion() : 0;
+		parseParameter.imageData = FObjectKey(useImageData ? richTextImageData : nullptr);
+		parseParameter.imageDataVersion = useImageData ? richTextImageData->GetDataVersion() : 0;
+		auto parseCacheSize = CVarRichTextParseCacheSize.GetValueOnGameThread();
+		if (parseCacheSize > 0 && text.Len() > CVarRichTextParseCacheMaxLength.GetValueOnGameThread())
+		{
+			parseCacheSize = 0;
+		}
+		uint32 parseCacheHash = parseCacheSize > 0 ? RichTextParseCache::GetHash(text, parseParameter) : 0;
+		auto cacheEntry = parseCacheSize > 0 ? richTextParseCache.Find(parseCacheHash, text, parseParameter) : nullptr;
+		if (cacheEntry == nullptr)
+		{
+			static RichTextTokenArena richTextTokenArena;
+			static FString parsedRichTextContent;
+			UIGeometry_ParseRichText(text, richTextParser, richTextTokenArena
+				, useCustomStyle ? richTextCustomStyleData : nullptr, useImageData ? richTextImageData : nullptr
+				, richTextParseResult, parsedRichTextContent, parsedRichTextPropertyArray);
+			if (parseCacheSize > 0 && richTextParseCache.RecordMiss(parseCacheSize, parseCacheHash))
+			{
+				cacheEntry = richTextParseCache.Add(parseCacheSize, parseCacheHash, text, parseParameter, parsedRichTextContent, parsedRichTextPropertyArray);
+			}
+			contentPtr = &parsedRichTextContent;
+		}
+		if (cacheEntry != nullptr)
+		{
+			richTextPropertyArrayPtr = &cacheEntry->parseResultArray;
+			contentPtr = &cacheEntry->content;
 		}
 		//replace text content with parsed rich text content
-		content = richTextContent;
-		contentLength = richTextContent.Len();
+		contentLength = contentPtr->Len();
 	}
+	const FString& content = *contentPtr;
+	const TArray<RichTextParseResult>& richTextPropertyArray = *richTextPropertyArrayPtr;
 
 	bool hasClampContent = false;
 	int clamp_RestVerticesCount = 0;
@@ -2836,6 +2969,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 		{
 			FUIText_RichTextImageTag imageTagData;
 			imageTagData.TagName = richTextParseResult.imageTag;
+			imageTagData.ImageHandle = richTextParseResult.imageHandle;
 			imageTagData.Position = FVector2D(currentLineOffset.X + charGeo.xadvance * 0.5f, currentLineOffset.Y);
 			imageTagData.Size = charGeo.xadvance;
 			imageTagData.TintColor = richTextParseResult.hasColor ? richTextParseResult.color : FColor::White;
@@ -3081,6 +3215,153 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	}
 }
 
+DECLARE_CYCLE_STAT(TEXT("UIGeometry UpdateUITextChars"), STAT_UpdateUITextChars, STATGROUP_LGUI);
+bool UIGeometry::UpdateUITextChars(const FString& oldText, FStringView newText, const FColor& color, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
+	, EUITextFontStyle fontStyle, EUITextOverflowType overflowType
+	, ULGUICanvas* renderCanvas, UUIText* uiComp
+	, const TArray<FUITextCharProperty>& cacheCharPropertyArray
+	, ULGUIFontData_BaseObject* font
+	, FUITextCharsUpdateBuffer& updateBuffer
+	, FUITextGlyphCache* glyphCache)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UpdateUITextChars);
+
+	//ClampContent hide clamped chars by collapse their vertices, push glyph difference to them will make them visible
+	if (overflowType == EUITextOverflowType::ClampContent)return false;
+	int contentLength = newText.Len();
+	if (oldText.Len() != contentLength)return false;
+	auto& originVertices = uiGeo->originVertices;
+	auto& vertices = uiGeo->vertices;
+	if (vertices.Num() == 0 || originVertices.Num() != vertices.Num())return false;
+
+	float maxFontSize = font->GetFontSizeLimit();
+	fontSize = FMath::Clamp(fontSize, 0.0f, maxFontSize);
+	bool pixelPerfect = uiComp->GetShouldAffectByPixelPerfect() && renderCanvas->GetActualPixelPerfect();
+	float rootCanvasScale = renderCanvas->GetRootCanvas()->GetCanvasScale();
+	float dynamicPixelsPerUnit = renderCanvas->GetActualDynamicPixelsPerUnit() * rootCanvasScale;
+	bool shouldScaleFontSizeWithRootCanvas = false;
+	if (renderCanvas->GetRootCanvas()->IsRenderToWorldSpace())
+	{
+		pixelPerfect = false;
+		shouldScaleFontSizeWithRootCanvas = dynamicPixelsPerUnit != 1.0f && font->GetSupportDynamicPixelsPerUnit();
+	}
+	else
+	{
+		shouldScaleFontSizeWithRootCanvas = rootCanvasScale != 1.0f || (dynamicPixelsPerUnit != 1.0f && font->GetSupportDynamicPixelsPerUnit());
+	}
+	//same as UpdateUIText, glyph may render with scaled font size, then scale back to UIText's space
+	float charFontSize = fontSize, oneDivideCharScale = 1.0f;
+	if (shouldScaleFontSizeWithRootCanvas)
+	{
+		float charScale = (!pixelPerfect && dynamicPixelsPerUnit != 1.0f) ? dynamicPixelsPerUnit : rootCanvasScale;
+		charFontSize = FMath::Clamp(fontSize * charScale, 0.0f, maxFontSize);
+		oneDivideCharScale = 1.0f / charScale;
+	}
+	if (glyphCache != nullptr)
+	{
+		glyphCache->Prepare(font);
+	}
+
+	LGUIRichTextParser::RichTextParseResult richTextParseResult;
+	richTextParseResult.color = color;
+	richTextParseResult.bold = fontStyle == EUITextFontStyle::Bold || fontStyle == EUITextFontStyle::BoldAndItalic;
+	richTextParseResult.italic = fontStyle == EUITextFontStyle::Italic || fontStyle == EUITextFontStyle::BoldAndItalic;
+	richTextParseResult.size = fontSize;
+	//italic offset is not integer pixel, so pixel snap result could change
+	if (pixelPerfect && richTextParseResult.italic)return false;
+
+	auto IsInvisibleChar = [](TCHAR charCode) {
+		return charCode == ' ' || charCode == '\t' || charCode == '\n' || charCode == '\r';
+	};
+	auto GetCharGeo = [&](TCHAR charCode) {
+		auto charData = glyphCache != nullptr ? glyphCache->GetCharData(font, charCode, charFontSize) : font->GetCharData(charCode, charFontSize);
+		if (oneDivideCharScale != 1.0f)
+		{
+			charData.width *= oneDivideCharScale;
+			charData.height *= oneDivideCharScale;
+			charData.xadvance *= oneDivideCharScale;
+			charData.xoffset *= oneDivideCharScale;
+			charData.yoffset *= oneDivideCharScale;
+		}
+		return charData;
+	};
+
+	//collect changed char, and make sure layout is not affected
+	TArray<int32, TInlineAllocator<32>> changedCharArray;//visible char index of changed char
+	for (int charIndex = 0, visibleCharIndex = 0; charIndex < contentLength; charIndex++)
+	{
+		auto oldCharCode = oldText[charIndex];
+		auto newCharCode = newText[charIndex];
+		bool oldInvisible = IsInvisibleChar(oldCharCode);
+		if (oldInvisible != IsInvisibleChar(newCharCode))return false;
+		if (oldInvisible)
+		{
+			if (oldCharCode != newCharCode)return false;
+			continue;
+		}
+		if (oldCharCode != newCharCode)
+		{
+			if (visibleCharIndex >= cacheCharPropertyArray.Num())return false;
+			changedCharArray.Add(visibleCharIndex);
+		}
+		visibleCharIndex++;
+	}
+	if (changedCharArray.Num() == 0)return true;
+
+	font->PrepareForPushCharData(uiComp);
+	auto& oldCharOriginVertices = updateBuffer.oldCharOriginVertices;
+	auto& newCharOriginVertices = updateBuffer.newCharOriginVertices;
+	auto& oldCharVertices = updateBuffer.oldCharVertices;
+	auto& newCharVertices = updateBuffer.newCharVertices;
+	auto& charTriangles = updateBuffer.charTriangles;
+	TArray<TCHAR, TInlineAllocator<32>> oldCharCodeArray, newCharCodeArray;
+	TArray<FLGUICharData_HighPrecision, TInlineAllocator<32>> oldCharGeoArray, newCharGeoArray;
+	for (int charIndex = 0, visibleCharIndex = 0, changedIndex = 0; charIndex < contentLength && changedIndex < changedCharArray.Num(); charIndex++)
+	{
+		if (IsInvisibleChar(newText[charIndex]))continue;
+		if (changedCharArray[changedIndex] == visibleCharIndex)
+		{
+			//new glyph first, because render new glyph may expand font texture and scale down uv of cached glyph
+			auto newCharGeo = GetCharGeo(newText[charIndex]);
+			auto oldCharGeo = GetCharGeo(oldText[charIndex]);
+			if (newCharGeo.xadvance != oldCharGeo.xadvance)return false;//layout change
+			oldCharCodeArray.Add(oldText[charIndex]);
+			newCharCodeArray.Add(newText[charIndex]);
+			oldCharGeoArray.Add(oldCharGeo);
+			newCharGeoArray.Add(newCharGeo);
+			changedIndex++;
+		}
+		visibleCharIndex++;
+	}
+
+	//glyph quad position is linear with line offset, so push old and new glyph at zero offset and apply the difference.
+	//if anything not match then caller will do full update, so no need to restore modified chars.
+	for (int i = 0; i < changedCharArray.Num(); i++)
+	{
+		const auto& charProperty = cacheCharPropertyArray[changedCharArray[i]];
+		int oldVertCount, oldIndicesCount, newVertCount, newIndicesCount;
+		font->PushCharData(oldCharCodeArray[i], FVector2f::ZeroVector, fontSpace, oldCharGeoArray[i], richTextParseResult
+			, 0, 0, oldVertCount, oldIndicesCount, oldCharOriginVertices, oldCharVertices, charTriangles);
+		font->PushCharData(newCharCodeArray[i], FVector2f::ZeroVector, fontSpace, newCharGeoArray[i], richTextParseResult
+			, 0, 0, newVertCount, newIndicesCount, newCharOriginVertices, newCharVertices, charTriangles);
+		if (oldVertCount != newVertCount || newVertCount != charProperty.VertCount
+			|| charProperty.StartVertIndex + newVertCount > vertices.Num())
+		{
+			return false;
+		}
+		for (int vertIndex = 0; vertIndex < newVertCount; vertIndex++)
+		{
+			originVertices[charProperty.StartVertIndex + vertIndex].Position += newCharOriginVertices[vertIndex].Position - oldCharOriginVertices[vertIndex].Position;
+			auto& vert = vertices[charProperty.StartVertIndex + vertIndex];
+			for (int uvIndex = 0; uvIndex < LGUI_VERTEX_TEXCOORDINATE_COUNT; uvIndex++)
+			{
+				vert.TextureCoordinate[uvIndex] = newCharVertices[vertIndex].TextureCoordinate[uvIndex];
+			}
+		}
+	}
+	return true;
+}
+
 #pragma endregion
 
 void UIGeometry::OffsetVertices(TArray<FLGUIOriginVertexData>& vertices, int count, float offsetX, float offsetY)
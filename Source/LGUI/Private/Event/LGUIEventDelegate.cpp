@@ -3,6 +3,9 @@
 #include "Event/LGUIEventDelegate.h"
 #include "LGUI.h"
 #include "Serialization/MemoryReader.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "Components/SceneComponent.h"
 #if WITH_EDITOR
 #include "Utils/LGUIUtils.h"
 #endif
@@ -13,6 +16,14 @@ PRAGMA_DISABLE_OPTIMIZATION
 
 #define LOCTEXT_NAMESPACE "LGUIEventDelegate"
 
+DECLARE_CYCLE_STAT(TEXT("LGUIEventDelegate Execute"), STAT_LGUIEventDelegateExecute, STATGROUP_LGUI);
+
+static TAutoConsoleVariable<int32> CVarLGUIEventDelegateNativeInvoke(
+	TEXT("lgui.EventDelegate.NativeInvoke"),
+	1,
+	TEXT("1: LGUIEventDelegate call native C++ function's thunk directly, skip ProcessEvent.\n0: Always use ProcessEvent, for comparison or debug."),
+	ECVF_Default);
+
 bool ULGUIEventDelegateParameterHelper::IsFunctionCompatible(const UFunction* InFunction, ELGUIEventDelegateParameterType& OutParameterType)
 {
 	if (InFunction->GetReturnProperty() != nullptr)return false;//not support return value for ProcessEvent
@@ -575,6 +586,7 @@ bool FLGUIEventDelegateData::CheckTargetObject()
 void FLGUIEventDelegateData::FindAndExecute(UObject* Target, void* ParamData)
 {
 	CacheFunction = Target->FindFunction(functionName);
+	bInvocationPrepared = false;
 	if (CacheFunction)
 	{
 		if (!ULGUIEventDelegateParameterHelper::IsStillSupported(CacheFunction, ParamType))
@@ -609,49 +621,132 @@ void FLGUIEventDelegateData::FindAndExecute(UObject* Target, void* ParamData)
 }
 void FLGUIEventDelegateData::ExecuteTargetFunction(UObject* Target, UFunction* Func)
 {
+	SCOPE_CYCLE_COUNTER(STAT_LGUIEventDelegateExecute);
+	if (!bInvocationPrepared)
+	{
+		PrepareInvocation(Target, Func);
+	}
 	switch (ParamType)
 	{
 	case ELGUIEventDelegateParameterType::String:
 	{
-		FString TempString;
-		auto FromBinary = FMemoryReader(ParamBuffer, false);
-		FromBinary << TempString;
-		Target->ProcessEvent(Func, &TempString);
+		ConditionalUpdateCacheParameter();
+		InvokeFunction(Target, Func, &CacheStringValue);
 	}
 	break;
 	case ELGUIEventDelegateParameterType::Name:
 	{
-		FName TempName;
-		auto FromBinary = FMemoryReader(ParamBuffer, false);
-		FromBinary << TempName;
-		Target->ProcessEvent(Func, &TempName);
+		ConditionalUpdateCacheParameter();
+		InvokeFunction(Target, Func, &CacheNameValue);
 	}
 	break;
 	case ELGUIEventDelegateParameterType::Text:
 	{
-		FText TempText;
-		auto FromBinary = FMemoryReader(ParamBuffer, false);
-		FromBinary << TempText;
-		Target->ProcessEvent(Func, &TempText);
+		ConditionalUpdateCacheParameter();
+		InvokeFunction(Target, Func, &CacheTextValue);
 	}
 	break;
 	case ELGUIEventDelegateParameterType::Object:
 	case ELGUIEventDelegateParameterType::Actor:
 	case ELGUIEventDelegateParameterType::Class:
 	{
-		Target->ProcessEvent(Func, &ReferenceObject);
+		InvokeFunction(Target, Func, &ReferenceObject);
 	}
 	break;
 	default:
 	{
-		Target->ProcessEvent(Func, ParamBuffer.GetData());
+		InvokeFunction(Target, Func, ParamBuffer.GetData());
 	}
 	break;
 	}
 }
 void FLGUIEventDelegateData::ExecuteTargetFunction(UObject* Target, UFunction* Func, void* ParamData)
 {
-	Target->ProcessEvent(Func, ParamData);
+	SCOPE_CYCLE_COUNTER(STAT_LGUIEventDelegateExecute);
+	if (!bInvocationPrepared)
+	{
+		PrepareInvocation(Target, Func);
+	}
+	InvokeFunction(Target, Func, ParamData);
+}
+void FLGUIEventDelegateData::ConditionalUpdateCacheParameter()
+{
+	if (bCacheParameterValid && CacheParamBuffer == ParamBuffer)return;
+	bCacheParameterValid = true;
+	CacheParamBuffer = ParamBuffer;
+	auto FromBinary = FMemoryReader(ParamBuffer, false);
+	switch (ParamType)
+	{
+	case ELGUIEventDelegateParameterType::String:
+	{
+		FromBinary << CacheStringValue;
+	}
+	break;
+	case ELGUIEventDelegateParameterType::Name:
+	{
+		FromBinary << CacheNameValue;
+	}
+	break;
+	case ELGUIEventDelegateParameterType::Text:
+	{
+		FromBinary << CacheTextValue;
+	}
+	break;
+	}
+}
+void FLGUIEventDelegateData::PrepareInvocation(UObject* Target, UFunction* Func)
+{
+	bInvocationPrepared = true;
+	bCacheParameterValid = false;//parameter type could change with function, deserialize again
+
+	//only plain native function can skip ProcessEvent. blueprint function, event (could be overrided by blueprint), rpc and authority/cosmetic function still need ProcessEvent.
+	bUseNativeInvoke = Func->HasAnyFunctionFlags(FUNC_Native)
+		&& !Func->HasAnyFunctionFlags(FUNC_Net | FUNC_Event | FUNC_BlueprintEvent | FUNC_Static | FUNC_BlueprintAuthorityOnly | FUNC_BlueprintCosmetic)
+		&& Func->GetNativeFunc() != nullptr;
+	if (bUseNativeInvoke)
+	{
+		CacheNativeFunc = Func->GetNativeFunc();
+		bNativeInvokeTargetIsActor = Target->IsA<AActor>();
+		CacheOutParmProperty = nullptr;
+		if (Func->HasAnyFunctionFlags(FUNC_HasOutParms))
+		{
+			for (TFieldIterator<FProperty> It(Func); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+			{
+				if (It->HasAnyPropertyFlags(CPF_OutParm))
+				{
+					CacheOutParmProperty = *It;
+					break;
+				}
+			}
+		}
+	}
+}
+void FLGUIEventDelegateData::InvokeFunction(UObject* Target, UFunction* Func, void* ParamData)
+{
+	bool bCanUseNativeInvoke = bUseNativeInvoke && CVarLGUIEventDelegateNativeInvoke.GetValueOnGameThread() != 0;
+	if (bCanUseNativeInvoke && bNativeInvokeTargetIsActor)//same as AActor::ProcessEvent, actor can only execute function after initialized
+	{
+		auto World = Target->GetWorld();
+		bCanUseNativeInvoke = World != nullptr && World->AreActorsInitialized() && !IsGarbageCollecting();
+	}
+	if (bCanUseNativeInvoke)
+	{
+		//parameter is already in right layout (function only have one parameter), so use it as locals directly, no need to copy
+		FFrame Stack(Target, Func, (uint8*)ParamData, nullptr, Func->ChildProperties);
+		FOutParmRec OutParm;
+		if (CacheOutParmProperty != nullptr)
+		{
+			OutParm.Property = CacheOutParmProperty;
+			OutParm.PropAddr = (uint8*)ParamData;
+			OutParm.NextOutParm = nullptr;
+			Stack.OutParms = &OutParm;
+		}
+		CacheNativeFunc(Target, Stack, nullptr);
+	}
+	else
+	{
+		Target->ProcessEvent(Func, ParamData);
+	}
 }
 
 FLGUIEventDelegate::FLGUIEventDelegate()
@@ -939,6 +1034,52 @@ bool FLGUIEventDelegate::CheckFunctionParameter()const
 }
 #endif
 
+#if !UE_BUILD_SHIPPING
+/** Fire LGUIEventDelegate with ProcessEvent and with native invoke, to compare the cost. */
+struct FLGUIEventDelegateBenchmark
+{
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 ListenerCount = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+		const int32 FireCount = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 1000;
+
+		//plain native function without world dependency
+		auto Target = NewObject<USceneComponent>(GetTransientPackage());
+		Target->AddToRoot();
+		FLGUIEventDelegate Event(ELGUIEventDelegateParameterType::Empty);
+		Event.eventList.SetNum(ListenerCount);
+		for (auto& Item : Event.eventList)
+		{
+			Item.TargetObject = Target;
+			Item.functionName = GET_FUNCTION_NAME_CHECKED(UActorComponent, SetAutoActivate);
+			Item.ParamType = ELGUIEventDelegateParameterType::Bool;
+			Item.ParamBuffer.Add(1);
+		}
+		auto FireWith = [&](int32 NativeInvoke) {
+			CVarLGUIEventDelegateNativeInvoke->Set(NativeInvoke, ECVF_SetByConsole);
+			Event.FireEvent();//find and prepare function
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < FireCount; i++)
+			{
+				Event.FireEvent();
+			}
+			return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		};
+		const int32 PrevNativeInvoke = CVarLGUIEventDelegateNativeInvoke.GetValueOnGameThread();
+		const double ProcessEventTime = FireWith(0);
+		const double NativeInvokeTime = FireWith(1);
+		CVarLGUIEventDelegateNativeInvoke->Set(PrevNativeInvoke, ECVF_SetByConsole);
+		Target->RemoveFromRoot();
+
+		UE_LOG(LGUI, Log, TEXT("[%s] %d listeners x %d fires, ProcessEvent: %.3fms, NativeInvoke: %.3fms"), ANSI_TO_TCHAR(__FUNCTION__), ListenerCount, FireCount, ProcessEventTime, NativeInvokeTime);
+	}
+};
+static FAutoConsoleCommand LGUIEventDelegateBenchmarkCommand(
+	TEXT("lgui.EventDelegate.Benchmark"),
+	TEXT("Fire LGUIEventDelegate with and without lgui.EventDelegate.NativeInvoke, and log the time. Args: [ListenerCount=100] [FireCount=1000]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FLGUIEventDelegateBenchmark::Run));
+#endif
+
 #undef LOCTEXT_NAMESPACE
 
 #if LGUI_CAN_DISABLE_OPTIMIZATION
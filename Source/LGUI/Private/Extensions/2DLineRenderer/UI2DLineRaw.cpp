@@ -32,14 +32,32 @@ AUI2DLineActor::AUI2DLineActor()
 
 void UUI2DLineRaw::SetPoints(const TArray<FVector2D>& InPoints)
 {
-	if (InPoints.Num() != PointArray.Num())
+	bool bCountChanged = InPoints.Num() != PointArray.Num();
+	PointArray = InPoints;
+	MarkPointsDirty(0, MAX_int32, bCountChanged);
+}
+void UUI2DLineRaw::AddPoint(const FVector2D& InPoint)
+{
+	auto Index = PointArray.Add(InPoint);
+	MarkPointsDirty(Index, Index, true);
+}
+void UUI2DLineRaw::RemoveLastPoint()
+{
+	if (PointArray.Num() == 0)return;
+	PointArray.Pop(false);
+	auto Index = FMath::Max(PointArray.Num() - 1, 0);
+	MarkPointsDirty(Index, Index, true);
+}
+void UUI2DLineRaw::SetPoint(int32 InIndex, const FVector2D& InPoint)
+{
+	if (!PointArray.IsValidIndex(InIndex))
 	{
-		PointArray = InPoints;
-		MarkVerticesDirty(true, true, true, true);
+		UE_LOG(LGUI, Error, TEXT("[%s].%d Index out of range, index: %d, point count: %d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, InIndex, PointArray.Num());
+		return;
 	}
-	else
+	if (PointArray[InIndex] != InPoint)
 	{
-		PointArray = InPoints;
-		MarkVertexPositionDirty();
+		PointArray[InIndex] = InPoint;
+		MarkPointsDirty(InIndex, InIndex, false);
 	}
 }
@@ -7,6 +7,9 @@
 #include "Core/LGUISpriteData_BaseObject.h"
 #include "LTweenManager.h"
 #include "Core/LGUISettings.h"
+#include "Extensions/2DLineRenderer/UI2DLineRaw.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
 
 DECLARE_CYCLE_STAT(TEXT("UI2DLine Update"), STAT_2DLineUpdate, STATGROUP_LGUI);
 
@@ -21,14 +24,14 @@ void UUI2DLineRendererBase::BeginPlay()
 	Super::BeginPlay();
 }
 
-void UUI2DLineRendererBase::Update2DLineRendererBaseUV(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray)
+void UUI2DLineRendererBase::Update2DLineRendererBaseUV(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray, int32 InStartPointIndex)
 {
 	auto& vertices = InGeo.vertices;
 	int pointCount = InPointArray.Num();
 
 	const auto& spriteInfo = sprite->GetSpriteInfo();
 	float uvY = (spriteInfo.uv0Y + spriteInfo.uv3Y) * 0.5f;
-	int i = 0; 
+	int i = FMath::Max(InStartPointIndex, 0);
 	for (; i < pointCount; i++)
 	{
 		auto& uvi0 = vertices[i + i].TextureCoordinate[0];
@@ -61,12 +64,12 @@ void UUI2DLineRendererBase::Update2DLineRendererBaseUV(UIGeometry& InGeo, const
 	}
 }
 
-void UUI2DLineRendererBase::Update2DLineRendererBaseTriangle(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray)
+void UUI2DLineRendererBase::Update2DLineRendererBaseTriangle(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray, int32 InStartPointIndex)
 {
 	int pointCount = InPointArray.Num();
 	auto& triangles = InGeo.triangles;
 
-	int pointIndex = 0;
+	int pointIndex = FMath::Clamp(InStartPointIndex, 0, pointCount - 1);
 	int vertIndex = 0, triangleIndex = 0;
 	for (int count = pointCount - 1; pointIndex < count; pointIndex++)
 	{
@@ -119,7 +122,7 @@ void UUI2DLineRendererBase::Update2DLineRendererBaseTriangle(UIGeometry& InGeo,
 	}
 }
 
-void UUI2DLineRendererBase::Update2DLineRendererBaseVertex(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray)
+void UUI2DLineRendererBase::Update2DLineRendererBaseVertex(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray, int32 InStartPointIndex, int32 InEndPointIndex, bool InUpdateStartPoint)
 {
 	int pointCount = InPointArray.Num();
 	//pivot offset
@@ -141,7 +144,7 @@ void UUI2DLineRendererBase::Update2DLineRendererBaseVertex(UIGeometry& InGeo, co
 		originVertices[0].Position = FVector3f(0, pos0.X + pivotOffsetX, pos0.Y + pivotOffsetY);
 		originVertices[1].Position = FVector3f(0, pos1.X + pivotOffsetX, pos1.Y + pivotOffsetY);
 	}
-	else
+	else if (InUpdateStartPoint || InStartPointIndex <= 0)
 	{
 		//start point
 		FVector2D v0 = InPointArray[0];
@@ -190,10 +193,22 @@ void UUI2DLineRendererBase::Update2DLineRendererBaseVertex(UIGeometry& InGeo, co
 		}
 	}
 
-	int i = 1;
+	int i = FMath::Max(InStartPointIndex, 1);
+	if (i > 1 || !(InUpdateStartPoint || InStartPointIndex <= 0))//start from middle, line direction of previous point is needed. @see CanStartTessellationFromPoint
+	{
+		if (i - 1 == 0)
+		{
+			float magnitude;
+			(InPointArray[1] - InPointArray[0]).ToDirectionAndLength(prevLineDir, magnitude);
+		}
+		else
+		{
+			prevLineDir = (InPointArray[i] - InPointArray[i - 1]).GetSafeNormal();
+		}
+	}
 	if (pointCount >= 3)
 	{
-		for (; i < pointCount - 1; i++)
+		for (; i < pointCount - 1 && i <= InEndPointIndex; i++)
 		{
 			FVector2D posA, posB;
 			GenerateLinePoint(InPointArray[i], InPointArray[i - 1], InPointArray[i + 1], lineLeftWidth, lineRightWidth, posA, posB, prevLineDir);
@@ -202,7 +217,8 @@ void UUI2DLineRendererBase::Update2DLineRendererBaseVertex(UIGeometry& InGeo, co
 		}
 	}
 
-	auto i2 = i + i;
+	if (InEndPointIndex < pointCount - 1)return;//end point and end cap not changed, caller extend the range to last point if point count change
+	auto i2 = (pointCount - 1) * 2;
 	if (CanConnectStartEndPoint(pointCount))
 	{
 		FVector2D posA, posB;
@@ -309,6 +325,60 @@ void UUI2DLineRendererBase::GenerateLinePoint(const FVector2D& InCurrentPoint, c
 }
 
 
+void UUI2DLineRendererBase::MarkPointsDirty(int32 InStartPointIndex, int32 InEndPointIndex, bool InPointCountChanged)
+{
+	if (DirtyPointStartIndex == INDEX_NONE)
+	{
+		DirtyPointStartIndex = InStartPointIndex;
+		DirtyPointEndIndex = InEndPointIndex;
+	}
+	else
+	{
+		DirtyPointStartIndex = FMath::Min(DirtyPointStartIndex, InStartPointIndex);
+		DirtyPointEndIndex = FMath::Max(DirtyPointEndIndex, InEndPointIndex);
+	}
+	if (InPointCountChanged)
+	{
+		MarkVerticesDirty(true, true, true, true);
+	}
+	else
+	{
+		MarkVertexPositionDirty();
+	}
+}
+
+UUI2DLineRendererBase::F2DLineTessellationState UUI2DLineRendererBase::MakeTessellationState()const
+{
+	F2DLineTessellationState Result;
+	UIGeometry::CalculatePivotOffset(this->GetWidth(), this->GetHeight(), FVector2f(this->GetPivot()), Result.PivotOffsetX, Result.PivotOffsetY);
+	Result.LineWidth = LineWidth;
+	Result.LineWidthOffset = LineWidthOffset;
+	Result.EndType = EndType;
+	Result.bEndCapSizeAffectByLineWidth = bEndCapSizeAffectByLineWidth;
+	Result.bRequireNormalOrTangent = RenderCanvas.IsValid() && (RenderCanvas->GetRequireNormal() || RenderCanvas->GetRequireTangent());
+	Result.Sprite = sprite;
+	if (IsValid(sprite))
+	{
+		const auto& spriteInfo = sprite->GetSpriteInfo();
+		Result.SpriteUV = FVector4f(spriteInfo.uv0X, spriteInfo.uv0Y, spriteInfo.uv3X, spriteInfo.uv3Y);
+		Result.SpriteSizeAndBorder = FIntVector4(spriteInfo.width, spriteInfo.height, spriteInfo.borderTop, spriteInfo.borderBottom);
+	}
+	Result.Color = GetFinalColor();
+	return Result;
+}
+
+bool UUI2DLineRendererBase::CanStartTessellationFromPoint(const TArray<FVector2D>& InPointArray, int32 InPointIndex)
+{
+	if (InPointIndex <= 0)return true;
+	//same as Update2DLineRendererBaseVertex, line direction is carried from previous point, and will not change if previous point is degenerated
+	if (InPointIndex - 1 == 0)
+	{
+		return !OverrideStartPointTangentDirection() && (InPointArray[1] - InPointArray[0]).Size() >= KINDA_SMALL_NUMBER;
+	}
+	return InPointArray[InPointIndex] != InPointArray[InPointIndex - 1] && InPointArray[InPointIndex - 1] != InPointArray[InPointIndex - 2];
+}
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("UI2DLine Tessellated Points"), STAT_2DLineTessellatedPoints, STATGROUP_LGUI);
 void UUI2DLineRendererBase::OnUpdateGeometry(UIGeometry& InGeo, bool InTriangleChanged, bool InVertexPositionChanged, bool InVertexUVChanged, bool InVertexColorChanged)
 {
 	SCOPE_CYCLE_COUNTER(STAT_2DLineUpdate);
@@ -317,10 +387,50 @@ void UUI2DLineRendererBase::OnUpdateGeometry(UIGeometry& InGeo, bool InTriangleC
 	if (pointCount < 2)
 	{
 		geometry->Clear();
+		bHasPrevTessellationState = false;
+		bLastTessellationIncremental = false;
+		DirtyPointStartIndex = DirtyPointEndIndex = INDEX_NONE;
 		return;
 	}
 	
 	auto& triangles = InGeo.triangles;
+	auto& vertices = InGeo.vertices;
+	auto& originVertices = InGeo.originVertices;
+
+	//check if we can only tessellate changed points
+	auto TessellationState = MakeTessellationState();
+	int32 UpdateStartPointIndex = 0, UpdateEndPointIndex = pointCount - 1;
+	bool bUpdateStartPoint = true;
+	bLastTessellationIncremental = false;
+	if (DirtyPointStartIndex != INDEX_NONE
+		&& bHasPrevTessellationState
+		&& PrevPointCount >= 2
+		&& !CanConnectStartEndPoint(pointCount) && !CanConnectStartEndPoint(PrevPointCount)
+		&& &InGeo == PrevGeometry//geometry modifier stage change will swap to another geometry
+		&& originVertices.Max() >= PrevVertexCount && vertices.Max() >= PrevVertexCount && triangles.Max() >= PrevTriangleIndicesCount//data from last tessellation is still in memory
+		&& TessellationState == PrevTessellationState
+		)
+	{
+		//neighbour point's joint is affected too
+		UpdateStartPointIndex = FMath::Clamp(DirtyPointStartIndex - 1, 0, pointCount - 1);
+		UpdateEndPointIndex = FMath::Clamp(DirtyPointEndIndex, 0, pointCount - 2) + 1;
+		//vertex index of points after the changed one and the end cap follow point count, so update to the end
+		if (pointCount != PrevPointCount)
+		{
+			UpdateEndPointIndex = pointCount - 1;
+		}
+		if (!CanStartTessellationFromPoint(CurrentPointArray, UpdateStartPointIndex))
+		{
+			UpdateStartPointIndex = 0;
+		}
+		//start cap's vertex index is after all points, so need to update it if point count change
+		bUpdateStartPoint = UpdateStartPointIndex == 0 || (pointCount != PrevPointCount && EndType == EUI2DLineRenderer_EndType::Cap);
+		bLastTessellationIncremental = true;
+	}
+	DirtyPointStartIndex = DirtyPointEndIndex = INDEX_NONE;
+	//NOTE: this only limit tessellation work. UIBatchMeshRenderable still call UIGeometry::TransformVertices for all vertices after vertex position change, so an incremental update is still O(n) on vertex count.
+	INC_DWORD_STAT_BY(STAT_2DLineTessellatedPoints, UpdateEndPointIndex - UpdateStartPointIndex + 1);
+
 	int triangleIndicesCount = (pointCount - 1) * 2 * 3;
 	if (CanConnectStartEndPoint(pointCount))
 	{
@@ -333,11 +443,9 @@ void UUI2DLineRendererBase::OnUpdateGeometry(UIGeometry& InGeo, bool InTriangleC
 	UIGeometry::LGUIGeometrySetArrayNum(triangles, triangleIndicesCount);
 	if (InTriangleChanged)
 	{
-		Update2DLineRendererBaseTriangle(InGeo, CurrentPointArray);
+		Update2DLineRendererBaseTriangle(InGeo, CurrentPointArray, UpdateStartPointIndex);
 	}
 
-	auto& vertices = InGeo.vertices;
-	auto& originVertices = InGeo.originVertices;
 	int vertexCount = pointCount * 2;
 	if (EndType == EUI2DLineRenderer_EndType::Cap)
 	{
@@ -345,31 +453,50 @@ void UUI2DLineRendererBase::OnUpdateGeometry(UIGeometry& InGeo, bool InTriangleC
 	}
 	UIGeometry::LGUIGeometrySetArrayNum(vertices, vertexCount);
 	UIGeometry::LGUIGeometrySetArrayNum(originVertices, vertexCount);
+	//caps are at the end of vertex array, so vertices from this index to the end need to be updated
+	int32 UpdateStartVertexIndex = UpdateStartPointIndex * 2;
 	if (InVertexUVChanged || InVertexPositionChanged || InVertexColorChanged)
 	{
 		if (InVertexPositionChanged)
 		{
-			Update2DLineRendererBaseVertex(InGeo, CurrentPointArray);
+			Update2DLineRendererBaseVertex(InGeo, CurrentPointArray, UpdateStartPointIndex, UpdateEndPointIndex, bUpdateStartPoint);
 		}
 		if (InVertexUVChanged)
 		{
-			Update2DLineRendererBaseUV(InGeo, CurrentPointArray);
+			Update2DLineRendererBaseUV(InGeo, CurrentPointArray, UpdateStartPointIndex);
 		}
 		if (InVertexColorChanged)
 		{
-			UIGeometry::UpdateUIColor(&InGeo, GetFinalColor());
+			if (UpdateStartVertexIndex == 0)
+			{
+				UIGeometry::UpdateUIColor(&InGeo, TessellationState.Color);
+			}
+			else
+			{
+				for (int i = UpdateStartVertexIndex; i < vertexCount; i++)
+				{
+					vertices[i].Color = TessellationState.Color;
+				}
+			}
 		}
 
 		//normal & tangent
-		if (RenderCanvas->GetRequireNormal() || RenderCanvas->GetRequireTangent())
+		if (TessellationState.bRequireNormalOrTangent)
 		{
-			for (int i = 0; i < originVertices.Num(); i++)
+			for (int i = UpdateStartVertexIndex; i < originVertices.Num(); i++)
 			{
 				originVertices[i].Normal = FVector3f(-1, 0, 0);
 				originVertices[i].Tangent = FVector3f(0, 1, 0);
 			}
 		}
 	}
+
+	PrevTessellationState = TessellationState;
+	bHasPrevTessellationState = true;
+	PrevPointCount = pointCount;
+	PrevVertexCount = vertexCount;
+	PrevTriangleIndicesCount = triangleIndicesCount;
+	PrevGeometry = &InGeo;
 }
 
 void UUI2DLineRendererBase::OnBeforeCreateOrUpdateGeometry()
@@ -433,4 +560,112 @@ ULTweener* UUI2DLineRendererBase::LineWidthTo(float endValue, float duration, fl
 		Tweener->SetEase(easeType)->SetDelay(delay)->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
 	}
 	return Tweener;
-}
\ No newline at end of file
+}
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Edit points of a line in the same way as UIBatchMeshRenderable do (clear geometry then OnUpdateGeometry), and compare result with a full tessellation of the same points.
+ * Also check that incremental tessellation is actually used.
+ */
+struct FLGUI2DLineIncrementalUpdateCheck
+{
+	static void Tessellate(UUI2DLineRendererBase* InLine, UIGeometry& InGeo, bool InPointCountChanged)
+	{
+		InLine->CalculatePoints();
+		InGeo.Clear();
+		InLine->OnUpdateGeometry(InGeo, InPointCountChanged, true, InPointCountChanged, InPointCountChanged);
+	}
+	static bool IsSameGeometry(const UIGeometry& A, const UIGeometry& B)
+	{
+		if (A.originVertices.Num() != B.originVertices.Num() || A.vertices.Num() != B.vertices.Num() || A.triangles.Num() != B.triangles.Num())
+		{
+			return false;
+		}
+		for (int i = 0; i < A.originVertices.Num(); i++)
+		{
+			if (!A.originVertices[i].Position.Equals(B.originVertices[i].Position, KINDA_SMALL_NUMBER))return false;
+		}
+		for (int i = 0; i < A.vertices.Num(); i++)
+		{
+			if (A.vertices[i].Color != B.vertices[i].Color)return false;
+			if (!A.vertices[i].TextureCoordinate[0].Equals(B.vertices[i].TextureCoordinate[0], KINDA_SMALL_NUMBER))return false;
+		}
+		for (int i = 0; i < A.triangles.Num(); i++)
+		{
+			if (A.triangles[i] != B.triangles[i])return false;
+		}
+		return true;
+	}
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 PointCount = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200, 4);
+		const int32 RoundCount = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 100, 1);
+
+		FRandomStream Random(PointCount);
+		auto RandomPoint = [&Random] {
+			return FVector2D(Random.FRandRange(-500, 500), Random.FRandRange(-500, 500));
+		};
+		TArray<FVector2D> Points;
+		for (int i = 0; i < PointCount; i++)
+		{
+			Points.Add(RandomPoint());
+		}
+
+		auto IncrementalLine = NewObject<UUI2DLineRaw>(GetTransientPackage());
+		auto FullLine = NewObject<UUI2DLineRaw>(GetTransientPackage());
+		UIGeometry IncrementalGeo, FullGeo;
+		IncrementalLine->SetPoints(Points);
+		Tessellate(IncrementalLine, IncrementalGeo, true);
+
+		int32 IncrementalCount = 0, MismatchCount = 0;
+		double IncrementalTime = 0, FullTime = 0;
+		for (int Round = 0; Round < RoundCount; Round++)
+		{
+			//append, remove last or move a point, like a realtime chart
+			bool bPointCountChanged = true;
+			const int32 Operation = Random.RandRange(0, 2);
+			if (Operation == 0)
+			{
+				IncrementalLine->AddPoint(RandomPoint());
+			}
+			else if (Operation == 1 && IncrementalLine->GetPoints().Num() > 3)
+			{
+				IncrementalLine->RemoveLastPoint();
+			}
+			else
+			{
+				IncrementalLine->SetPoint(Random.RandRange(0, IncrementalLine->GetPoints().Num() - 1), RandomPoint());
+				bPointCountChanged = false;
+			}
+			auto StartTime = FPlatformTime::Seconds();
+			Tessellate(IncrementalLine, IncrementalGeo, bPointCountChanged);
+			IncrementalTime += FPlatformTime::Seconds() - StartTime;
+			if (IncrementalLine->bLastTessellationIncremental)
+			{
+				IncrementalCount++;
+			}
+
+			FullLine->SetPoints(IncrementalLine->GetPoints());
+			FullLine->bHasPrevTessellationState = false;
+			StartTime = FPlatformTime::Seconds();
+			Tessellate(FullLine, FullGeo, true);
+			FullTime += FPlatformTime::Seconds() - StartTime;
+
+			if (!IsSameGeometry(IncrementalGeo, FullGeo))
+			{
+				MismatchCount++;
+			}
+		}
+		IncrementalLine->MarkAsGarbage();
+		FullLine->MarkAsGarbage();
+
+		const bool bPass = MismatchCount == 0 && IncrementalCount > 0;
+		UE_LOG(LGUI, Log, TEXT("[%s] %s. PointCount: %d, RoundCount: %d, incremental tessellation used: %d, mismatch with full tessellation: %d, incremental: %.3fms, full: %.3fms")
+			, ANSI_TO_TCHAR(__FUNCTION__), bPass ? TEXT("PASS") : TEXT("FAIL"), PointCount, RoundCount, IncrementalCount, MismatchCount, IncrementalTime * 1000, FullTime * 1000);
+	}
+};
+static FAutoConsoleCommand LGUI2DLineIncrementalUpdateCheckCommand(
+	TEXT("lgui.2DLine.IncrementalUpdateCheck"),
+	TEXT("Edit points of a line and check incremental tessellation is used and match full tessellation. Args: [PointCount=200] [RoundCount=100]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FLGUI2DLineIncrementalUpdateCheck::Run));
+#endif
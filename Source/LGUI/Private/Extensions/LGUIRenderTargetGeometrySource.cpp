@@ -17,6 +17,8 @@
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "LTweenBPLibrary.h"
 #include "RayTracingInstance.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 #if WITH_EDITOR
 #include "PrefabSystem/LGUIPrefabManager.h"
 #endif
@@ -757,6 +759,7 @@ bool ULGUIRenderTargetGeometrySource::ContainsPhysicsTriMeshData(bool InUseAllTr
 {
 	if (!GetRenderTarget())return false;
 	if (GeometryMode == ELGUIRenderTargetGeometryMode::StaticMesh)return false;
+	if (bUseSimpleCollision)return false;
 	if (Vertices.Num() == 0 || Triangles.Num() == 0)return false;
 	return true;
 }
@@ -958,6 +961,10 @@ bool ULGUIRenderTargetGeometrySource::CanEditChange(const FProperty* InProperty)
 		{
 			return GeometryMode != ELGUIRenderTargetGeometryMode::StaticMesh;
 		}
+		else if (PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ULGUIRenderTargetGeometrySource, bUseSimpleCollision))
+		{
+			return GeometryMode != ELGUIRenderTargetGeometryMode::StaticMesh;
+		}
 	}
 
 	return Super::CanEditChange(InProperty);
@@ -1068,6 +1075,15 @@ void ULGUIRenderTargetGeometrySource::SetCylinderArcAngle(float Value)
 	}
 }
 
+void ULGUIRenderTargetGeometrySource::SetUseSimpleCollision(bool Value)
+{
+	if (bUseSimpleCollision != Value)
+	{
+		bUseSimpleCollision = Value;
+		UpdateCollision();
+	}
+}
+
 void ULGUIRenderTargetGeometrySource::SetEnableInteractOnBackside(bool Value)
 {
 	if (bEnableInteractOnBackside != Value)
@@ -1115,7 +1131,7 @@ void ULGUIRenderTargetGeometrySource::UpdateBodySetup(bool bIsDirty)
 	if (!BodySetup || bIsDirty)
 	{
 		BodySetup = NewObject<UBodySetup>(this);
-		BodySetup->CollisionTraceFlag = CTF_UseDefault;
+		BodySetup->CollisionTraceFlag = bUseSimpleCollision ? CTF_UseSimpleAsComplex : CTF_UseDefault;
 		BodySetup->AggGeom.BoxElems.Add(FKBoxElem());
 		BodySetup->bHasCookedCollisionData = false;
 
@@ -1124,11 +1140,16 @@ void ULGUIRenderTargetGeometrySource::UpdateBodySetup(bool bIsDirty)
 		const float Width = ComputeComponentWidth();
 		const float Height = ComputeComponentHeight();
 		const float Thickness = ComputeComponentThickness();
-		const FVector Origin = FVector(.5f,
+		FVector Origin = FVector(.5f,
 			Width * (0.5f - Pivot.X),
 			Height * (0.5f - Pivot.Y));
 
 		BoxElem->X = Thickness;
+		if (bUseSimpleCollision)//box is the only collision, so it must cover the cylinder's bulge, and have thickness to be hit
+		{
+			Origin.X = FMath::Sign(CylinderArcAngle) * Thickness * 0.5f;
+			BoxElem->X = FMath::Max(Thickness, 1.0f);
+		}
 		BoxElem->Y = Width;
 		BoxElem->Z = Height;
 
@@ -1262,8 +1283,143 @@ float ULGUIRenderTargetGeometrySource::ComputeComponentThickness() const
 	}
 }
 
-#include "Kismet/GameplayStatics.h"
+bool ULGUIRenderTargetGeometrySource::LineTraceCylinderSegment(int32 InSegment, const FVector& InLocalRayStart, const FVector& InLocalRayEnd, float& OutHitT, FVector2D& OutHitUV)const
+{
+	const int32 NumSegments = (Vertices.Num() - 2) / 2;
+	if (InSegment < 0 || InSegment >= NumSegments)return false;
+	//segment quad's bottom edge, from vertex of this segment to next segment
+	auto Position0 = (FVector)Vertices[InSegment * 2].Position;
+	auto Position2 = (FVector)Vertices[(InSegment + 1) * 2].Position;
+	auto Y = Position2 - Position0;
+	auto SegmentLength = Y.Size();
+	if (SegmentLength <= KINDA_SMALL_NUMBER)return false;
+	Y /= SegmentLength;
+	auto X = FVector::CrossProduct(Y, FVector(0, 0, 1));//X is segment's backside direction
+
+	auto StartDist = FVector::DotProduct(InLocalRayStart - Position0, X);
+	auto EndDist = FVector::DotProduct(InLocalRayEnd - Position0, X);
+	//start and end point must be different side of segment plane
+	if (FMath::Sign(StartDist) == FMath::Sign(EndDist))return false;
+	if (StartDist > 0 && !bEnableInteractOnBackside)return false;//ray origin is on backside but backside can't interact
+
+	auto T = StartDist / (StartDist - EndDist);
+	auto HitPoint = InLocalRayStart + (InLocalRayEnd - InLocalRayStart) * T;
+	auto HitY = FVector::DotProduct(HitPoint - Position0, Y);
+	auto HitZ = HitPoint.Z - Position0.Z;
+	auto Height = (float)GetRenderTargetSize().Y;
+	if (HitY > 0 && HitY < SegmentLength && HitZ > 0 && HitZ < Height)
+	{
+		const float UVInterval = 1.0f / NumSegments;
+		OutHitUV.X = InSegment * UVInterval + UVInterval * HitY / SegmentLength;
+		OutHitUV.Y = HitZ / Height;
+		OutHitT = T;
+		return true;
+	}
+	return false;
+}
+
+bool ULGUIRenderTargetGeometrySource::LineTraceHitUVAnalytic(const FVector& InLineStart, const FVector& InLineEnd, FVector2D& OutHitUV)const
+{
+	auto InverseTf = GetComponentTransform().Inverse();
+	auto LocalRayStart = InverseTf.TransformPosition(InLineStart);
+	auto LocalRayEnd = InverseTf.TransformPosition(InLineEnd);
+	auto RenderTargetSize = this->GetRenderTargetSize();
+
+	switch (GeometryMode)
+	{
+	default:
+	case ELGUIRenderTargetGeometryMode::Plane:
+	{
+		//plane is at X = 0, backside is +X
+		if (FMath::Sign(LocalRayStart.X) == FMath::Sign(LocalRayEnd.X))return false;
+		if (LocalRayStart.X > 0 && !bEnableInteractOnBackside)return false;
+		auto T = LocalRayStart.X / (LocalRayStart.X - LocalRayEnd.X);
+		auto HitPoint = LocalRayStart + (LocalRayEnd - LocalRayStart) * T;
+		OutHitUV.X = HitPoint.Y / RenderTargetSize.X + Pivot.X;
+		OutHitUV.Y = HitPoint.Z / RenderTargetSize.Y + Pivot.Y;
+		return OutHitUV.X >= 0 && OutHitUV.X <= 1 && OutHitUV.Y >= 0 && OutHitUV.Y <= 1;
+	}
+	break;
+	case ELGUIRenderTargetGeometryMode::Cylinder:
+	{
+		const int32 NumSegments = (Vertices.Num() - 2) / 2;
+		if (NumSegments <= 0)return false;
+
+		float NearestT = MAX_flt;
+		FVector2D SegmentHitUV;
+		float SegmentHitT;
+		auto TestSegment = [&](int32 InSegment) {
+			if (LineTraceCylinderSegment(InSegment, LocalRayStart, LocalRayEnd, SegmentHitT, SegmentHitUV) && SegmentHitT < NearestT)
+			{
+				NearestT = SegmentHitT;
+				OutHitUV = SegmentHitUV;
+			}
+		};
+
+		const float ArcAngleSign = FMath::Sign(GetCylinderArcAngle());
+		if (ArcAngleSign == 0)//flat, no circle to intersect, segment count is small so just test all of them
+		{
+			for (int32 Segment = 0; Segment < NumSegments; Segment++)
+			{
+				TestSegment(Segment);
+			}
+			return NearestT != MAX_flt;
+		}
+
+		//same as UpdateMeshData, segments are chords of a circle in XY plane
+		const float ArcAngle = FMath::Max(FMath::DegreesToRadians(FMath::Abs(GetCylinderArcAngle())), 0.01f);
+		const float Radius = RenderTargetSize.X / ArcAngle;
+		const float Apothem = Radius * FMath::Cos(0.5f * ArcAngle);
+		const float ChordLength = 2.0f * Radius * FMath::Sin(0.5f * ArcAngle);
+		const float PivotOffsetX = ChordLength * (0.5 - Pivot.X);
+		const FVector2D Center(-ArcAngleSign * Apothem, PivotOffsetX);
+		const float RadiansPerStep = ArcAngle / NumSegments;
+
+		//ray and circle intersection in XY plane
+		const FVector2D RayStart2D(LocalRayStart.X - Center.X, LocalRayStart.Y - Center.Y);
+		const FVector2D RayDir2D(LocalRayEnd.X - LocalRayStart.X, LocalRayEnd.Y - LocalRayStart.Y);
+		const float A = RayDir2D.SizeSquared();
+		const float B = 2.0f * FVector2D::DotProduct(RayStart2D, RayDir2D);
+		const float C = RayStart2D.SizeSquared() - Radius * Radius;
+		const float Discriminant = B * B - 4.0f * A * C;
+		if (A <= KINDA_SMALL_NUMBER || Discriminant < 0)return false;
+		const float SqrtDiscriminant = FMath::Sqrt(Discriminant);
+		const float CircleT[2] = { (-B - SqrtDiscriminant) / (2.0f * A), (-B + SqrtDiscriminant) / (2.0f * A) };
+		for (auto T : CircleT)
+		{
+			auto Point = RayStart2D + RayDir2D * T;
+			auto Angle = FMath::Atan2(Point.Y, ArcAngleSign * Point.X);
+			//chord is inside circle, so hit segment is the one at this angle or the neighbour
+			auto Segment = FMath::FloorToInt((Angle + ArcAngle * 0.5f) / RadiansPerStep);
+			if (Segment < -1 || Segment > NumSegments)continue;
+			TestSegment(Segment - 1);
+			TestSegment(Segment);
+			TestSegment(Segment + 1);
+		}
+		return NearestT != MAX_flt;
+	}
+	break;
+	case ELGUIRenderTargetGeometryMode::StaticMesh:
+		return false;
+	}
+	return false;
+}
+
 bool ULGUIRenderTargetGeometrySource::LineTraceHitUV(const int32& InHitFaceIndex, const FVector& InHitPoint, const FVector& InLineStart, const FVector& InLineEnd, FVector2D& OutHitUV)const
+{
+	if (GeometryMode == ELGUIRenderTargetGeometryMode::StaticMesh)
+	{
+		return LineTraceHitUVFromMesh(InHitFaceIndex, InHitPoint, InLineStart, InLineEnd, OutHitUV);
+	}
+	if (bUseSimpleCollision || InHitFaceIndex < 0)//no valid physics hit, calculate it
+	{
+		return LineTraceHitUVAnalytic(InLineStart, InLineEnd, OutHitUV);
+	}
+	return LineTraceHitUVFromMesh(InHitFaceIndex, InHitPoint, InLineStart, InLineEnd, OutHitUV);
+}
+
+#include "Kismet/GameplayStatics.h"
+bool ULGUIRenderTargetGeometrySource::LineTraceHitUVFromMesh(const int32& InHitFaceIndex, const FVector& InHitPoint, const FVector& InLineStart, const FVector& InLineEnd, FVector2D& OutHitUV)const
 {
 	switch (GeometryMode)
 	{
@@ -1310,92 +1466,9 @@ bool ULGUIRenderTargetGeometrySource::LineTraceHitUV(const int32& InHitFaceIndex
 				return true;
 			}
 		}
-		else//don't have valid faceIndex, then do traditional hit test
+		else//don't have valid faceIndex, then calculate it
 		{
-			auto InverseTf = GetComponentTransform().Inverse();
-			auto LocalSpaceRayOrigin = InverseTf.TransformPosition(InLineStart);
-			auto LocalSpaceRayEnd = InverseTf.TransformPosition(InLineEnd);
-
-			auto RenderTargetSize = this->GetRenderTargetSize();
-			auto ArcAngle = FMath::DegreesToRadians(FMath::Abs(GetCylinderArcAngle()));
-
-			const int32 NumSegments = FMath::Lerp(MIN_SEG, MAX_SEG, ArcAngle / PI);
-
-			auto Vert0 = Vertices[0];
-			auto Vert1 = Vertices[1];
-			auto Position0 = (FVector)Vert0.Position;
-			auto Position1 = (FVector)Vert1.Position;
-
-			float UVInterval = 1.0f / NumSegments;
-			int32 TriangleIndex = 0;
-
-			struct FHitResultContainer
-			{
-				FVector2D UV;
-				FVector HitPoint;
-				float DistSquare;
-				FMatrix RectMatrix;
-			};
-			TArray<FHitResultContainer> MultiHitResult;
-			MultiHitResult.Reset();
-			for (int32 Segment = 0; Segment < NumSegments; Segment++)
-			{
-				auto Vert2 = Vertices[(Segment + 1) * 2];
-				auto Vert3 = Vertices[(Segment + 1) * 2 + 1];
-				auto Position2 = (FVector)Vert2.Position;
-				auto Position3 = (FVector)Vert3.Position;
-
-				auto Y = Position2 - Position0;
-				Y.Normalize();
-				auto Z = FVector(0, 0, 1);
-				auto X = FVector::CrossProduct(Y, Z);
-				X.Normalize();
-
-				auto LocalRectMatrix = FMatrix(X, Y, Z, Position0);
-				auto ToLocalRectMatrix = LocalRectMatrix.Inverse();
-
-				auto RectSpaceRayOrigin = (FVector)ToLocalRectMatrix.TransformPosition(LocalSpaceRayOrigin);
-				auto RectSpaceRayEnd = (FVector)ToLocalRectMatrix.TransformPosition(LocalSpaceRayEnd);
-				//start and end point must be different side of X plane
-				if (FMath::Sign(RectSpaceRayOrigin.X) != FMath::Sign(RectSpaceRayEnd.X))
-				{
-					if (RectSpaceRayOrigin.X > 0 && !bEnableInteractOnBackside)//ray origin is on backside but backside can't interact
-					{
-						continue;
-					}
-					auto HitPoint = FMath::LinePlaneIntersection(RectSpaceRayOrigin, RectSpaceRayEnd, FVector::ZeroVector, FVector(1, 0, 0));
-					//hit point inside rect area
-					float Left = 0;
-					float Right = (Position2 - Position0).Size();
-					float Bottom = 0;
-					float Top = RenderTargetSize.Y;
-					if (HitPoint.Y > Left && HitPoint.Y < Right && HitPoint.Z > Bottom && HitPoint.Z < Top)
-					{
-						FHitResultContainer HitResult;
-						HitResult.UV.X = Segment * UVInterval + UVInterval * HitPoint.Y / Right;
-						HitResult.UV.Y = HitPoint.Z / Top;
-						HitResult.DistSquare = FVector::DistSquared(LocalSpaceRayOrigin, HitPoint);
-						HitResult.HitPoint = HitPoint;
-						HitResult.RectMatrix = LocalRectMatrix;
-
-						MultiHitResult.Add(HitResult);
-					}
-				}
-
-				Position0 = Position2;
-				Position1 = Position3;
-			}
-			if (MultiHitResult.Num() > 0)
-			{
-				MultiHitResult.Sort([](const FHitResultContainer& A, const FHitResultContainer& B) {
-					return A.DistSquare < B.DistSquare;
-					});
-				auto& HitResult = MultiHitResult[0];
-
-				OutHitUV = HitResult.UV;
-
-				return true;
-			}
+			return LineTraceHitUVAnalytic(InLineStart, InLineEnd, OutHitUV);
 		}
 	}
 	break;
@@ -1429,4 +1502,153 @@ bool ULGUIRenderTargetGeometrySource::LineTraceHitUV(const int32& InHitFaceIndex
 	return false;
 }
 
+#if !UE_BUILD_SHIPPING
+/**
+ * Sweep a grid of rays over every render target geometry source in world, with plane and a range of cylinder arc angles.
+ * Compare LineTraceHitUVAnalytic with hit uv from mesh triangles (same as physics hit with face index).
+ */
+struct FLGUIRenderTargetGeometryLineTraceSweep
+{
+	/** Nearest triangle hit in local space, same as complex physics trace */
+	static bool LineTraceTriangles(const ULGUIRenderTargetGeometrySource* InSource, const FVector& InLocalStart, const FVector& InLocalEnd, int32& OutFaceIndex, FVector& OutLocalHitPoint)
+	{
+		float NearestDistSquared = MAX_flt;
+		for (int i = 0; i + 2 < InSource->Triangles.Num(); i += 3)
+		{
+			FVector HitPoint, HitNormal;
+			if (FMath::SegmentTriangleIntersection(InLocalStart, InLocalEnd
+				, (FVector)InSource->Vertices[InSource->Triangles[i]].Position
+				, (FVector)InSource->Vertices[InSource->Triangles[i + 1]].Position
+				, (FVector)InSource->Vertices[InSource->Triangles[i + 2]].Position
+				, HitPoint, HitNormal))
+			{
+				auto DistSquared = FVector::DistSquared(InLocalStart, HitPoint);
+				if (DistSquared < NearestDistSquared)
+				{
+					NearestDistSquared = DistSquared;
+					OutFaceIndex = i / 3;
+					OutLocalHitPoint = HitPoint;
+				}
+			}
+		}
+		return NearestDistSquared != MAX_flt;
+	}
+	static void Sweep(ULGUIRenderTargetGeometrySource* InSource, int32 InGridSize, int32& OutRayCount, int32& OutHitMismatch, int32& OutUVMismatch, float& OutMaxUVError, double& OutAnalyticTime, double& OutMeshTime)
+	{
+		FBox LocalBox(ForceInit);
+		for (auto& Vert : InSource->Vertices)
+		{
+			LocalBox += (FVector)Vert.Position;
+		}
+		if (!LocalBox.IsValid)return;
+		const auto Extent = LocalBox.GetExtent();
+		const float Distance = FMath::Max3(Extent.X, Extent.Y, Extent.Z) * 4 + 100;
+		const auto& Transform = InSource->GetComponentTransform();
+		//rays from a point in front of geometry, through grid points that a little bigger than geometry, so there are misses at edges
+		const FVector LocalEye(LocalBox.Min.X - Distance, LocalBox.GetCenter().Y, LocalBox.GetCenter().Z);
+		for (int y = 0; y < InGridSize; y++)
+		{
+			for (int z = 0; z < InGridSize; z++)
+			{
+				const float AlphaY = -0.1f + 1.2f * y / FMath::Max(InGridSize - 1, 1);
+				const float AlphaZ = -0.1f + 1.2f * z / FMath::Max(InGridSize - 1, 1);
+				const FVector LocalTarget(LocalBox.Max.X + Distance
+					, FMath::Lerp(LocalBox.Min.Y, LocalBox.Max.Y, AlphaY)
+					, FMath::Lerp(LocalBox.Min.Z, LocalBox.Max.Z, AlphaZ));
+				const FVector LocalEnd = LocalEye + (LocalTarget - LocalEye) * 2;
+				const auto Start = Transform.TransformPosition(LocalEye);
+				const auto End = Transform.TransformPosition(LocalEnd);
+				OutRayCount++;
+
+				FVector2D AnalyticUV, MeshUV;
+				auto StartTime = FPlatformTime::Seconds();
+				const bool bAnalyticHit = InSource->LineTraceHitUVAnalytic(Start, End, AnalyticUV);
+				OutAnalyticTime += FPlatformTime::Seconds() - StartTime;
+
+				StartTime = FPlatformTime::Seconds();
+				int32 FaceIndex = INDEX_NONE;
+				FVector LocalHitPoint;
+				bool bMeshHit = LineTraceTriangles(InSource, LocalEye, LocalEnd, FaceIndex, LocalHitPoint);
+				if (bMeshHit)
+				{
+					bMeshHit = InSource->LineTraceHitUVFromMesh(FaceIndex, Transform.TransformPosition(LocalHitPoint), Start, End, MeshUV);
+				}
+				OutMeshTime += FPlatformTime::Seconds() - StartTime;
+
+				if (bAnalyticHit != bMeshHit)
+				{
+					OutHitMismatch++;
+				}
+				else if (bMeshHit)
+				{
+					const float UVError = (AnalyticUV - MeshUV).GetAbsMax();
+					OutMaxUVError = FMath::Max(OutMaxUVError, UVError);
+					if (UVError > 0.001f)
+					{
+						OutUVMismatch++;
+					}
+				}
+			}
+		}
+	}
+	static void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 GridSize = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 32, 2);
+		const int32 ArcAngleSteps = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 8, 1);
+
+		int32 SourceCount = 0;
+		bool bPass = true;
+		for (TObjectIterator<ULGUIRenderTargetGeometrySource> It; It; ++It)
+		{
+			auto Source = *It;
+			if (Source->GetWorld() != World || !IsValid(Source) || Source->GetRenderTarget() == nullptr)continue;
+			if (Source->GetGeometryMode() == ELGUIRenderTargetGeometryMode::StaticMesh)continue;
+			SourceCount++;
+
+			const auto OriginGeometryMode = Source->GetGeometryMode();
+			const auto OriginArcAngle = Source->GetCylinderArcAngle();
+			//0 is plane, others are cylinder with positive and negative arc angle
+			TArray<float> ArcAngles = { 0 };
+			for (int i = 1; i <= ArcAngleSteps; i++)
+			{
+				ArcAngles.Add(180.0f * i / ArcAngleSteps);
+				ArcAngles.Add(-180.0f * i / ArcAngleSteps);
+			}
+			for (auto ArcAngle : ArcAngles)
+			{
+				if (ArcAngle == 0)
+				{
+					Source->SetGeometryMode(ELGUIRenderTargetGeometryMode::Plane);
+				}
+				else
+				{
+					Source->SetGeometryMode(ELGUIRenderTargetGeometryMode::Cylinder);
+					Source->SetCylinderArcAngle(ArcAngle);
+				}
+				int32 RayCount = 0, HitMismatch = 0, UVMismatch = 0;
+				float MaxUVError = 0;
+				double AnalyticTime = 0, MeshTime = 0;
+				Sweep(Source, GridSize, RayCount, HitMismatch, UVMismatch, MaxUVError, AnalyticTime, MeshTime);
+				bPass &= HitMismatch == 0 && UVMismatch == 0;
+				UE_LOG(LGUI, Log, TEXT("[%s] %s, %s, ray: %d, hit mismatch: %d, uv mismatch: %d, max uv error: %f, analytic: %.3fms, mesh: %.3fms")
+					, ANSI_TO_TCHAR(__FUNCTION__), *Source->GetPathName(), ArcAngle == 0 ? TEXT("Plane") : *FString::Printf(TEXT("Cylinder %.1f"), ArcAngle)
+					, RayCount, HitMismatch, UVMismatch, MaxUVError, AnalyticTime * 1000, MeshTime * 1000);
+			}
+			Source->SetGeometryMode(OriginGeometryMode);
+			Source->SetCylinderArcAngle(OriginArcAngle);
+		}
+		if (SourceCount == 0)
+		{
+			UE_LOG(LGUI, Warning, TEXT("[%s] No LGUIRenderTargetGeometrySource with render target in world"), ANSI_TO_TCHAR(__FUNCTION__));
+			return;
+		}
+		UE_LOG(LGUI, Log, TEXT("[%s] %s. GeometrySource: %d, GridSize: %d, ArcAngleSteps: %d"), ANSI_TO_TCHAR(__FUNCTION__), bPass ? TEXT("PASS") : TEXT("FAIL"), SourceCount, GridSize, ArcAngleSteps);
+	}
+};
+static FAutoConsoleCommand LGUIRenderTargetGeometryLineTraceSweepCommand(
+	TEXT("lgui.RenderTargetGeometrySource.LineTraceSweep"),
+	TEXT("Compare analytic line trace with mesh triangle trace, over a grid of rays and plane/cylinder arc angles, for every LGUIRenderTargetGeometrySource in world. Args: [GridSize=32] [ArcAngleSteps=8]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&FLGUIRenderTargetGeometryLineTraceSweep::Run));
+#endif
+
 #undef LOCTEXT_NAMESPACE
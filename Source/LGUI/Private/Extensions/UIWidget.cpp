@@ -15,6 +15,8 @@
 #include "Engine/GameViewportClient.h"
 #include "PrefabSystem/LGUIPrefabManager.h"
 #include "Core/LGUICustomMesh.h"
+#include "Core/LGUIManager.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE "UIWidget"
 
@@ -346,17 +348,15 @@ void UUIWidget::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 
 		if (ShouldDrawWidget())
 		{
-			// Calculate the actual delta time since we last drew, this handles the case where we're ticking when
-			// the world is paused, this also takes care of the case where the widget component is rendering at
-			// a different rate than the rest of the world.
-			const float DeltaTimeFromLastDraw = LastWidgetRenderTime == 0 ? 0 : (GetCurrentTime() - LastWidgetRenderTime);
-			DrawWidgetToRenderTarget(DeltaTimeFromLastDraw);
-
-			// We draw an empty widget.
-			if (Widget == nullptr && !SlateWidget.IsValid())
+			if (ULGUIManagerWorldSubsystem::IsUIWidgetRedrawScheduled(GetWorld()))
 			{
-				bRenderCleared = true;
+				if (auto Instance = ULGUIManagerWorldSubsystem::GetInstance(GetWorld()))
+				{
+					Instance->AddUIWidgetRedrawRequest(this);
+					return;
+				}
 			}
+			DrawWidgetSinceLastDraw();
 		}
 
 	}
@@ -379,7 +379,15 @@ bool UUIWidget::ShouldDrawWidget() const
 		{
 			if ((GetCurrentTime() - LastWidgetRenderTime) >= RedrawTime)
 			{
-				return bManuallyRedraw ? bRedrawRequested : true;
+				if (bManuallyRedraw)
+				{
+					return bRedrawRequested;
+				}
+				if (bSkipRedrawIfNoChange && LastWidgetRenderTime != 0)
+				{
+					return IsContentChangedSinceLastDraw();
+				}
+				return true;
 			}
 		}
 	}
@@ -387,6 +395,90 @@ bool UUIWidget::ShouldDrawWidget() const
 	return false;
 }
 
+bool UUIWidget::IsContentChangedSinceLastDraw() const
+{
+	if (bRedrawRequested || bHitTestSinceLastDraw)
+	{
+		return true;
+	}
+	if (LastDrawnWidget.Get() != Widget || LastDrawnSlateWidget.Pin() != SlateWidget)
+	{
+		return true;
+	}
+	if (Widget != nullptr && Widget->IsAnyAnimationPlaying())
+	{
+		return true;
+	}
+	const FIntPoint DrawSize(this->GetWidth() * ResolutionScale, this->GetHeight() * ResolutionScale);
+	if (DrawSize != CurrentDrawSize)
+	{
+		return true;
+	}
+	if (FSlateApplication::IsInitialized() && FSlateApplication::Get().GetLastUserInteractionTime() != LastDrawUserInteractionTime)
+	{
+		return true;
+	}
+	return false;
+}
+
+void UUIWidget::DrawWidgetSinceLastDraw()
+{
+	// Calculate the actual delta time since we last drew, this handles the case where we're ticking when
+	// the world is paused, this also takes care of the case where the widget component is rendering at
+	// a different rate than the rest of the world.
+	const float DeltaTimeFromLastDraw = LastWidgetRenderTime == 0 ? 0 : (GetCurrentTime() - LastWidgetRenderTime);
+	DrawWidgetToRenderTarget(DeltaTimeFromLastDraw);
+
+	// We draw an empty widget.
+	if (Widget == nullptr && !SlateWidget.IsValid())
+	{
+		bRenderCleared = true;
+	}
+}
+
+void UUIWidget::DrawScheduledRedraw()
+{
+	ScheduledRedrawWaitFrames = 0;
+	if (!ShouldDrawWidget())return;//state may change after request, eg. widget become inactive
+	DrawWidgetSinceLastDraw();
+}
+
+float UUIWidget::GetScheduledRedrawPriority(const FVector& InViewLocation, float InViewProjectionScale)const
+{
+	//approximate pixel area on screen
+	float ScreenPixelArea = this->GetWidth() * this->GetHeight();
+	if (RenderCanvas.IsValid())
+	{
+		if (RenderCanvas->IsRenderToWorldSpace())
+		{
+			//world size, then project to screen
+			auto Scale = this->GetComponentScale();
+			ScreenPixelArea *= FMath::Abs(Scale.Y * Scale.Z);
+			if (InViewProjectionScale > 0)
+			{
+				auto DistSquared = FMath::Max(FVector::DistSquared(this->GetComponentLocation(), InViewLocation), 1.0);
+				ScreenPixelArea *= InViewProjectionScale * InViewProjectionScale / DistSquared;
+			}
+		}
+		else if (auto RootCanvas = RenderCanvas->GetRootCanvas())
+		{
+			//screen space or render target, size relative to root canvas then multiply canvas scale (screen size / root canvas size)
+			if (auto RootUIItem = RootCanvas->GetUIItem())
+			{
+				auto Scale = this->GetComponentScale();
+				auto RootScale = RootUIItem->GetComponentScale();
+				auto RootScaleArea = FMath::Abs(RootScale.Y * RootScale.Z);
+				if (RootScaleArea > KINDA_SMALL_NUMBER)
+				{
+					ScreenPixelArea *= FMath::Abs(Scale.Y * Scale.Z) / RootScaleArea;
+				}
+			}
+			ScreenPixelArea *= RootCanvas->GetCanvasScale() * RootCanvas->GetCanvasScale();
+		}
+	}
+	return CalculateScheduledRedrawPriority(ScreenPixelArea, ScheduledRedrawWaitFrames);
+}
+
 void UUIWidget::DrawWidgetToRenderTarget(float DeltaTime)
 {
 	if (GUsingNullRHI)
@@ -438,6 +530,10 @@ void UUIWidget::DrawWidgetToRenderTarget(float DeltaTime)
 			DeltaTime);
 
 		LastWidgetRenderTime = GetCurrentTime();
+		LastDrawnWidget = Widget;
+		LastDrawnSlateWidget = SlateWidget;
+		LastDrawUserInteractionTime = FSlateApplication::IsInitialized() ? FSlateApplication::Get().GetLastUserInteractionTime() : 0;
+		bHitTestSinceLastDraw = false;
 
 		if (TickMode == ETickMode::Disabled && IsComponentTickEnabled())
 		{
@@ -715,6 +811,7 @@ TArray<FWidgetAndPointer> UUIWidget::GetHitWidgetPath(FVector2D WidgetSpaceHitCo
 
 	// Cache the location of the hit
 	LastLocalHitLocation = LocalHitLocation;
+	bHitTestSinceLastDraw = true;
 
 	TArray<FWidgetAndPointer> ArrangedWidgets;
 	if (SlateWindow.IsValid())
@@ -134,10 +134,7 @@ void UUIEffectTextAnimation_PropertyWithEase::SetEaseType(ELTweenEase value)
 	{
 		easeType = value;
 		easeFunc.Unbind();
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_PropertyWithEase::SetEaseCurve(UCurveFloat* value)
@@ -147,10 +144,7 @@ void UUIEffectTextAnimation_PropertyWithEase::SetEaseCurve(UCurveFloat* value)
 		easeCurve = value;
 		if (easeType == ELTweenEase::CurveFloat)
 		{
-			if (auto uiText = GetUIText())
-			{
-				uiText->MarkVertexPositionDirty();
-			}
+			MarkAnimationDirty();
 		}
 	}
 }
@@ -162,7 +156,7 @@ void UUIEffectTextAnimation_PositionProperty::ApplyProperty(UUIText* InUIText, c
 	auto& charProperties = InUIText->GetCharPropertyArray();
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		float lerpValue = FMath::Clamp(InSelection.lerpValueArray[charIndex - InSelection.startCharIndex], 0.0f, 1.0f);
@@ -183,7 +177,7 @@ void UUIEffectTextAnimation_PositionRandomProperty::ApplyProperty(UUIText* InUIT
 	auto& charProperties = InUIText->GetCharPropertyArray();
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		float lerpValue = FMath::Clamp(InSelection.lerpValueArray[charIndex - InSelection.startCharIndex], 0.0f, 1.0f);
@@ -204,7 +198,7 @@ void UUIEffectTextAnimation_RotationProperty::ApplyProperty(UUIText* InUIText, c
 	auto& charProperties = InUIText->GetCharPropertyArray();
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		auto charCenterPos = originVertices[startVertIndex].Position;
@@ -233,7 +227,7 @@ void UUIEffectTextAnimation_RotationRandomProperty::ApplyProperty(UUIText* InUIT
 	auto& charProperties = InUIText->GetCharPropertyArray();
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		auto charCenterPos = originVertices[startVertIndex].Position;
@@ -262,7 +256,7 @@ void UUIEffectTextAnimation_ScaleProperty::ApplyProperty(UUIText* InUIText, cons
 	auto& charProperties = InUIText->GetCharPropertyArray();
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		auto charCenterPos = originVertices[startVertIndex].Position;
@@ -291,7 +285,7 @@ void UUIEffectTextAnimation_ScaleRandomProperty::ApplyProperty(UUIText* InUIText
 	auto& charProperties = InUIText->GetCharPropertyArray();
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		auto charCenterPos = originVertices[startVertIndex].Position;
@@ -320,7 +314,7 @@ void UUIEffectTextAnimation_AlphaProperty::ApplyProperty(UUIText* InUIText, cons
 	auto& charProperties = InUIText->GetCharPropertyArray();
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		float lerpValue = FMath::Clamp(InSelection.lerpValueArray[charIndex - InSelection.startCharIndex], 0.0f, 1.0f);
@@ -345,7 +339,7 @@ void UUIEffectTextAnimation_ColorProperty::ApplyProperty(UUIText* InUIText, cons
 	}
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		float lerpValue = FMath::Clamp(InSelection.lerpValueArray[charIndex - InSelection.startCharIndex], 0.0f, 1.0f);
@@ -377,10 +371,7 @@ void UUIEffectTextAnimation_ColorProperty::SetUseHSV(bool value)
 	if (useHSV != value)
 	{
 		useHSV = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkColorDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 
@@ -392,7 +383,7 @@ void UUIEffectTextAnimation_ColorRandomProperty::ApplyProperty(UUIText* InUIText
 	auto& charProperties = InUIText->GetCharPropertyArray();
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		auto color = FColor((uint8)FMath::RandRange(min.R, max.R), (uint8)FMath::RandRange(min.G, max.G), (uint8)FMath::RandRange(min.B, max.B), (uint8)FMath::RandRange(min.A, max.A));
@@ -430,10 +421,7 @@ void UUIEffectTextAnimation_ColorRandomProperty::SetUseHSV(bool value)
 	if (useHSV != value)
 	{
 		useHSV = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkColorDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 
@@ -442,7 +430,7 @@ void UUIEffectTextAnimation_PositionProperty::SetPosition(FVector value)
 	if (position != value)
 	{
 		position = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_PositionRandomProperty::SetSeed(int value)
@@ -450,7 +438,7 @@ void UUIEffectTextAnimation_PositionRandomProperty::SetSeed(int value)
 	if (seed != value)
 	{
 		seed = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_PositionRandomProperty::SetMin(FVector value)
@@ -458,7 +446,7 @@ void UUIEffectTextAnimation_PositionRandomProperty::SetMin(FVector value)
 	if (min != value)
 	{
 		min = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_PositionRandomProperty::SetMax(FVector value)
@@ -466,7 +454,7 @@ void UUIEffectTextAnimation_PositionRandomProperty::SetMax(FVector value)
 	if (max != value)
 	{
 		max = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RotationProperty::SetRotator(FRotator value)
@@ -474,7 +462,7 @@ void UUIEffectTextAnimation_RotationProperty::SetRotator(FRotator value)
 	if (rotator != value)
 	{
 		rotator = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RotationRandomProperty::SetSeed(int value)
@@ -482,7 +470,7 @@ void UUIEffectTextAnimation_RotationRandomProperty::SetSeed(int value)
 	if (seed != value)
 	{
 		seed = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RotationRandomProperty::SetMin(FRotator value)
@@ -490,7 +478,7 @@ void UUIEffectTextAnimation_RotationRandomProperty::SetMin(FRotator value)
 	if (min != value)
 	{
 		min = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RotationRandomProperty::SetMax(FRotator value)
@@ -498,7 +486,7 @@ void UUIEffectTextAnimation_RotationRandomProperty::SetMax(FRotator value)
 	if (max != value)
 	{
 		max = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_ScaleProperty::SetScale(FVector value)
@@ -506,7 +494,7 @@ void UUIEffectTextAnimation_ScaleProperty::SetScale(FVector value)
 	if (scale != value)
 	{
 		scale = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_ScaleRandomProperty::SetSeed(int value)
@@ -514,7 +502,7 @@ void UUIEffectTextAnimation_ScaleRandomProperty::SetSeed(int value)
 	if (seed != value)
 	{
 		seed = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_ScaleRandomProperty::SetMin(FVector value)
@@ -522,7 +510,7 @@ void UUIEffectTextAnimation_ScaleRandomProperty::SetMin(FVector value)
 	if (min != value)
 	{
 		min = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_ScaleRandomProperty::SetMax(FVector value)
@@ -530,7 +518,7 @@ void UUIEffectTextAnimation_ScaleRandomProperty::SetMax(FVector value)
 	if (max != value)
 	{
 		max = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_AlphaProperty::SetAlpha(float value)
@@ -538,7 +526,7 @@ void UUIEffectTextAnimation_AlphaProperty::SetAlpha(float value)
 	if (alpha != value)
 	{
 		alpha = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_ColorProperty::SetColor(FColor value)
@@ -546,7 +534,7 @@ void UUIEffectTextAnimation_ColorProperty::SetColor(FColor value)
 	if (color != value)
 	{
 		color = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_ColorRandomProperty::SetSeed(int value)
@@ -554,7 +542,7 @@ void UUIEffectTextAnimation_ColorRandomProperty::SetSeed(int value)
 	if (seed != value)
 	{
 		seed = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_ColorRandomProperty::SetMin(FColor value)
@@ -562,7 +550,7 @@ void UUIEffectTextAnimation_ColorRandomProperty::SetMin(FColor value)
 	if (min != value)
 	{
 		min = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_ColorRandomProperty::SetMax(FColor value)
@@ -570,6 +558,6 @@ void UUIEffectTextAnimation_ColorRandomProperty::SetMax(FColor value)
 	if (max != value)
 	{
 		max = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
@@ -20,15 +20,12 @@ void UUIEffectTextAnimation_PropertyWithWave::SetFrequency(float value)
 	if (speed != value)
 	{
 		speed = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_PropertyWithWave::OnUpdate(float deltaTime)
 {
-	if (IsValid(uiText))
-	{
-		uiText->MarkVertexPositionDirty();
-	}
+	MarkAnimationDirty();
 }
 
 void UUIEffectTextAnimation_PositionWaveProperty::ApplyProperty(UUIText* InUIText, const FUIEffectTextAnimation_SelectResult& InSelection, UIGeometry* InGeometry)
@@ -39,7 +36,7 @@ void UUIEffectTextAnimation_PositionWaveProperty::ApplyProperty(UUIText* InUITex
 	PIxFreq = flipDirection ? -PIxFreq : PIxFreq;
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		float lerpValue = FMath::Clamp(InSelection.lerpValueArray[charIndex - InSelection.startCharIndex], 0.0f, 1.0f);
@@ -56,7 +53,7 @@ void UUIEffectTextAnimation_PositionWaveProperty::SetPosition(FVector value)
 	if (position != value)
 	{
 		position = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 
@@ -68,7 +65,7 @@ void UUIEffectTextAnimation_RotationWaveProperty::ApplyProperty(UUIText* InUITex
 	PIxFreq = flipDirection ? -PIxFreq : PIxFreq;
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		auto charCenterPos = originVertices[startVertIndex].Position;
@@ -93,7 +90,7 @@ void UUIEffectTextAnimation_RotationWaveProperty::SetRotator(FRotator value)
 	if (rotator != value)
 	{
 		rotator = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
 
@@ -105,7 +102,7 @@ void UUIEffectTextAnimation_ScaleWaveProperty::ApplyProperty(UUIText* InUIText,
 	PIxFreq = flipDirection ? -PIxFreq : PIxFreq;
 	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
 	{
-		auto charPropertyItem = charProperties[charIndex];
+		const auto& charPropertyItem = charProperties[charIndex];
 		int startVertIndex = charPropertyItem.StartVertIndex;
 		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
 		auto charCenterPos = originVertices[startVertIndex].Position;
@@ -129,6 +126,6 @@ void UUIEffectTextAnimation_ScaleWaveProperty::SetScale(FVector value)
 	if (scale != value)
 	{
 		scale = value;
-		MarkUITextPositionDirty();
+		MarkAnimationDirty();
 	}
 }
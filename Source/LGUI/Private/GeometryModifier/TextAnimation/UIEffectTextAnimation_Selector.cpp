@@ -34,10 +34,7 @@ void UUIEffectTextAnimation_RangeSelector::SetRange(float value)
 	if (range != value)
 	{
 		range = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RangeSelector::SetFlipDirection(bool value)
@@ -45,10 +42,7 @@ void UUIEffectTextAnimation_RangeSelector::SetFlipDirection(bool value)
 	if (flipDirection != value)
 	{
 		flipDirection = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RangeSelector::SetStart(float value)
@@ -56,10 +50,7 @@ void UUIEffectTextAnimation_RangeSelector::SetStart(float value)
 	if (start != value)
 	{
 		start = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RangeSelector::SetEnd(float value)
@@ -67,10 +58,7 @@ void UUIEffectTextAnimation_RangeSelector::SetEnd(float value)
 	if (end != value)
 	{
 		end = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 
@@ -100,10 +88,7 @@ void UUIEffectTextAnimation_RandomSelector::SetSeed(int value)
 	if (seed != value)
 	{
 		seed = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RandomSelector::SetStart(float value)
@@ -111,10 +96,7 @@ void UUIEffectTextAnimation_RandomSelector::SetStart(float value)
 	if (start != value)
 	{
 		start = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RandomSelector::SetEnd(float value)
@@ -122,10 +104,7 @@ void UUIEffectTextAnimation_RandomSelector::SetEnd(float value)
 	if (end != value)
 	{
 		end = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 
@@ -165,10 +144,7 @@ void UUIEffectTextAnimation_RichTextTagSelector::SetTagName(const FName& value)
 	if (tagName != value)
 	{
 		tagName = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RichTextTagSelector::SetRange(float value)
@@ -176,10 +152,7 @@ void UUIEffectTextAnimation_RichTextTagSelector::SetRange(float value)
 	if (range != value)
 	{
 		range = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation_RichTextTagSelector::SetFlipDirection(bool value)
@@ -187,9 +160,6 @@ void UUIEffectTextAnimation_RichTextTagSelector::SetFlipDirection(bool value)
 	if (flipDirection != value)
 	{
 		flipDirection = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
@@ -39,40 +39,44 @@ void UUIEffectLongShadow::ModifyUIGeometry(
 	const int32 singleChannelTriangleIndicesCount = triangleCount;
 	const int32 singleChannelVerticesCount = vertexCount;
 	int32 additionalTriangleIndicesCount = singleChannelTriangleIndicesCount * (shadowSegment + 1);
+	int32 shadowChannelCount = shadowSegment + 1;
 
 	triangles.AddUninitialized(additionalTriangleIndicesCount);
-	//put orgin triangles on last pass, this will make the origin triangle render at top
-	for (int triangleIndex = additionalTriangleIndicesCount, originTriangleIndex = 0; originTriangleIndex < singleChannelTriangleIndicesCount; triangleIndex++, originTriangleIndex++)
-	{
-		auto index = triangles[originTriangleIndex];
-		triangles[triangleIndex] = index;
-	}
-	//calculate other pass
-	int32 prevChannelVerticesCount = singleChannelVerticesCount;
-	int32 shadowChannelCount = shadowSegment + 1;
-	for (int channelIndex = 0, originTriangleIndex = 0, triangleIndex = 0; channelIndex < shadowChannelCount; triangleIndex++, originTriangleIndex++)
+	if (InTriangleChanged)
 	{
-		auto index = triangles[originTriangleIndex + additionalTriangleIndicesCount] + prevChannelVerticesCount;
-		triangles[triangleIndex] = index;
-		if (originTriangleIndex + 1 == singleChannelTriangleIndicesCount)
+		//put orgin triangles on last pass, this will make the origin triangle render at top
+		for (int triangleIndex = additionalTriangleIndicesCount, originTriangleIndex = 0; originTriangleIndex < singleChannelTriangleIndicesCount; triangleIndex++, originTriangleIndex++)
 		{
-			channelIndex += 1;
-			originTriangleIndex = -1;
-			prevChannelVerticesCount += singleChannelVerticesCount;
+			auto index = triangles[originTriangleIndex];
+			triangles[triangleIndex] = index;
+		}
+		//calculate other pass
+		int32 prevChannelVerticesCount = singleChannelVerticesCount;
+		for (int channelIndex = 0, originTriangleIndex = 0, triangleIndex = 0; channelIndex < shadowChannelCount; triangleIndex++, originTriangleIndex++)
+		{
+			auto index = triangles[originTriangleIndex + additionalTriangleIndicesCount] + prevChannelVerticesCount;
+			triangles[triangleIndex] = index;
+			if (originTriangleIndex + 1 == singleChannelTriangleIndicesCount)
+			{
+				channelIndex += 1;
+				originTriangleIndex = -1;
+				prevChannelVerticesCount += singleChannelVerticesCount;
+			}
 		}
 	}
 
 	int additionalVertCount = singleChannelVerticesCount * (shadowSegment + 1);
 	vertexCount = singleChannelVerticesCount + additionalVertCount;
-	originVertices.AddDefaulted(additionalVertCount);
-	vertices.AddDefaulted(additionalVertCount);
+	//use AddUninitialized, so unchanged data from last modify is kept
+	originVertices.AddUninitialized(additionalVertCount);
+	vertices.AddUninitialized(additionalVertCount);
 
 	//verticies
 	{
 		FVector shadowSizeInterval = shadowSize / (shadowSegment + 1);
 		for (int channelOriginVertIndex = 0; channelOriginVertIndex < singleChannelVerticesCount; channelOriginVertIndex++)
 		{
-			auto originVert = originVertices[channelOriginVertIndex].Position;
+			auto& originVert = originVertices[channelOriginVertIndex];
 			auto originUV0 = vertices[channelOriginVertIndex].TextureCoordinate[0];
 			auto originUV1 = vertices[channelOriginVertIndex].TextureCoordinate[1];
 			auto originUV2 = vertices[channelOriginVertIndex].TextureCoordinate[2];
@@ -81,16 +85,26 @@ void UUIEffectLongShadow::ModifyUIGeometry(
 			for (int channelIndex = 0; channelIndex < shadowChannelCount; channelIndex++)
 			{
 				int channelVertIndex = (channelIndex + 1) * singleChannelVerticesCount + channelOriginVertIndex;
-				vertices[channelVertIndex].TextureCoordinate[0] = originUV0;
-				vertices[channelVertIndex].TextureCoordinate[1] = originUV1;
-				vertices[channelVertIndex].TextureCoordinate[2] = originUV2;
-				vertices[channelVertIndex].TextureCoordinate[3] = originUV3;
-				auto& vert = originVertices[channelVertIndex].Position;
-				vert = originVert;
-				vert.X += shadowSizeInterval.X * (shadowChannelCount - channelIndex);
-				vert.Y += shadowSizeInterval.Y * (shadowChannelCount - channelIndex);
-				vert.Z += shadowSizeInterval.Z * (shadowChannelCount - channelIndex);
+				if (InUVChanged)
+				{
+					vertices[channelVertIndex].TextureCoordinate[0] = originUV0;
+					vertices[channelVertIndex].TextureCoordinate[1] = originUV1;
+					vertices[channelVertIndex].TextureCoordinate[2] = originUV2;
+					vertices[channelVertIndex].TextureCoordinate[3] = originUV3;
+				}
+				if (InVertexPositionChanged)
+				{
+					auto& vert = originVertices[channelVertIndex];
+					vert = originVert;
+					vert.Position.X += shadowSizeInterval.X * (shadowChannelCount - channelIndex);
+					vert.Position.Y += shadowSizeInterval.Y * (shadowChannelCount - channelIndex);
+					vert.Position.Z += shadowSizeInterval.Z * (shadowChannelCount - channelIndex);
+				}
 				
+				if (!InColorChanged)
+				{
+					continue;
+				}
 				if (useGradientColor)
 				{
 					float colorRatio = ((float)(channelIndex) / (shadowChannelCount));
@@ -25,41 +25,54 @@ void UUIEffectShadow::ModifyUIGeometry(
 	const int32 singleChannelVerticesCount = vertexCount;
 	//create additional triangle pass
 	triangles.AddUninitialized(singleChannelTriangleIndicesCount);
-	//put orgin triangles on last pass, this will make the origin triangle render at top
-	for (int i = singleChannelTriangleIndicesCount, j = 0; j < singleChannelTriangleIndicesCount; i++, j++)
+	if (InTriangleChanged)
 	{
-		auto index = triangles[j];
-		triangles[i] = index;
-		triangles[j] = index + singleChannelVerticesCount;
+		//put orgin triangles on last pass, this will make the origin triangle render at top
+		for (int i = singleChannelTriangleIndicesCount, j = 0; j < singleChannelTriangleIndicesCount; i++, j++)
+		{
+			auto index = triangles[j];
+			triangles[i] = index;
+			triangles[j] = index + singleChannelVerticesCount;
+		}
 	}
 	
 	vertexCount = singleChannelVerticesCount + singleChannelVerticesCount;
-	originVertices.AddDefaulted(singleChannelVerticesCount);
-	vertices.AddDefaulted(singleChannelVerticesCount);
+	//use AddUninitialized, so unchanged data from last modify is kept
+	originVertices.AddUninitialized(singleChannelVerticesCount);
+	vertices.AddUninitialized(singleChannelVerticesCount);
 
 	for (int channelIndex1 = singleChannelVerticesCount, channelIndexOrigin = 0; channelIndex1 < vertexCount; channelIndex1++, channelIndexOrigin++)
 	{
-		auto originVertPos = originVertices[channelIndexOrigin].Position;
-		originVertPos.Y += shadowOffset.X;
-		originVertPos.Z += shadowOffset.Y;
-		originVertices[channelIndex1].Position = originVertPos;
-
-		if (multiplySourceAlpha)
+		if (InVertexPositionChanged)
 		{
-			auto& vertColor = vertices[channelIndex1].Color;
-			vertColor.A = (uint8)(LGUIUtils::Color255To1_Table[vertices[channelIndexOrigin].Color.A] * shadowColor.A);
-			vertColor.R = shadowColor.R;
-			vertColor.G = shadowColor.G;
-			vertColor.B = shadowColor.B;
+			auto& channel1Vert = originVertices[channelIndex1];
+			channel1Vert = originVertices[channelIndexOrigin];
+			channel1Vert.Position.Y += shadowOffset.X;
+			channel1Vert.Position.Z += shadowOffset.Y;
 		}
-		else
+
+		if (InColorChanged)
 		{
-			vertices[channelIndex1].Color = shadowColor;
+			if (multiplySourceAlpha)
+			{
+				auto& vertColor = vertices[channelIndex1].Color;
+				vertColor.A = (uint8)(LGUIUtils::Color255To1_Table[vertices[channelIndexOrigin].Color.A] * shadowColor.A);
+				vertColor.R = shadowColor.R;
+				vertColor.G = shadowColor.G;
+				vertColor.B = shadowColor.B;
+			}
+			else
+			{
+				vertices[channelIndex1].Color = shadowColor;
+			}
 		}
 
-		for (int i = 0; i < MAX_STATIC_TEXCOORDS; i++)
+		if (InUVChanged)
 		{
-			vertices[channelIndex1].TextureCoordinate[i] = vertices[channelIndexOrigin].TextureCoordinate[i];
+			for (int i = 0; i < LGUI_VERTEX_TEXCOORDINATE_COUNT; i++)
+			{
+				vertices[channelIndex1].TextureCoordinate[i] = vertices[channelIndexOrigin].TextureCoordinate[i];
+			}
 		}
 	}
 }
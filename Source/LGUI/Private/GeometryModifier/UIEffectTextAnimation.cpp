@@ -87,6 +87,26 @@ void UUIEffectTextAnimation::ModifyUIGeometry(
 		}
 	}
 }
+void UUIEffectTextAnimation::GetIncrementalModifyRequiredChannel(bool& InOutTriangleChanged, bool& InOutVertexPositionChanged, bool& InOutUVChanged, bool& InOutColorChanged)const
+{
+	//selection may change, so position and color should be restored from input and apply properties again
+	if (InOutTriangleChanged || InOutVertexPositionChanged || InOutUVChanged || InOutColorChanged)
+	{
+		InOutVertexPositionChanged = true;
+		InOutColorChanged = true;
+	}
+}
+void UUIEffectTextAnimation::GetIncrementalModifyChangedChannel(bool& InOutTriangleChanged, bool& InOutVertexPositionChanged, bool& InOutUVChanged, bool& InOutColorChanged)const
+{
+	GetIncrementalModifyRequiredChannel(InOutTriangleChanged, InOutVertexPositionChanged, InOutUVChanged, InOutColorChanged);
+}
+void UUIEffectTextAnimation::MarkAnimationDirty()
+{
+	if (auto UIRenderableComp = GetUIRenderable())
+	{
+		UIRenderableComp->MarkGeometryModifierDirty(this, true, false, true);
+	}
+}
 UUIText* UUIEffectTextAnimation::GetUIText()
 {
 	CheckUIText();
@@ -106,19 +126,13 @@ void UUIEffectTextAnimation::SetSelector(UUIEffectTextAnimation_Selector* value)
 	if (selector != value)
 	{
 		selector = value;
-		if (CheckUIText())
-		{
-			uiText->MarkVerticesDirty(true, true, true, true);
-		}
+		MarkAnimationDirty();
 	}
 }
 void UUIEffectTextAnimation::SetProperties(const TArray<UUIEffectTextAnimation_Property*>& value)
 {
 	properties = value;
-	if (CheckUIText())
-	{
-		uiText->MarkVerticesDirty(true, true, true, true);
-	}
+	MarkAnimationDirty();
 }
 void UUIEffectTextAnimation::SetProperty(int index, UUIEffectTextAnimation_Property* value)
 {
@@ -130,10 +144,7 @@ void UUIEffectTextAnimation::SetProperty(int index, UUIEffectTextAnimation_Prope
 	if (properties[index] != value)
 	{
 		properties[index] = value;
-		if (CheckUIText())
-		{
-			uiText->MarkVerticesDirty(true, true, true, true);
-		}
+		MarkAnimationDirty();
 	}
 }
 
@@ -155,15 +166,20 @@ UUIEffectTextAnimation* UUIEffectTextAnimation_Selector::GetUIEffectTextAnimatio
 	return UIEffectTextAnimation.Get();
 }
 
+void UUIEffectTextAnimation_Selector::MarkAnimationDirty()
+{
+	if (auto TextAnimation = GetUIEffectTextAnimation())
+	{
+		TextAnimation->MarkAnimationDirty();
+	}
+}
+
 void UUIEffectTextAnimation_Selector::SetOffset(float value)
 {
 	if (offset != value)
 	{
 		offset = value;
-		if (auto uiText = GetUIText())
-		{
-			uiText->MarkVertexPositionDirty();
-		}
+		MarkAnimationDirty();
 	}
 }
 
@@ -204,10 +220,10 @@ UUIText* UUIEffectTextAnimation_Property::GetUIText()
 	}
 	return nullptr;
 }
-void UUIEffectTextAnimation_Property::MarkUITextPositionDirty()
+void UUIEffectTextAnimation_Property::MarkAnimationDirty()
 {
-	if (auto uiText = GetUIText())
+	if (auto TextAnimation = Cast<UUIEffectTextAnimation>(this->GetOuter()))
 	{
-		uiText->MarkVertexPositionDirty();
+		TextAnimation->MarkAnimationDirty();
 	}
 }
@@ -11,6 +11,18 @@
 PRAGMA_DISABLE_OPTIMIZATION
 #endif
 
+static UActorComponent* GetComponentByInterface(AActor* InActor, UClass* InInterfaceClass)
+{
+    for (UActorComponent* Component : InActor->GetComponents())
+    {
+        if (Component && Component->GetClass()->ImplementsInterface(InInterfaceClass))
+        {
+            return Component;
+        }
+    }
+    return nullptr;
+}
+
 void UUIRecyclableScrollViewComponent::Awake()
 {
     Super::Awake();
@@ -144,6 +156,23 @@ void UUIRecyclableScrollViewComponent::ClearAllCells()
         }
     }
     CacheCellList.Empty();
+    for (auto& Pool : CellPoolList)
+    {
+        for (auto& Item : Pool.CellList)
+        {
+            if (IsValid(Item.UIItem))
+            {
+                ULGUIBPLibrary::DestroyActorWithHierarchy(Item.UIItem->GetOwner());
+            }
+        }
+    }
+    CellPoolList.Empty();
+    WorkingCellTemplateList.Empty();
+    VariableCellSizeArray.Empty();
+    VariableCellTemplateIndexArray.Empty();
+    VariableCellSizeTree.Reset(VariableCellSizeArray, 0);
+    VariableCellStartDataIndex = 0;
+    bVariableSizeCellWorking = false;
 
     DataItemCount = 0;
     MinCellIndexInCacheCellList = 0;
@@ -223,6 +252,16 @@ void UUIRecyclableScrollViewComponent::SetSpace(const FVector2D& value)
 
 bool UUIRecyclableScrollViewComponent::GetCellItemByDataIndex(int Index, FUIRecyclableScrollViewCellContainer& OutResult)const
 {
+    if (bVariableSizeCellWorking)
+    {
+        auto CellIndex = Index - VariableCellStartDataIndex;
+        if (CacheCellList.IsValidIndex(CellIndex))
+        {
+            OutResult = CacheCellList[CellIndex];
+            return true;
+        }
+        return false;
+    }
     auto MaxCellIndexInData = FMath::Min(Index + CacheCellList.Num() - 1, DataItemCount - 1);
     auto ValidMinCellDataIndex = GetValidCellDataIndex(MinCellDataIndex);
     if (Index < ValidMinCellDataIndex || Index > MaxCellIndexInData)
@@ -266,6 +305,24 @@ void UUIRecyclableScrollViewComponent::ScrollToByDataIndex(int InDataIndex, bool
         return;
     }
 
+    if (bVariableSizeCellWorking)
+    {
+        auto CellCenterOffset = VariableCellSizeTree.GetPrefixSum(InDataIndex) + VariableCellSizeArray[InDataIndex] * 0.5f;
+        if (Horizontal)
+        {
+            float TargetContentPos = Padding.Left + CellCenterOffset;
+            TargetContentPos = FMath::Clamp(-TargetContentPos, HorizontalRange.X, HorizontalRange.Y);
+            ScrollToContentPosition(TargetContentPos, InEaseAnimation, InAnimationDuration);
+        }
+        else
+        {
+            float TargetContentPos = -Padding.Top - CellCenterOffset;
+            TargetContentPos = FMath::Clamp(-TargetContentPos, VerticalRange.X, VerticalRange.Y);
+            ScrollToContentPosition(TargetContentPos, InEaseAnimation, InAnimationDuration);
+        }
+        return;
+    }
+
     auto ValidMinCellDataIndex = GetValidCellDataIndex(MinCellDataIndex);
     if (Horizontal)
     {
@@ -292,40 +349,7 @@ void UUIRecyclableScrollViewComponent::ScrollToByDataIndex(int InDataIndex, bool
         }
 
         TargetContentPos = FMath::Clamp(-TargetContentPos, HorizontalRange.X, HorizontalRange.Y);
-        if (InEaseAnimation)
-        {
-            auto tweener = ULTweenManager::To(this, FLTweenFloatGetterFunction::CreateWeakLambda(this
-                , [=] {
-                    auto ContentLocation = ContentUIItem->GetRelativeLocation();
-                    return ContentLocation.Y;
-                })
-                , FLTweenFloatSetterFunction::CreateWeakLambda(this, [=](float value) {
-                    this->SetScrollValue(FVector2D(value, 0));
-                    }), TargetContentPos, InAnimationDuration);
-            if (tweener)
-            {
-                bool bAffectByGamePause = false;
-                bool bAffectByTimeDilation = false;
-                if (this->GetRootUIComponent())
-                {
-                    if (this->GetRootUIComponent()->IsScreenSpaceOverlayUI())
-                    {
-                        bAffectByGamePause = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByGamePause;
-                        bAffectByTimeDilation = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByTimeDilation;
-                    }
-                    else
-                    {
-                        bAffectByGamePause = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByGamePause;
-                        bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
-                    }
-                }
-                tweener->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
-            }
-        }
-        else
-        {
-            SetScrollValue(FVector2D(TargetContentPos, 0));
-        }
+        ScrollToContentPosition(TargetContentPos, InEaseAnimation, InAnimationDuration);
     }
     else if (Vertical)
     {
@@ -352,40 +376,45 @@ void UUIRecyclableScrollViewComponent::ScrollToByDataIndex(int InDataIndex, bool
         }
 
         TargetContentPos = FMath::Clamp(-TargetContentPos, VerticalRange.X, VerticalRange.Y);
-        if (InEaseAnimation)
-        {
-            auto tweener = ULTweenManager::To(this, FLTweenFloatGetterFunction::CreateWeakLambda(this
-                , [=] {
-                    auto ContentLocation = ContentUIItem->GetRelativeLocation();
-                    return ContentLocation.Z;
-                })
-                , FLTweenFloatSetterFunction::CreateWeakLambda(this, [=](float value) {
-                    this->SetScrollValue(FVector2D(0, value));
-                    }), TargetContentPos, InAnimationDuration);
-            if (tweener)
+        ScrollToContentPosition(TargetContentPos, InEaseAnimation, InAnimationDuration);
+    }
+}
+
+void UUIRecyclableScrollViewComponent::ScrollToContentPosition(float InTargetContentPos, bool InEaseAnimation, float InAnimationDuration)
+{
+    if (InEaseAnimation)
+    {
+        auto tweener = ULTweenManager::To(this, FLTweenFloatGetterFunction::CreateWeakLambda(this
+            , [=] {
+                auto ContentLocation = ContentUIItem->GetRelativeLocation();
+                return Horizontal ? ContentLocation.Y : ContentLocation.Z;
+            })
+            , FLTweenFloatSetterFunction::CreateWeakLambda(this, [=](float value) {
+                this->SetScrollValue(Horizontal ? FVector2D(value, 0) : FVector2D(0, value));
+                }), InTargetContentPos, InAnimationDuration);
+        if (tweener)
+        {
+            bool bAffectByGamePause = false;
+            bool bAffectByTimeDilation = false;
+            if (this->GetRootUIComponent())
             {
-                bool bAffectByGamePause = false;
-                bool bAffectByTimeDilation = false;
-                if (this->GetRootUIComponent())
+                if (this->GetRootUIComponent()->IsScreenSpaceOverlayUI())
                 {
-                    if (this->GetRootUIComponent()->IsScreenSpaceOverlayUI())
-                    {
-                        bAffectByGamePause = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByGamePause;
-                        bAffectByTimeDilation = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByTimeDilation;
-                    }
-                    else
-                    {
-                        bAffectByGamePause = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByGamePause;
-                        bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
-                    }
+                    bAffectByGamePause = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByGamePause;
+                    bAffectByTimeDilation = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByTimeDilation;
+                }
+                else
+                {
+                    bAffectByGamePause = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByGamePause;
+                    bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
                 }
-                tweener->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
             }
+            tweener->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
         }
-        else
-        {
-            SetScrollValue(FVector2D(0, TargetContentPos));
-        }
+    }
+    else
+    {
+        SetScrollValue(Horizontal ? FVector2D(InTargetContentPos, 0) : FVector2D(0, InTargetContentPos));
     }
 }
 
@@ -409,24 +438,43 @@ void UUIRecyclableScrollViewComponent::SetCellTemplatePrefab(class ULGUIPrefab*
     }
 }
 
+void UUIRecyclableScrollViewComponent::SetVariableSizeCell(bool value)
+{
+    if (bVariableSizeCell != value)
+    {
+        bVariableSizeCell = value;
+        InitializeOnDataSource();
+    }
+}
+void UUIRecyclableScrollViewComponent::SetExtraCellTemplates(const TArray<AUIBaseActor*>& value)
+{
+    ExtraCellTemplates = value;
+}
+void UUIRecyclableScrollViewComponent::SetCellCacheMargin(float value)
+{
+    value = FMath::Max(0.0f, value);
+    if (CellCacheMargin != value)
+    {
+        CellCacheMargin = value;
+        if (bVariableSizeCellWorking)
+        {
+            UpdateVariableSizeCells(false);
+        }
+    }
+}
+
 void UUIRecyclableScrollViewComponent::InitializeOnDataSource()
 {
     if (!IsValid(DataSource))return;
     if (!CheckParameters())return;
     if (Horizontal == Vertical)return;
+    if (bVariableSizeCellWorking && !(bVariableSizeCell && CanUseVariableSizeCell()))//switch from VariableSizeCell to normal, cells in pool are not needed
+    {
+        ClearVariableSizeCells();
+        bVariableSizeCellWorking = false;
+    }
     DataItemCount = IUIRecyclableScrollViewDataSource::Execute_GetItemCount(DataSource);
 
-    auto GetComponentByInterface = [](AActor* InActor, UClass* InInterfaceClass) {
-        for (UActorComponent* Component : InActor->GetComponents())
-        {
-            if (Component && Component->GetClass()->ImplementsInterface(InInterfaceClass))
-            {
-                return Component;
-            }
-        }
-        return (UActorComponent*)nullptr;
-    };
-
     switch (CellTemplateType)
     {
     default:
@@ -475,6 +523,16 @@ void UUIRecyclableScrollViewComponent::InitializeOnDataSource()
         this->UnregisterScrollEvent(OnScrollEventDelegateHandle);
     }
 
+    if (bVariableSizeCell)
+    {
+        if (CanUseVariableSizeCell())
+        {
+            InitializeVariableSizeCells();
+            return;
+        }
+        UE_LOG(LGUI, Warning, TEXT("[%s] VariableSizeCell only work when Rows and Columns equals 1 and InfiniteLoop is off, will use normal mode."), ANSI_TO_TCHAR(__FUNCTION__));
+    }
+
     int VisibleColumnOrRowCount = 0;
     int VisibleCellCount = 0;
     if (Horizontal)
@@ -646,6 +704,11 @@ void UUIRecyclableScrollViewComponent::InitializeOnDataSource()
 void UUIRecyclableScrollViewComponent::OnScrollCallback(FVector2D value)
 {
     if (Horizontal == Vertical)return;
+    if (bVariableSizeCellWorking)
+    {
+        UpdateVariableSizeCells(false);
+        return;
+    }
     if (CacheCellList.Num() == 0)return;
     if (DataItemCount == 0)return;
 
@@ -841,6 +904,16 @@ void UUIRecyclableScrollViewComponent::ApplyContentPositionWithProgress()
 void UUIRecyclableScrollViewComponent::UpdateCellData()
 {
     if (!IsValid(DataSource))return;
+    if (bVariableSizeCellWorking)
+    {
+        IUIRecyclableScrollViewDataSource::Execute_BeforeSetCell(DataSource);
+        for (int i = 0; i < CacheCellList.Num(); i++)
+        {
+            IUIRecyclableScrollViewDataSource::Execute_SetCell(DataSource, CacheCellList[i].CellComponent, VariableCellStartDataIndex + i);
+        }
+        IUIRecyclableScrollViewDataSource::Execute_AfterSetCell(DataSource);
+        return;
+    }
 
     IUIRecyclableScrollViewDataSource::Execute_BeforeSetCell(DataSource);
     auto CellDataIndex = GetValidCellDataIndex(MinCellDataIndex);
@@ -900,6 +973,449 @@ void UUIRecyclableScrollViewComponent::DecreaseMinMaxCellIndexInCacheCellList(in
     }
 }
 
+#pragma region VariableSizeCell
+bool UUIRecyclableScrollViewComponent::CanUseVariableSizeCell()const
+{
+    return !bInfiniteLoop && (Horizontal ? Rows == 1 : Columns == 1);
+}
+
+void UUIRecyclableScrollViewComponent::ClearVariableSizeCells()
+{
+    for (auto& Item : CacheCellList)
+    {
+        if (IsValid(Item.UIItem))
+        {
+            ULGUIBPLibrary::DestroyActorWithHierarchy(Item.UIItem->GetOwner());
+        }
+    }
+    CacheCellList.Empty();
+    for (auto& Pool : CellPoolList)
+    {
+        for (auto& Item : Pool.CellList)
+        {
+            if (IsValid(Item.UIItem))
+            {
+                ULGUIBPLibrary::DestroyActorWithHierarchy(Item.UIItem->GetOwner());
+            }
+        }
+    }
+    CellPoolList.Empty();
+    VariableCellStartDataIndex = 0;
+}
+
+void UUIRecyclableScrollViewComponent::InitializeVariableSizeCells()
+{
+    TArray<TWeakObjectPtr<AUIBaseActor>> NewCellTemplateList;
+    NewCellTemplateList.Add(WorkingCellTemplate);
+    for (auto& Item : ExtraCellTemplates)
+    {
+        if (IsValid(Item) && GetComponentByInterface(Item, UUIRecyclableScrollViewCell::StaticClass()) != nullptr)
+        {
+            NewCellTemplateList.Add(Item);
+        }
+        else
+        {
+            UE_LOG(LGUI, Error, TEXT("[%s] ExtraCellTemplates's element must be valid and have a ActorComponent which implement UIRecyclableScrollViewCell interface!"), ANSI_TO_TCHAR(__FUNCTION__));
+            NewCellTemplateList.Add(nullptr);
+        }
+    }
+    if (!bVariableSizeCellWorking)//switch from normal to VariableSizeCell, existing cells are all created from WorkingCellTemplate, so recycle them
+    {
+        for (auto& Item : CacheCellList)
+        {
+            Item.TemplateIndex = 0;
+        }
+        VariableCellStartDataIndex = 0;
+    }
+    else if (NewCellTemplateList != WorkingCellTemplateList)//template changed, old cells are not useable
+    {
+        ClearVariableSizeCells();
+    }
+    bVariableSizeCellWorking = true;
+    WorkingCellTemplateList = NewCellTemplateList;
+    CellPoolList.SetNum(WorkingCellTemplateList.Num());
+    for (auto& Item : WorkingCellTemplateList)
+    {
+        if (Item.IsValid())
+        {
+            Item->GetUIItem()->SetHorizontalAndVerticalAnchorMinMax(FVector2D(0.0f, 1.0f), FVector2D(0.0f, 1.0f), true, true);
+            Item->GetUIItem()->SetIsUIActive(false);
+        }
+    }
+    for (auto& Item : CacheCellList)
+    {
+        ReleaseVariableSizeCell(Item);
+    }
+    CacheCellList.Reset();
+
+    if (Horizontal)
+    {
+        RangeArea.X = ContentParentUIItem->GetLocalSpaceLeft();
+        RangeArea.Y = ContentParentUIItem->GetLocalSpaceRight();
+    }
+    else
+    {
+        RangeArea.X = ContentParentUIItem->GetLocalSpaceBottom();
+        RangeArea.Y = ContentParentUIItem->GetLocalSpaceTop();
+    }
+
+    VariableCellSizeArray.SetNumUninitialized(DataItemCount);
+    VariableCellTemplateIndexArray.SetNumUninitialized(DataItemCount);
+    QueryVariableSizeCellData(0, DataItemCount);
+    VariableCellSizeTree.Reset(VariableCellSizeArray, Horizontal ? Space.X : Space.Y);
+    UpdateVariableSizeContentSize();
+
+    auto PrevProgress = this->Progress;
+    if (Horizontal)
+    {
+        this->SetScrollProgress(FVector2D(1.0f, PrevProgress.Y));
+    }
+    else
+    {
+        this->SetScrollProgress(FVector2D(PrevProgress.X, 0.0f));
+    }
+    PrevContentPosition = FVector2D(ContentUIItem->GetRelativeLocation().Y, ContentUIItem->GetRelativeLocation().Z);
+    UpdateVariableSizeCells(true);
+    OnScrollEventDelegateHandle = this->RegisterScrollEvent(FLGUIVector2Delegate::CreateUObject(this, &UUIRecyclableScrollViewComponent::OnScrollCallback));
+}
+
+void UUIRecyclableScrollViewComponent::QueryVariableSizeCellData(int Index, int Count)
+{
+    for (int i = Index, EndIndex = Index + Count; i < EndIndex; i++)
+    {
+        auto TemplateIndex = IUIRecyclableScrollViewDataSource::Execute_GetItemTemplateIndex(DataSource, i);
+        if (!WorkingCellTemplateList.IsValidIndex(TemplateIndex) || !WorkingCellTemplateList[TemplateIndex].IsValid())
+        {
+            UE_LOG(LGUI, Warning, TEXT("[%s] Invalid template index:%d for data index:%d, will use CellTemplate."), ANSI_TO_TCHAR(__FUNCTION__), TemplateIndex, i);
+            TemplateIndex = 0;
+        }
+        auto Size = IUIRecyclableScrollViewDataSource::Execute_GetItemSize(DataSource, i);
+        if (Size <= 0)
+        {
+            auto TemplateUIItem = WorkingCellTemplateList[TemplateIndex]->GetUIItem();
+            Size = Horizontal ? TemplateUIItem->GetWidth() : TemplateUIItem->GetHeight();
+        }
+        VariableCellSizeArray[i] = Size;
+        VariableCellTemplateIndexArray[i] = TemplateIndex;
+    }
+}
+
+void UUIRecyclableScrollViewComponent::UpdateVariableSizeContentSize()
+{
+    if (Horizontal)
+    {
+        float ContentSize = VariableCellSizeTree.GetTotal() - (DataItemCount > 0 ? Space.X : 0) + Padding.Left + Padding.Right;
+        ContentUIItem->SetWidth(ContentSize);
+    }
+    else
+    {
+        float ContentSize = VariableCellSizeTree.GetTotal() - (DataItemCount > 0 ? Space.Y : 0) + Padding.Bottom + Padding.Top;
+        ContentUIItem->SetHeight(ContentSize);
+    }
+}
+
+FUIRecyclableScrollViewCellContainer UUIRecyclableScrollViewComponent::AcquireVariableSizeCell(int InTemplateIndex)
+{
+    auto& Pool = CellPoolList[InTemplateIndex].CellList;
+    while (Pool.Num() > 0)
+    {
+        auto CellContainer = Pool.Pop(false);
+        if (IsValid(CellContainer.UIItem))
+        {
+            CellContainer.UIItem->SetIsUIActive(true);
+            return CellContainer;
+        }
+    }
+    auto Template = WorkingCellTemplateList[InTemplateIndex].Get();
+    Template->GetUIItem()->SetIsUIActive(true);
+    auto CopiedCell = ULGUIBPLibrary::DuplicateActorT(Template, ContentUIItem.Get());
+    Template->GetUIItem()->SetIsUIActive(false);
+    auto CellInterfaceComponent = GetComponentByInterface(CopiedCell, UUIRecyclableScrollViewCell::StaticClass());
+    check(CellInterfaceComponent != nullptr);
+    FUIRecyclableScrollViewCellContainer CellContainer;
+    CellContainer.UIItem = CopiedCell->GetUIItem();
+    CellContainer.CellComponent = CellInterfaceComponent;
+    CellContainer.TemplateIndex = InTemplateIndex;
+    IUIRecyclableScrollViewDataSource::Execute_InitOnCreate(DataSource, CellInterfaceComponent);
+    return CellContainer;
+}
+
+void UUIRecyclableScrollViewComponent::ReleaseVariableSizeCell(const FUIRecyclableScrollViewCellContainer& InCell)
+{
+    if (!IsValid(InCell.UIItem))return;
+    if (CellPoolList.IsValidIndex(InCell.TemplateIndex))
+    {
+        InCell.UIItem->SetIsUIActive(false);
+        CellPoolList[InCell.TemplateIndex].CellList.Add(InCell);
+    }
+    else
+    {
+        ULGUIBPLibrary::DestroyActorWithHierarchy(InCell.UIItem->GetOwner());
+    }
+}
+
+void UUIRecyclableScrollViewComponent::UpdateVariableSizeCells(bool InForceSetCell)
+{
+    if (DataItemCount <= 0)
+    {
+        for (auto& Item : CacheCellList)
+        {
+            ReleaseVariableSizeCell(Item);
+        }
+        CacheCellList.Reset();
+        VariableCellStartDataIndex = 0;
+        return;
+    }
+
+    //visible range, offset from the first cell's start edge
+    double MinOffset, MaxOffset;
+    if (Horizontal)
+    {
+        auto ContentLeft = ContentUIItem->GetLocalSpaceLeft() + ContentUIItem->GetRelativeLocation().Y + Padding.Left;
+        MinOffset = RangeArea.X - ContentLeft;
+        MaxOffset = RangeArea.Y - ContentLeft;
+    }
+    else
+    {
+        auto ContentTop = ContentUIItem->GetLocalSpaceTop() + ContentUIItem->GetRelativeLocation().Z - Padding.Top;
+        MinOffset = ContentTop - RangeArea.Y;
+        MaxOffset = ContentTop - RangeArea.X;
+    }
+    const int NewStartDataIndex = VariableCellSizeTree.FindIndexByOffset(MinOffset - CellCacheMargin);
+    const int NewEndDataIndex = VariableCellSizeTree.FindIndexByOffset(MaxOffset + CellCacheMargin);
+    const int OldStartDataIndex = VariableCellStartDataIndex;
+    const int OldEndDataIndex = VariableCellStartDataIndex + CacheCellList.Num() - 1;
+    if (!InForceSetCell && NewStartDataIndex == OldStartDataIndex && NewEndDataIndex == OldEndDataIndex)
+    {
+        return;
+    }
+
+    //recycle cells out of range
+    TArray<FUIRecyclableScrollViewCellContainer> NewCellList;
+    NewCellList.SetNum(NewEndDataIndex - NewStartDataIndex + 1);
+    for (int i = 0; i < CacheCellList.Num(); i++)
+    {
+        auto DataIndex = OldStartDataIndex + i;
+        if (!InForceSetCell && DataIndex >= NewStartDataIndex && DataIndex <= NewEndDataIndex)
+        {
+            NewCellList[DataIndex - NewStartDataIndex] = CacheCellList[i];
+        }
+        else
+        {
+            ReleaseVariableSizeCell(CacheCellList[i]);
+        }
+    }
+
+    //set new cells
+    float CrossSize;
+    if (Horizontal)
+    {
+        CrossSize = ContentUIItem->GetHeight() - (Padding.Top + Padding.Bottom);
+    }
+    else
+    {
+        CrossSize = ContentUIItem->GetWidth() - (Padding.Left + Padding.Right);
+    }
+    bool bAnyCellSet = false;
+    for (int i = 0; i < NewCellList.Num(); i++)
+    {
+        auto& CellItem = NewCellList[i];
+        if (CellItem.UIItem != nullptr)continue;
+        if (!bAnyCellSet)
+        {
+            bAnyCellSet = true;
+            IUIRecyclableScrollViewDataSource::Execute_BeforeSetCell(DataSource);
+        }
+        auto DataIndex = NewStartDataIndex + i;
+        CellItem = AcquireVariableSizeCell(VariableCellTemplateIndexArray[DataIndex]);
+        auto CellSize = VariableCellSizeArray[DataIndex];
+        auto CellOffset = (float)VariableCellSizeTree.GetPrefixSum(DataIndex);
+        auto Pivot = CellItem.UIItem->GetPivot();
+        if (Horizontal)
+        {
+            CellItem.UIItem->SetWidth(CellSize);
+            CellItem.UIItem->SetHeight(CrossSize);
+            CellItem.UIItem->SetAnchoredPosition(FVector2D(
+                Padding.Left + CellOffset + Pivot.X * CellSize
+                , -Padding.Top - (1.0f - Pivot.Y) * CrossSize));
+        }
+        else
+        {
+            CellItem.UIItem->SetWidth(CrossSize);
+            CellItem.UIItem->SetHeight(CellSize);
+            CellItem.UIItem->SetAnchoredPosition(FVector2D(
+                Padding.Left + Pivot.X * CrossSize
+                , -Padding.Top - CellOffset - (1.0f - Pivot.Y) * CellSize));
+        }
+        IUIRecyclableScrollViewDataSource::Execute_SetCell(DataSource, CellItem.CellComponent, DataIndex);
+    }
+    if (bAnyCellSet)
+    {
+        IUIRecyclableScrollViewDataSource::Execute_AfterSetCell(DataSource);
+    }
+    CacheCellList = MoveTemp(NewCellList);
+    VariableCellStartDataIndex = NewStartDataIndex;
+    MinCellIndexInCacheCellList = 0;
+    MaxCellIndexInCacheCellList = FMath::Max(CacheCellList.Num() - 1, 0);
+}
+#pragma endregion
+
+void UUIRecyclableScrollViewComponent::InsertItems(int Index, int Count)
+{
+    if (!IsValid(DataSource))return;
+    if (!bVariableSizeCellWorking)
+    {
+        InitializeOnDataSource();
+        return;
+    }
+    auto NewDataItemCount = IUIRecyclableScrollViewDataSource::Execute_GetItemCount(DataSource);
+    if (Count <= 0 || Index < 0 || Index > DataItemCount || NewDataItemCount != DataItemCount + Count)
+    {
+        UE_LOG(LGUI, Warning, TEXT("[%s] Data item count not match, Index:%d, Count:%d, prev item count:%d, current item count:%d. Will recreate list."), ANSI_TO_TCHAR(__FUNCTION__), Index, Count, DataItemCount, NewDataItemCount);
+        InitializeOnDataSource();
+        return;
+    }
+    const int OldEndDataIndex = VariableCellStartDataIndex + CacheCellList.Num() - 1;
+    DataItemCount = NewDataItemCount;
+    VariableCellSizeArray.InsertUninitialized(Index, Count);
+    VariableCellTemplateIndexArray.InsertUninitialized(Index, Count);
+    QueryVariableSizeCellData(Index, Count);
+    VariableCellSizeTree.ResetFrom(VariableCellSizeArray, Horizontal ? Space.X : Space.Y, Index);
+    UpdateVariableSizeContentSize();
+    //alive cells' data index and position only change if insert before them
+    UpdateVariableSizeCells(Index <= OldEndDataIndex);
+}
+
+void UUIRecyclableScrollViewComponent::RemoveItems(int Index, int Count)
+{
+    if (!IsValid(DataSource))return;
+    if (!bVariableSizeCellWorking)
+    {
+        InitializeOnDataSource();
+        return;
+    }
+    auto NewDataItemCount = IUIRecyclableScrollViewDataSource::Execute_GetItemCount(DataSource);
+    if (Count <= 0 || Index < 0 || Index + Count > DataItemCount || NewDataItemCount != DataItemCount - Count)
+    {
+        UE_LOG(LGUI, Warning, TEXT("[%s] Data item count not match, Index:%d, Count:%d, prev item count:%d, current item count:%d. Will recreate list."), ANSI_TO_TCHAR(__FUNCTION__), Index, Count, DataItemCount, NewDataItemCount);
+        InitializeOnDataSource();
+        return;
+    }
+    const int OldEndDataIndex = VariableCellStartDataIndex + CacheCellList.Num() - 1;
+    DataItemCount = NewDataItemCount;
+    VariableCellSizeArray.RemoveAt(Index, Count, false);
+    VariableCellTemplateIndexArray.RemoveAt(Index, Count, false);
+    VariableCellSizeTree.ResetFrom(VariableCellSizeArray, Horizontal ? Space.X : Space.Y, Index);
+    UpdateVariableSizeContentSize();
+    UpdateVariableSizeCells(Index <= OldEndDataIndex);
+}
+
+void UUIRecyclableScrollViewComponent::UpdateItemSize(int Index, int Count)
+{
+    if (!IsValid(DataSource))return;
+    if (!bVariableSizeCellWorking)return;
+    if (Count <= 0 || Index < 0 || Index + Count > DataItemCount)
+    {
+        UE_LOG(LGUI, Warning, TEXT("[%s] Invalid range, Index:%d, Count:%d, item count:%d"), ANSI_TO_TCHAR(__FUNCTION__), Index, Count, DataItemCount);
+        return;
+    }
+    const int OldEndDataIndex = VariableCellStartDataIndex + CacheCellList.Num() - 1;
+    TArray<float> PrevSizeArray(VariableCellSizeArray.GetData() + Index, Count);
+    QueryVariableSizeCellData(Index, Count);
+    for (int i = 0; i < Count; i++)
+    {
+        auto Delta = VariableCellSizeArray[Index + i] - PrevSizeArray[i];
+        if (Delta != 0)
+        {
+            VariableCellSizeTree.Add(Index + i, Delta);
+        }
+    }
+    UpdateVariableSizeContentSize();
+    UpdateVariableSizeCells(Index <= OldEndDataIndex);
+}
+
+void FUIRecyclableScrollViewSizeTree::Reset(const TArray<float>& InSizeArray, float InSpace)
+{
+    const int Count = InSizeArray.Num();
+    Tree.SetNumUninitialized(Count + 1);
+    Tree[0] = 0;
+    for (int i = 0; i < Count; i++)
+    {
+        Tree[i + 1] = InSizeArray[i] + InSpace;
+    }
+    for (int i = 1; i <= Count; i++)//O(n) build
+    {
+        int Parent = i + (i & -i);
+        if (Parent <= Count)
+        {
+            Tree[Parent] += Tree[i];
+        }
+    }
+}
+void FUIRecyclableScrollViewSizeTree::ResetFrom(const TArray<float>& InSizeArray, float InSpace, int InStartIndex)
+{
+    const int Count = InSizeArray.Num();
+    const int StartNode = FMath::Clamp(InStartIndex, 0, Count) + 1;
+    Tree.SetNumUninitialized(Count + 1);
+    Tree[0] = 0;
+    for (int i = StartNode; i <= Count; i++)
+    {
+        Tree[i] = InSizeArray[i - 1] + InSpace;
+    }
+    for (int i = StartNode; i <= Count; i++)
+    {
+        const int LowBit = i & -i;
+        //children of node i are i-1, i-2, i-4 ..., children before StartNode are kept so add them here, others are pushed up below
+        for (int Step = LowBit >> 1; Step > 0 && i - Step < StartNode; Step >>= 1)
+        {
+            Tree[i] += Tree[i - Step];
+        }
+        int Parent = i + LowBit;
+        if (Parent <= Count)
+        {
+            Tree[Parent] += Tree[i];
+        }
+    }
+}
+void FUIRecyclableScrollViewSizeTree::Add(int Index, double Delta)
+{
+    const int Count = Num();
+    for (int i = Index + 1; i <= Count; i += i & -i)
+    {
+        Tree[i] += Delta;
+    }
+}
+double FUIRecyclableScrollViewSizeTree::GetPrefixSum(int Index)const
+{
+    double Result = 0;
+    for (int i = FMath::Min(Index, Num()); i > 0; i -= i & -i)
+    {
+        Result += Tree[i];
+    }
+    return Result;
+}
+int FUIRecyclableScrollViewSizeTree::FindIndexByOffset(double Offset)const
+{
+    const int Count = Num();
+    if (Count == 0)return 0;
+    int Position = 0;
+    int Step = 1;
+    while ((Step << 1) <= Count)
+    {
+        Step <<= 1;
+    }
+    for (; Step > 0; Step >>= 1)
+    {
+        int Next = Position + Step;
+        if (Next <= Count && Tree[Next] <= Offset)
+        {
+            Position = Next;
+            Offset -= Tree[Next];
+        }
+    }
+    return FMath::Clamp(Position, 0, Count - 1);
+}
+
 #if LGUI_CAN_DISABLE_OPTIMIZATION
 PRAGMA_ENABLE_OPTIMIZATION
 #endif
@@ -9,8 +9,21 @@
 #include "Framework/Application/SlateApplication.h"
 #include "LGUI.h"
 #include "PrefabSystem/LGUIPrefab.h"
+#include "Core/LGUIManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Core/Actor/UIContainerActor.h"
+#include "Core/Actor/UISpriteActor.h"
+#include "Engine/World.h"
 #include LGUIPREFAB_SERIALIZER_NEWEST_INCLUDE
 
+static TAutoConsoleVariable<int32> CVarUseHierarchyComponentIndex(
+	TEXT("lgui.HierarchyComponentIndex.Enable"),
+	1,
+	TEXT("Use hierarchy component index for GetComponentsInChildren/GetComponentInChildren if the hierarchy have one (see EnableHierarchyComponentIndex). Set to 0 to compare with tree walk."),
+	ECVF_Default);
+DECLARE_CYCLE_STAT(TEXT("GetComponentsInChildren TreeWalk"), STAT_GetComponentsInChildren_TreeWalk, STATGROUP_LGUI);
+DECLARE_CYCLE_STAT(TEXT("GetComponentsInChildren Index"), STAT_GetComponentsInChildren_Index, STATGROUP_LGUI);
+
 void ULGUIBPLibrary::DestroyActorWithHierarchy(AActor* Target, bool WithHierarchy)
 {
 	LGUIUtils::DestroyActorWithHierarchy(Target, WithHierarchy);
@@ -106,6 +119,18 @@ TArray<UActorComponent*> ULGUIBPLibrary::GetComponentsInChildren(AActor* InActor
 		UE_LOG(LGUI, Error, TEXT("[ULGUIBPLibrary::GetComponentInParent]InActor is not valid!"));
 		return result;
 	}
+	if (CVarUseHierarchyComponentIndex.GetValueOnGameThread() != 0)
+	{
+		if (auto Index = ULGUIManagerWorldSubsystem::FindHierarchyComponentIndex(InActor))
+		{
+			SCOPE_CYCLE_COUNTER(STAT_GetComponentsInChildren_Index);
+			if (Index->Collect(InActor, ComponentClass, IncludeSelf, InExcludeNode, false, result))
+			{
+				return result;
+			}
+		}
+	}
+	SCOPE_CYCLE_COUNTER(STAT_GetComponentsInChildren_TreeWalk);
 
 	struct LOCAL
 	{
@@ -158,6 +183,19 @@ UActorComponent* ULGUIBPLibrary::GetComponentInChildren(AActor* InActor, TSubcla
 		UE_LOG(LGUI, Error, TEXT("[ULGUIBPLibrary::GetComponentInChildren]InActor is not valid!"));
 		return nullptr;
 	}
+	if (CVarUseHierarchyComponentIndex.GetValueOnGameThread() != 0)
+	{
+		if (auto Index = ULGUIManagerWorldSubsystem::FindHierarchyComponentIndex(InActor))
+		{
+			SCOPE_CYCLE_COUNTER(STAT_GetComponentsInChildren_Index);
+			TArray<UActorComponent*> FoundComponents;
+			if (Index->Collect(InActor, ComponentClass, IncludeSelf, InExcludeNode, true, FoundComponents))
+			{
+				return FoundComponents.Num() > 0 ? FoundComponents[0] : nullptr;
+			}
+		}
+	}
+	SCOPE_CYCLE_COUNTER(STAT_GetComponentsInChildren_TreeWalk);
 
 	struct LOCAL
 	{
@@ -209,6 +247,99 @@ UActorComponent* ULGUIBPLibrary::GetComponentInChildren(AActor* InActor, TSubcla
 	return result;
 }
 
+void ULGUIBPLibrary::EnableHierarchyComponentIndex(AActor* InRootActor)
+{
+	if (!IsValid(InRootActor))
+	{
+		UE_LOG(LGUI, Error, TEXT("[ULGUIBPLibrary::EnableHierarchyComponentIndex]InRootActor is not valid!"));
+		return;
+	}
+	ULGUIManagerWorldSubsystem::EnableHierarchyComponentIndex(InRootActor);
+}
+void ULGUIBPLibrary::DisableHierarchyComponentIndex(AActor* InRootActor)
+{
+	ULGUIManagerWorldSubsystem::DisableHierarchyComponentIndex(InRootActor);
+}
+void ULGUIBPLibrary::RefreshHierarchyComponentIndex(AActor* InRootActor)
+{
+	ULGUIManagerWorldSubsystem::RefreshHierarchyComponentIndex(InRootActor);
+}
+
+#if !UE_BUILD_SHIPPING
+/** Build a deep UI tree with sprites only at leaves, compare GetComponentsInChildren/GetComponentInChildren time and result between tree walk and index. */
+struct FLGUIHierarchyComponentIndexBenchmark
+{
+	static void CreateChildren_Recursive(UWorld* InWorld, AActor* InParent, int32 InDepth, int32 InChildCount, TArray<AActor*>& OutActors)
+	{
+		for (int i = 0; i < InChildCount; i++)
+		{
+			AActor* Child = InDepth <= 1
+				? (AActor*)InWorld->SpawnActor<AUISpriteActor>()
+				: (AActor*)InWorld->SpawnActor<AUIContainerActor>();
+			Child->AttachToActor(InParent, FAttachmentTransformRules::KeepRelativeTransform);
+			OutActors.Add(Child);
+			if (InDepth > 1)
+			{
+				CreateChildren_Recursive(InWorld, Child, InDepth - 1, InChildCount, OutActors);
+			}
+		}
+	}
+	static void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 Depth = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10, 1);
+		const int32 ChildCount = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 2, 1);
+		const int32 QueryCount = FMath::Max(Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 100, 1);
+		if (World == nullptr)
+		{
+			UE_LOG(LGUI, Error, TEXT("[%s] Need a world to spawn actors"), ANSI_TO_TCHAR(__FUNCTION__));
+			return;
+		}
+
+		TArray<AActor*> Actors;
+		auto RootActor = World->SpawnActor<AUIContainerActor>();
+		Actors.Add(RootActor);
+		CreateChildren_Recursive(World, RootActor, Depth, ChildCount, Actors);
+
+		auto Query = [&](TArray<UActorComponent*>& OutAll, UActorComponent*& OutFirst) {
+			auto StartTime = FPlatformTime::Seconds();
+			for (int i = 0; i < QueryCount; i++)
+			{
+				OutAll = ULGUIBPLibrary::GetComponentsInChildren(RootActor, UUISprite::StaticClass(), false, {});
+				OutFirst = ULGUIBPLibrary::GetComponentInChildren(RootActor, UUISprite::StaticClass(), false, {});
+			}
+			return FPlatformTime::Seconds() - StartTime;
+		};
+		const int32 PrevCVarValue = CVarUseHierarchyComponentIndex.GetValueOnGameThread();
+		TArray<UActorComponent*> TreeWalkResult, IndexResult;
+		UActorComponent* TreeWalkFirst = nullptr, * IndexFirst = nullptr;
+		CVarUseHierarchyComponentIndex->Set(0, ECVF_SetByCode);
+		const double TreeWalkTime = Query(TreeWalkResult, TreeWalkFirst);
+
+		auto StartTime = FPlatformTime::Seconds();
+		ULGUIManagerWorldSubsystem::EnableHierarchyComponentIndex(RootActor);
+		const double BuildTime = FPlatformTime::Seconds() - StartTime;
+		CVarUseHierarchyComponentIndex->Set(1, ECVF_SetByCode);
+		const double IndexTime = Query(IndexResult, IndexFirst);
+		CVarUseHierarchyComponentIndex->Set(PrevCVarValue, ECVF_SetByCode);
+
+		const bool bPass = TreeWalkResult == IndexResult && TreeWalkFirst == IndexFirst;
+		UE_LOG(LGUI, Log, TEXT("[%s] %s. ActorCount: %d, found: %d, QueryCount: %d, tree walk: %.3fms, index: %.3fms, index build: %.3fms")
+			, ANSI_TO_TCHAR(__FUNCTION__), bPass ? TEXT("PASS") : TEXT("FAIL, result not same as tree walk"), Actors.Num(), TreeWalkResult.Num(), QueryCount
+			, TreeWalkTime * 1000, IndexTime * 1000, BuildTime * 1000);
+
+		ULGUIManagerWorldSubsystem::DisableHierarchyComponentIndex(RootActor);
+		for (int i = Actors.Num() - 1; i >= 0; i--)
+		{
+			Actors[i]->Destroy();
+		}
+	}
+};
+static FAutoConsoleCommand LGUIHierarchyComponentIndexBenchmarkCommand(
+	TEXT("lgui.HierarchyComponentIndex.Benchmark"),
+	TEXT("Spawn a deep UI tree, compare GetComponentsInChildren/GetComponentInChildren between tree walk and hierarchy component index. Args: [Depth=10] [ChildCount=2] [QueryCount=100]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&FLGUIHierarchyComponentIndexBenchmark::Run));
+#endif
+
 UActorComponent* ULGUIBPLibrary::LGUICompRef_GetComponent(const FLGUIComponentReference& InLGUIComponentReference, TSubclassOf<UActorComponent> InComponentType)
 {
 	auto comp = InLGUIComponentReference.GetComponent();
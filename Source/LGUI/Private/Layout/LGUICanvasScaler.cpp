@@ -3,8 +3,8 @@
 #include "Layout/LGUICanvasScaler.h"
 #include "LGUI.h"
 #include "Core/ActorComponent/LGUICanvas.h"
-#if WITH_EDITOR
 #include "Core/LGUIManager.h"
+#if WITH_EDITOR
 #include "PrefabSystem/LGUIPrefabManager.h"
 #include "DrawDebugHelpers.h"
 #include "Editor.h"
@@ -94,15 +94,16 @@ void ULGUICanvasScaler::OnDisable()
 			}
 		}
 	}
+	bIsViewportResizePending = false;//LGUIManager skip this scaler if not pending
 }
 
 void ULGUICanvasScaler::ForceUpdate()
 {
-	CheckAndApplyViewportParameter();
+	CheckAndApplyViewportParameter(true);
 }
 
 
-void ULGUICanvasScaler::CheckAndApplyViewportParameter()
+void ULGUICanvasScaler::CheckAndApplyViewportParameter(bool InForceApply)
 {
 	if (CheckCanvas())
 	{
@@ -111,7 +112,7 @@ void ULGUICanvasScaler::CheckAndApplyViewportParameter()
 		case ELGUIRenderMode::ScreenSpaceOverlay:
 		{
 			ViewportSize = Canvas->GetViewportSize();
-			OnViewportParameterChanged();
+			OnViewportParameterChanged(InForceApply);
 		}
 		break;
 		case ELGUIRenderMode::RenderTarget:
@@ -120,7 +121,7 @@ void ULGUICanvasScaler::CheckAndApplyViewportParameter()
 			{
 				ViewportSize.X = renderTarget->SizeX;
 				ViewportSize.Y = renderTarget->SizeY;
-				OnViewportParameterChanged();
+				OnViewportParameterChanged(InForceApply);
 			}
 		}
 		break;
@@ -129,10 +130,116 @@ void ULGUICanvasScaler::CheckAndApplyViewportParameter()
 }
 void ULGUICanvasScaler::OnViewportResized(FViewport* viewport, uint32)
 {
+	//viewport can fire resize event many times in a single frame (eg. drag window border), so only record it, and apply at LGUIManager's next update. LGUIManager also tick when game paused, so UI still follow viewport size
+	if (bIsViewportResizePending)return;
+	if (auto Instance = ULGUIManagerWorldSubsystem::GetInstance(GetWorld()))
+	{
+		bIsViewportResizePending = true;
+		Instance->AddPendingViewportResizeCanvasScaler(this);
+	}
+	else
+	{
+		ApplyPendingViewportResize();
+	}
+}
+void ULGUICanvasScaler::ApplyPendingViewportResize()
+{
+	bIsViewportResizePending = false;
+	if (!CheckCanvas())return;
 	ViewportSize = Canvas->GetViewportSize();//why not just get the viewport size from "viewport" parameter? because assets editor's viewport(ie. material, texture editor viewport) can fire the same event, and size is assets editor's viewport size
 	OnViewportParameterChanged();
 }
-void ULGUICanvasScaler::OnViewportParameterChanged()
+void ULGUICanvasScaler::CalculateCanvasSizeAndScale(float& OutWidth, float& OutHeight, float& OutScale)
+{
+	OutWidth = ViewportSize.X;
+	OutHeight = ViewportSize.Y;
+	OutScale = 1.0f;
+	switch (UIScaleMode)
+	{
+	case ELGUICanvasScaleMode::ConstantPixelSize:
+		break;
+	case ELGUICanvasScaleMode::ScaleWithScreenSize:
+	{
+		switch (ScreenMatchMode)
+		{
+		case ELGUICanvasScreenMatchMode::MatchWidthOrHeight:
+		{
+			float matchWidth_PreferredWidth = ReferenceResolution.X;
+			float matchWidth_PreferredHeight = ReferenceResolution.X * ViewportSize.Y / ViewportSize.X;
+			float matchWidth_ScaleRatio = ViewportSize.X / ReferenceResolution.X;
+
+			float matchHeight_PreferredHeight = ReferenceResolution.Y;
+			float matchHeight_PreferredWidth = ReferenceResolution.Y * ViewportSize.X / ViewportSize.Y;
+			float matchHeight_ScaleRatio = ViewportSize.Y / ReferenceResolution.Y;
+
+			OutWidth = FMath::Lerp(matchWidth_PreferredWidth, matchHeight_PreferredWidth, MatchFromWidthToHeight);
+			OutHeight = FMath::Lerp(matchWidth_PreferredHeight, matchHeight_PreferredHeight, MatchFromWidthToHeight);
+
+			OutScale = FMath::Lerp(matchWidth_ScaleRatio, matchHeight_ScaleRatio, MatchFromWidthToHeight);
+		}
+		break;
+		case ELGUICanvasScreenMatchMode::Expand:
+		case ELGUICanvasScreenMatchMode::Shrink:
+		{
+			float resultWidth = ViewportSize.X, resultHeight = ViewportSize.Y;
+
+			float screenAspect = (float)ViewportSize.X / ViewportSize.Y;
+			float referenceAspect = ReferenceResolution.X / ReferenceResolution.Y;
+			if (screenAspect > referenceAspect)//screen width > reference width
+			{
+				if (ScreenMatchMode == ELGUICanvasScreenMatchMode::Shrink)
+				{
+					resultHeight = ReferenceResolution.Y;
+					resultWidth = resultHeight * screenAspect;
+					OutScale = (float)ViewportSize.Y / resultHeight;
+				}
+				else if (ScreenMatchMode == ELGUICanvasScreenMatchMode::Expand)
+				{
+					resultWidth = ReferenceResolution.X;
+					resultHeight = resultWidth / screenAspect;
+					OutScale = (float)ViewportSize.X / resultWidth;
+				}
+			}
+			else//screen height > reference height
+			{
+				if (ScreenMatchMode == ELGUICanvasScreenMatchMode::Shrink)
+				{
+					resultWidth = ReferenceResolution.X;
+					resultHeight = resultWidth / screenAspect;
+					OutScale = (float)ViewportSize.X / resultWidth;
+				}
+				else if (ScreenMatchMode == ELGUICanvasScreenMatchMode::Expand)
+				{
+					resultHeight = ReferenceResolution.Y;
+					resultWidth = resultHeight * screenAspect;
+					OutScale = (float)ViewportSize.Y / resultHeight;
+				}
+			}
+			OutWidth = resultWidth;
+			OutHeight = resultHeight;
+		}
+		break;
+		}
+	}
+	break;
+	case ELGUICanvasScaleMode::Custom:
+	{
+		if (IsValid(CustomScale))
+		{
+			auto ScaledViewportSize = ViewportSize;
+			CustomScale->CalculateSizeAndScale(this, ViewportSize, ScaledViewportSize, OutScale);
+			OutWidth = ScaledViewportSize.X;
+			OutHeight = ScaledViewportSize.Y;
+		}
+		//else default is constant pixel
+	}
+	break;
+	}
+}
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("CanvasScaler Apply"), STAT_CanvasScalerApply, STATGROUP_LGUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("CanvasScaler Apply Skipped"), STAT_CanvasScalerApplySkipped, STATGROUP_LGUI);
+void ULGUICanvasScaler::OnViewportParameterChanged(bool InForceApply)
 {
 	if (ViewportSize.X <= 0 || ViewportSize.Y <= 0)return;
 	if (CheckCanvas())
@@ -144,13 +251,8 @@ void ULGUICanvasScaler::OnViewportParameterChanged()
 			{
 				if (bFixedSizeInEditMode && !World->IsGameWorld())//Edit mode
 				{
-					if (auto canvasUIItem = Canvas->GetUIItem())
-					{
-						canvasUIItem->SetWidth(SizeInEditMode.X);
-						canvasUIItem->SetHeight(SizeInEditMode.Y);
-						ViewportSize.X = SizeInEditMode.X;
-						ViewportSize.Y = SizeInEditMode.Y;
-					}
+					ViewportSize.X = SizeInEditMode.X;
+					ViewportSize.Y = SizeInEditMode.Y;
 				}
 			}
 #endif
@@ -161,101 +263,21 @@ void ULGUICanvasScaler::OnViewportParameterChanged()
 				auto canvasUIItem = Canvas->GetUIItem();
 				if (canvasUIItem != nullptr)
 				{
-					float canvasScale = 1.0f;
-					//adjust size
-					switch (UIScaleMode)
-					{
-					case ELGUICanvasScaleMode::ConstantPixelSize:
-					{
-						canvasUIItem->SetWidth(ViewportSize.X);
-						canvasUIItem->SetHeight(ViewportSize.Y);
-						canvasScale = 1.0f;
-					}
-					break;
-					case ELGUICanvasScaleMode::ScaleWithScreenSize:
-					{
-						switch (ScreenMatchMode)
-						{
-						case ELGUICanvasScreenMatchMode::MatchWidthOrHeight:
-						{
-							float matchWidth_PreferredWidth = ReferenceResolution.X;
-							float matchWidth_PreferredHeight = ReferenceResolution.X * ViewportSize.Y / ViewportSize.X;
-							float matchWidth_ScaleRatio = ViewportSize.X / ReferenceResolution.X;
-
-							float matchHeight_PreferredHeight = ReferenceResolution.Y;
-							float matchHeight_PreferredWidth = ReferenceResolution.Y * ViewportSize.X / ViewportSize.Y;
-							float matchHeight_ScaleRatio = ViewportSize.Y / ReferenceResolution.Y;
-
-							canvasUIItem->SetWidth(FMath::Lerp(matchWidth_PreferredWidth, matchHeight_PreferredWidth, MatchFromWidthToHeight));
-							canvasUIItem->SetHeight(FMath::Lerp(matchWidth_PreferredHeight, matchHeight_PreferredHeight, MatchFromWidthToHeight));
-
-							canvasScale = FMath::Lerp(matchWidth_ScaleRatio, matchHeight_ScaleRatio, MatchFromWidthToHeight);
-						}
-						break;
-						case ELGUICanvasScreenMatchMode::Expand:
-						case ELGUICanvasScreenMatchMode::Shrink:
-						{
-							float resultWidth = ViewportSize.X, resultHeight = ViewportSize.Y;
-
-							float screenAspect = (float)ViewportSize.X / ViewportSize.Y;
-							float referenceAspect = ReferenceResolution.X / ReferenceResolution.Y;
-							if (screenAspect > referenceAspect)//screen width > reference width
-							{
-								if (ScreenMatchMode == ELGUICanvasScreenMatchMode::Shrink)
-								{
-									resultHeight = ReferenceResolution.Y;
-									resultWidth = resultHeight * screenAspect;
-									canvasScale = (float)ViewportSize.Y / resultHeight;
-								}
-								else if (ScreenMatchMode == ELGUICanvasScreenMatchMode::Expand)
-								{
-									resultWidth = ReferenceResolution.X;
-									resultHeight = resultWidth / screenAspect;
-									canvasScale = (float)ViewportSize.X / resultWidth;
-								}
-							}
-							else//screen height > reference height
-							{
-								if (ScreenMatchMode == ELGUICanvasScreenMatchMode::Shrink)
-								{
-									resultWidth = ReferenceResolution.X;
-									resultHeight = resultWidth / screenAspect;
-									canvasScale = (float)ViewportSize.X / resultWidth;
-								}
-								else if (ScreenMatchMode == ELGUICanvasScreenMatchMode::Expand)
-								{
-									resultHeight = ReferenceResolution.Y;
-									resultWidth = resultHeight * screenAspect;
-									canvasScale = (float)ViewportSize.Y / resultHeight;
-								}
-							}
-							canvasUIItem->SetWidth(resultWidth);
-							canvasUIItem->SetHeight(resultHeight);
-						}
-						break;
-						}
-					}
-					break;
-					case ELGUICanvasScaleMode::Custom:
+					float canvasWidth = 0, canvasHeight = 0, canvasScale = 1.0f;
+					CalculateCanvasSizeAndScale(canvasWidth, canvasHeight, canvasScale);
+					//result is identical, no need to dirty whole hierarchy
+					if (!InForceApply
+						&& canvasUIItem->GetWidth() == canvasWidth
+						&& canvasUIItem->GetHeight() == canvasHeight
+						&& Canvas->canvasScale == canvasScale
+						)
 					{
-						if (IsValid(CustomScale))
-						{
-							canvasScale = 1.0f;
-							auto ScaledViewportSize = ViewportSize;
-							CustomScale->CalculateSizeAndScale(this, ViewportSize, ScaledViewportSize, canvasScale);
-							canvasUIItem->SetWidth(ScaledViewportSize.X);
-							canvasUIItem->SetHeight(ScaledViewportSize.Y);
-						}
-						else
-						{
-							//default is constant pixel
-							canvasUIItem->SetWidth(ViewportSize.X);
-							canvasUIItem->SetHeight(ViewportSize.Y);
-							canvasScale = 1.0f;
-						}
-					}
-					break;
+						INC_DWORD_STAT(STAT_CanvasScalerApplySkipped);
+						return;
 					}
+					INC_DWORD_STAT(STAT_CanvasScalerApply);
+					canvasUIItem->SetWidth(canvasWidth);
+					canvasUIItem->SetHeight(canvasHeight);
 					Canvas->canvasScale = canvasScale;
 
 					canvasUIItem->MarkAllDirtyRecursive();
@@ -521,7 +543,7 @@ void ULGUICanvasScaler::SetProjectionType(TEnumAsByte<ECameraProjectionMode::Typ
 	if (ProjectionType != value)
 	{
 		ProjectionType = ProjectionType = value;
-		OnViewportParameterChanged();
+		OnViewportParameterChanged(true);
 		SetCanvasProperties();
 	}
 }
@@ -530,7 +552,7 @@ void ULGUICanvasScaler::SetFovAngle(float value)
 	if (FOVAngle != value)
 	{
 		FOVAngle = FOVAngle = value;
-		OnViewportParameterChanged();
+		OnViewportParameterChanged(true);
 		SetCanvasProperties();
 	}
 }
@@ -539,7 +561,7 @@ void ULGUICanvasScaler::SetNearClipPlane(float value)
 	if (NearClipPlane != value)
 	{
 		NearClipPlane = value;
-		OnViewportParameterChanged();
+		OnViewportParameterChanged(true);
 		SetCanvasProperties();
 	}
 }
@@ -548,7 +570,7 @@ void ULGUICanvasScaler::SetFarClipPlane(float value)
 	if (FarClipPlane != value)
 	{
 		FarClipPlane = value;
-		OnViewportParameterChanged();
+		OnViewportParameterChanged(true);
 		SetCanvasProperties();
 	}
 }
@@ -1,14 +1,57 @@
 // Copyright 2019-Present LexLiu. All Rights Reserved.
 
 #include "PlayTween/LGUIPlayTween.h"
+#include "PlayTween/LGUIPlayTweenDriver.h"
 #include "LGUI.h"
 #include "LTweenManager.h"
 
 void ULGUIPlayTween::Stop()
 {
+	if (auto Driver = FLGUIPlayTweenDriver::Get(this))
+	{
+		Driver->Stop(this);
+	}
 	ULTweenManager::KillIfIsTweening(this, tweener, false);
 }
+void ULGUIPlayTween::Reverse()
+{
+	if (auto Driver = FLGUIPlayTweenDriver::Get(this))
+	{
+		ULTweenManager::KillIfIsTweening(this, tweener, false);
+		tweener = nullptr;
+		Driver->Reverse(this);
+	}
+	else
+	{
+		UE_LOG(LGUI, Warning, TEXT("[%s].%d Reverse is only supported in game world, tween: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *this->GetPathName());
+	}
+}
+bool ULGUIPlayTween::IsPlaying()const
+{
+	if (auto Driver = FLGUIPlayTweenDriver::Get(this))
+	{
+		if (Driver->IsPlaying(this))
+		{
+			return true;
+		}
+	}
+	return ULTweenManager::IsTweening(const_cast<ULGUIPlayTween*>(this), tweener);
+}
 void ULGUIPlayTween::Start()
+{
+	auto Driver = FLGUIPlayTweenDriver::IsEnabled() ? FLGUIPlayTweenDriver::Get(this) : nullptr;
+	if (Driver != nullptr)
+	{
+		ULTweenManager::KillIfIsTweening(this, tweener, false);
+		tweener = nullptr;
+		Driver->Play(this);
+	}
+	else
+	{
+		StartWithLTween();
+	}
+}
+void ULGUIPlayTween::StartWithLTween()
 {
 	tweener = ULTweenManager::To(this
 		, FLTweenFloatGetterFunction::CreateLambda([] { return 0.0f; })
@@ -21,22 +64,38 @@ void ULGUIPlayTween::Start()
 		->SetEase(easeType)
 		->SetCurveFloat(easeCurve)
 		->OnStart([&] {
-			onStart.FireEvent();
+			OnTweenStart();
 		})
 		->OnUpdate([&](float progress) {
-			onUpdateProgress.FireEvent(progress);
+			OnTweenUpdateProgress(progress);
 		})
 		->OnCycleComplete([&] {
-			onCycleComplete.FireEvent();
-			onCycleComplete_Delegate.Broadcast(tweener->GetLoopCycleCount());
+			OnTweenCycleComplete(tweener->GetLoopCycleCount());
 		})
 		->OnComplete([&] {
-			onComplete.FireEvent();
-			onComplete_Delegate.Broadcast();
+			OnTweenComplete();
 		})
 		->SetAffectByGamePause(affectByGamePause)
 		->SetAffectByTimeDilation(affectByTimeDilation);
 }
+void ULGUIPlayTween::OnTweenStart()
+{
+	onStart.FireEvent();
+}
+void ULGUIPlayTween::OnTweenUpdateProgress(float progress)
+{
+	onUpdateProgress.FireEvent(progress);
+}
+void ULGUIPlayTween::OnTweenCycleComplete(int32 cycleCompleteCount)
+{
+	onCycleComplete.FireEvent();
+	onCycleComplete_Delegate.Broadcast(cycleCompleteCount);
+}
+void ULGUIPlayTween::OnTweenComplete()
+{
+	onComplete.FireEvent();
+	onComplete_Delegate.Broadcast();
+}
 FDelegateHandle ULGUIPlayTween::RegisterOnComplete(const FSimpleDelegate& InDelegate)
 {
 	return onComplete_Delegate.Add(InDelegate);
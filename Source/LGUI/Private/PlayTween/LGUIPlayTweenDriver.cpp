@@ -0,0 +1,255 @@
+// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#include "PlayTween/LGUIPlayTweenDriver.h"
+#include "PlayTween/LGUIPlayTween.h"
+#include "PlayTween/LGUIPlayTweenSequenceComponent.h"
+#include "Core/LGUIManager.h"
+#include "Curves/CurveFloat.h"
+#include "HAL/IConsoleManager.h"
+#include "LGUI.h"
+
+static TAutoConsoleVariable<int32> CVarPlayTweenSharedDriver(
+	TEXT("lgui.PlayTween.SharedDriver"),
+	1,
+	TEXT("1: LGUIPlayTween play with shared driver in LGUIManagerWorldSubsystem, which reuse slots and don't create tweener. 0: create LTweener for every play."),
+	ECVF_Default);
+
+DECLARE_CYCLE_STAT(TEXT("PlayTween Driver Update"), STAT_PlayTweenDriverUpdate, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("PlayTween Driver Playing Count"), STAT_PlayTweenDriverPlayingCount, STATGROUP_LGUI);
+
+void FLGUIPlayTweenDriverSlot::Compile(ULGUIPlayTween* InPlayTween)
+{
+	PlayTween = InPlayTween;
+	Sequence = nullptr;
+	EaseCurve = InPlayTween->easeCurve;
+	EaseFunction = (InPlayTween->easeType == ELTweenEase::CurveFloat && EaseCurve.IsValid()) ? nullptr : ULTweener::GetEaseFunction(InPlayTween->easeType);
+	Duration = InPlayTween->duration;
+	Delay = FMath::Max(InPlayTween->startDelay, 0.0f);
+	ElapseTime = 0.0f;
+	StartValue = 0.0f;
+	LoopType = InPlayTween->loopType;
+	MaxLoopCount = InPlayTween->loopCount;
+	LoopCycleCount = 0;
+	Serial++;
+	bIsActive = true;
+	bStarted = false;
+	bReverse = false;
+	bAffectByGamePause = InPlayTween->affectByGamePause;
+	bAffectByTimeDilation = InPlayTween->affectByTimeDilation;
+}
+float FLGUIPlayTweenDriverSlot::Evaluate(float InTime)const
+{
+	if (Duration < KINDA_SMALL_NUMBER)return 1.0f + StartValue;
+	if (EaseFunction != nullptr)
+	{
+		return EaseFunction(1.0f, StartValue, InTime, Duration);
+	}
+	if (auto Curve = EaseCurve.Get())
+	{
+		return Curve->GetFloatValue(InTime / Duration) + StartValue;
+	}
+	return ULTweener::Linear(1.0f, StartValue, InTime, Duration);
+}
+
+FLGUIPlayTweenDriver* FLGUIPlayTweenDriver::Get(const UObject* InWorldContextObject)
+{
+	auto World = InWorldContextObject->GetWorld();
+	if (World == nullptr || !World->IsGameWorld())return nullptr;
+	if (auto Instance = ULGUIManagerWorldSubsystem::GetInstance(World))
+	{
+		return &Instance->GetPlayTweenDriver();
+	}
+	return nullptr;
+}
+bool FLGUIPlayTweenDriver::IsEnabled()
+{
+	return CVarPlayTweenSharedDriver.GetValueOnGameThread() != 0;
+}
+
+int32 FLGUIPlayTweenDriver::FindSlot(const ULGUIPlayTween* InPlayTween)const
+{
+	auto SlotIndex = InPlayTween->driverSlotIndex;
+	if (Slots.IsValidIndex(SlotIndex) && Slots[SlotIndex].bIsActive && Slots[SlotIndex].PlayTween.Get() == InPlayTween)
+	{
+		return SlotIndex;
+	}
+	return INDEX_NONE;
+}
+int32 FLGUIPlayTweenDriver::AcquireSlot(ULGUIPlayTween* InPlayTween, int32 InPreferSlotIndex)
+{
+	auto ExistingSlotIndex = FindSlot(InPlayTween);
+	int32 SlotIndex = InPreferSlotIndex;
+	if (SlotIndex == INDEX_NONE)
+	{
+		SlotIndex = ExistingSlotIndex;
+	}
+	else if (ExistingSlotIndex != INDEX_NONE && ExistingSlotIndex != SlotIndex)//tween is playing in another slot, stop it so one tween only have one slot
+	{
+		ReleaseSlot(ExistingSlotIndex);
+	}
+	if (SlotIndex == INDEX_NONE)
+	{
+		if (FreeSlots.Num() > 0)
+		{
+			SlotIndex = FreeSlots.Pop(false);
+		}
+		else
+		{
+			SlotIndex = Slots.AddDefaulted();
+		}
+		INC_DWORD_STAT(STAT_PlayTweenDriverPlayingCount);
+	}
+	Slots[SlotIndex].Compile(InPlayTween);
+	InPlayTween->driverSlotIndex = SlotIndex;
+	return SlotIndex;
+}
+void FLGUIPlayTweenDriver::ReleaseSlot(int32 InSlotIndex)
+{
+	auto& Slot = Slots[InSlotIndex];
+	Slot.PlayTween = nullptr;
+	Slot.Sequence = nullptr;
+	Slot.EaseCurve = nullptr;
+	Slot.bIsActive = false;
+	Slot.Serial++;
+	FreeSlots.Add(InSlotIndex);
+	DEC_DWORD_STAT(STAT_PlayTweenDriverPlayingCount);
+}
+
+void FLGUIPlayTweenDriver::Play(ULGUIPlayTween* InPlayTween)
+{
+	AcquireSlot(InPlayTween, INDEX_NONE);
+}
+int32 FLGUIPlayTweenDriver::PlayInSequence(ULGUIPlayTween* InPlayTween, ULGUIPlayTweenSequenceComponent* InSequence, int32 InSlotIndex)
+{
+	if (!(Slots.IsValidIndex(InSlotIndex) && Slots[InSlotIndex].bIsActive && Slots[InSlotIndex].Sequence.Get() == InSequence))//slot is not owned by the sequence anymore
+	{
+		InSlotIndex = INDEX_NONE;
+	}
+	auto SlotIndex = AcquireSlot(InPlayTween, InSlotIndex);
+	Slots[SlotIndex].Sequence = InSequence;
+	return SlotIndex;
+}
+void FLGUIPlayTweenDriver::Stop(ULGUIPlayTween* InPlayTween)
+{
+	auto SlotIndex = FindSlot(InPlayTween);
+	if (SlotIndex != INDEX_NONE)
+	{
+		ReleaseSlot(SlotIndex);
+	}
+}
+void FLGUIPlayTweenDriver::Reverse(ULGUIPlayTween* InPlayTween)
+{
+	auto SlotIndex = FindSlot(InPlayTween);
+	if (SlotIndex == INDEX_NONE)
+	{
+		SlotIndex = AcquireSlot(InPlayTween, INDEX_NONE);
+		Slots[SlotIndex].bReverse = true;
+		return;
+	}
+	auto& Slot = Slots[SlotIndex];
+	Slot.bReverse = !Slot.bReverse;
+	if (Slot.bStarted)//mirror time inside current cycle, so value continue from current
+	{
+		float CycleStartTime = Slot.Delay + Slot.Duration * Slot.LoopCycleCount;
+		float CurrentTime = FMath::Clamp(Slot.ElapseTime - CycleStartTime, 0.0f, Slot.Duration);
+		Slot.ElapseTime = CycleStartTime + Slot.Duration - CurrentTime;
+	}
+	Slot.Serial++;//if called inside tween's callback, Update will not overwrite the slot with old copy
+}
+bool FLGUIPlayTweenDriver::IsPlaying(const ULGUIPlayTween* InPlayTween)const
+{
+	return FindSlot(InPlayTween) != INDEX_NONE;
+}
+
+void FLGUIPlayTweenDriver::Update(UWorld* InWorld)
+{
+	if (Slots.Num() == FreeSlots.Num())return;
+	SCOPE_CYCLE_COUNTER(STAT_PlayTweenDriverUpdate);
+	bool bIsGamePaused = InWorld->IsPaused();
+	float DeltaTime = InWorld->DeltaTimeSeconds;
+	float UnscaledDeltaTime = InWorld->DeltaRealTimeSeconds;
+	auto Count = Slots.Num();//slot added by callback will start update from next frame
+	for (int i = 0; i < Count; i++)
+	{
+		if (!Slots[i].bIsActive)continue;
+		//update a copy, because callbacks may play or stop tweens, which can change or reallocate the slot array
+		auto Slot = Slots[i];
+		bool bIsPlaying = UpdateSlot(i, Slot, bIsGamePaused, DeltaTime, UnscaledDeltaTime);
+		auto& SlotInArray = Slots[i];
+		if (SlotInArray.Serial != Slot.Serial)continue;//slot is played again or stopped inside callback
+		if (bIsPlaying)
+		{
+			SlotInArray = Slot;
+		}
+		else
+		{
+			ReleaseSlot(i);
+		}
+	}
+}
+bool FLGUIPlayTweenDriver::UpdateSlot(int32 InSlotIndex, FLGUIPlayTweenDriverSlot& InOutSlot, bool InIsGamePaused, float InDeltaTime, float InUnscaledDeltaTime)
+{
+	auto Target = InOutSlot.PlayTween.Get();
+	if (!IsValid(Target))return false;
+	if (InIsGamePaused && InOutSlot.bAffectByGamePause)return true;
+
+	InOutSlot.ElapseTime += InOutSlot.bAffectByTimeDilation ? InDeltaTime : InUnscaledDeltaTime;
+	if (InOutSlot.ElapseTime <= InOutSlot.Delay)return true;//waiting delay
+	if (!InOutSlot.bStarted)
+	{
+		InOutSlot.bStarted = true;
+		Target->OnTweenStart();
+	}
+
+	float CurrentTime = InOutSlot.ElapseTime - InOutSlot.Delay - InOutSlot.Duration * InOutSlot.LoopCycleCount;
+	if (CurrentTime >= InOutSlot.Duration)
+	{
+		InOutSlot.LoopCycleCount++;
+		bool bIsComplete = InOutSlot.LoopType == ELTweenLoop::Once
+			|| (InOutSlot.MaxLoopCount > -1 && InOutSlot.LoopCycleCount >= InOutSlot.MaxLoopCount);
+
+		Target->OnUpdate(InOutSlot.Evaluate(InOutSlot.bReverse ? 0 : InOutSlot.Duration));
+		Target->OnTweenUpdateProgress(1.0f);
+		Target->OnTweenCycleComplete(InOutSlot.LoopCycleCount);
+		auto Sequence = InOutSlot.Sequence.Get();
+		if (IsValid(Sequence) && Sequence->bPlayNextWhenCycleComplete)
+		{
+			if (!bIsComplete)//this tween still have cycles to play, so keep the slot for this tween, and sequence will use a new slot
+			{
+				InOutSlot.Sequence = nullptr;
+				Slots[InSlotIndex].Sequence = nullptr;
+			}
+			Sequence->OnTweenComplete();
+		}
+		if (bIsComplete)
+		{
+			Target->OnTweenComplete();
+			if (IsValid(Sequence) && !Sequence->bPlayNextWhenCycleComplete)
+			{
+				Sequence->OnTweenComplete();
+			}
+			return false;
+		}
+
+		switch (InOutSlot.LoopType)
+		{
+		case ELTweenLoop::Yoyo:
+			InOutSlot.bReverse = !InOutSlot.bReverse;
+			break;
+		case ELTweenLoop::Incremental:
+			InOutSlot.StartValue += 1.0f;
+			break;
+		}
+		return true;
+	}
+	else
+	{
+		if (InOutSlot.bReverse)
+		{
+			CurrentTime = InOutSlot.Duration - CurrentTime;
+		}
+		Target->OnUpdate(InOutSlot.Evaluate(CurrentTime));
+		Target->OnTweenUpdateProgress(CurrentTime / InOutSlot.Duration);
+		return true;
+	}
+}
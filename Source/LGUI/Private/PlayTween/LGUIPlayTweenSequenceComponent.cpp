@@ -2,6 +2,7 @@
 
 #include "PlayTween/LGUIPlayTweenSequenceComponent.h"
 #include "PlayTween/LGUIPlayTween.h"
+#include "PlayTween/LGUIPlayTweenDriver.h"
 #include "LTweener.h"
 #include "LTweenManager.h"
 #include "PrefabSystem/LGUIPrefabManager.h"
@@ -21,38 +22,54 @@ void ULGUIPlayTweenSequenceComponent::Awake_Implementation()
 		Play();
 	}
 }
-void ULGUIPlayTweenSequenceComponent::OnTweenComplete()
+void ULGUIPlayTweenSequenceComponent::PlayTweenAtCurrentIndex()
 {
+	auto& tweenItem = playTweenArray[currentTweenPlayIndex];
+	auto Driver = FLGUIPlayTweenDriver::IsEnabled() ? FLGUIPlayTweenDriver::Get(this) : nullptr;
+	bIsPlayingWithDriver = Driver != nullptr;
+	if (bIsPlayingWithDriver)
+	{
+		//driver will call OnTweenComplete
+		driverSlotIndex = Driver->PlayInSequence(tweenItem, this, driverSlotIndex);
+		return;
+	}
 	if (bPlayNextWhenCycleComplete)
 	{
-		playTweenArray[currentTweenPlayIndex]->UnregisterOnCycleComplete(onCompleteDelegateHandle);
+		onCompleteDelegateHandle = tweenItem->RegisterOnCycleComplete(FLGUIInt32Delegate::CreateWeakLambda(this, [this](int count) {
+			OnTweenComplete();
+			}));
 	}
 	else
 	{
-		playTweenArray[currentTweenPlayIndex]->UnregisterOnComplete(onCompleteDelegateHandle);
+		onCompleteDelegateHandle = tweenItem->RegisterOnComplete(FSimpleDelegate::CreateUObject(this, &ULGUIPlayTweenSequenceComponent::OnTweenComplete));
+	}
+	tweenItem->Start();
+}
+void ULGUIPlayTweenSequenceComponent::OnTweenComplete()
+{
+	if (!bIsPlayingWithDriver)
+	{
+		if (bPlayNextWhenCycleComplete)
+		{
+			playTweenArray[currentTweenPlayIndex]->UnregisterOnCycleComplete(onCompleteDelegateHandle);
+		}
+		else
+		{
+			playTweenArray[currentTweenPlayIndex]->UnregisterOnComplete(onCompleteDelegateHandle);
+		}
 	}
 
 	currentTweenPlayIndex++;
 	if (currentTweenPlayIndex >= playTweenArray.Num())
 	{
 		isPlaying = false;
+		driverSlotIndex = INDEX_NONE;
 		onComplete.FireEvent();
 		onComplete_Delegate.Broadcast();
 	}
 	else
 	{
-		auto& tweenItem = playTweenArray[currentTweenPlayIndex];
-		if (bPlayNextWhenCycleComplete)
-		{
-			onCompleteDelegateHandle = tweenItem->RegisterOnCycleComplete(FLGUIInt32Delegate::CreateWeakLambda(this, [this](int count) {
-				OnTweenComplete();
-				}));
-		}
-		else
-		{
-			onCompleteDelegateHandle = tweenItem->RegisterOnComplete(FSimpleDelegate::CreateUObject(this, &ULGUIPlayTweenSequenceComponent::OnTweenComplete));
-		}
-		tweenItem->Start();
+		PlayTweenAtCurrentIndex();
 	}
 }
 
@@ -89,18 +106,8 @@ void ULGUIPlayTweenSequenceComponent::Play()
 		{
 			isPlaying = true;
 			currentTweenPlayIndex = 0;
-			auto& tweenItem = playTweenArray[currentTweenPlayIndex];
-			if (bPlayNextWhenCycleComplete)
-			{
-				onCompleteDelegateHandle = tweenItem->RegisterOnCycleComplete(FLGUIInt32Delegate::CreateWeakLambda(this, [this](int count) {
-					OnTweenComplete();
-					}));
-			}
-			else
-			{
-				onCompleteDelegateHandle = tweenItem->RegisterOnComplete(FSimpleDelegate::CreateUObject(this, &ULGUIPlayTweenSequenceComponent::OnTweenComplete));
-			}
-			tweenItem->Start();
+			driverSlotIndex = INDEX_NONE;
+			PlayTweenAtCurrentIndex();
 		}
 	}
 }
@@ -110,7 +117,15 @@ void ULGUIPlayTweenSequenceComponent::Stop()
 	{
 		isPlaying = false;
 		auto& tweenItem = playTweenArray[currentTweenPlayIndex];
-		tweenItem->UnregisterOnComplete(onCompleteDelegateHandle);
-		ULTweenManager::KillIfIsTweening(this, tweenItem->GetTweener(), false);
+		if (bIsPlayingWithDriver)
+		{
+			tweenItem->Stop();
+			driverSlotIndex = INDEX_NONE;
+		}
+		else
+		{
+			tweenItem->UnregisterOnComplete(onCompleteDelegateHandle);
+			tweenItem->Stop();
+		}
 	}
 }
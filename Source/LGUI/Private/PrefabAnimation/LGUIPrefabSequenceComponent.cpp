@@ -98,27 +98,64 @@ UBlueprint* ULGUIPrefabSequenceComponent::GetSequenceBlueprint()const
 }
 #endif
 
-ULGUIPrefabSequence* ULGUIPrefabSequenceComponent::GetSequenceByName(FName InName) const
+void ULGUIPrefabSequenceComponent::RebuildSequenceNameCache()const
 {
-	for (auto Item : SequenceArray)
+	SequenceDisplayNameToIndex.Reset();
+	SequenceNameToIndex.Reset();
+	for (int i = 0; i < SequenceArray.Num(); i++)
 	{
-		if (Item->GetFName() == InName)
+		if (auto Item = SequenceArray[i])
 		{
-			return Item;
+			//keep the first one if have same name, same as linear search
+			if (!SequenceDisplayNameToIndex.Contains(Item->GetDisplayNameString()))
+			{
+				SequenceDisplayNameToIndex.Add(Item->GetDisplayNameString(), i);
+			}
+			if (!SequenceNameToIndex.Contains(Item->GetFName()))
+			{
+				SequenceNameToIndex.Add(Item->GetFName(), i);
+			}
 		}
 	}
-	return nullptr;
 }
-ULGUIPrefabSequence* ULGUIPrefabSequenceComponent::GetSequenceByDisplayName(const FString& InName) const
+int32 ULGUIPrefabSequenceComponent::FindSequenceIndexByDisplayName(const FString& InName)const
 {
-	for (auto Item : SequenceArray)
+	auto IsValidIndex = [this, &InName](const int32* InIndexPtr) {
+		return InIndexPtr != nullptr && SequenceArray.IsValidIndex(*InIndexPtr) && SequenceArray[*InIndexPtr] != nullptr
+			&& SequenceArray[*InIndexPtr]->GetDisplayNameString() == InName;
+	};
+	auto IndexPtr = SequenceDisplayNameToIndex.Find(InName);
+	if (!IsValidIndex(IndexPtr))
 	{
-		if (Item->GetDisplayNameString() == InName)
-		{
-			return Item;
-		}
+		RebuildSequenceNameCache();
+		IndexPtr = SequenceDisplayNameToIndex.Find(InName);
 	}
-	return nullptr;
+	return IndexPtr != nullptr ? *IndexPtr : INDEX_NONE;
+}
+int32 ULGUIPrefabSequenceComponent::FindSequenceIndexByName(FName InName)const
+{
+	auto IsValidIndex = [this, InName](const int32* InIndexPtr) {
+		return InIndexPtr != nullptr && SequenceArray.IsValidIndex(*InIndexPtr) && SequenceArray[*InIndexPtr] != nullptr
+			&& SequenceArray[*InIndexPtr]->GetFName() == InName;
+	};
+	auto IndexPtr = SequenceNameToIndex.Find(InName);
+	if (!IsValidIndex(IndexPtr))
+	{
+		RebuildSequenceNameCache();
+		IndexPtr = SequenceNameToIndex.Find(InName);
+	}
+	return IndexPtr != nullptr ? *IndexPtr : INDEX_NONE;
+}
+
+ULGUIPrefabSequence* ULGUIPrefabSequenceComponent::GetSequenceByName(FName InName) const
+{
+	auto FoundIndex = FindSequenceIndexByName(InName);
+	return FoundIndex != INDEX_NONE ? SequenceArray[FoundIndex] : nullptr;
+}
+ULGUIPrefabSequence* ULGUIPrefabSequenceComponent::GetSequenceByDisplayName(const FString& InName) const
+{
+	auto FoundIndex = FindSequenceIndexByDisplayName(InName);
+	return FoundIndex != INDEX_NONE ? SequenceArray[FoundIndex] : nullptr;
 }
 ULGUIPrefabSequence* ULGUIPrefabSequenceComponent::GetSequenceByIndex(int32 InIndex) const
 {
@@ -153,10 +190,7 @@ void ULGUIPrefabSequenceComponent::SetSequenceByIndex(int32 InIndex)
 }
 void ULGUIPrefabSequenceComponent::SetSequenceByName(FName InName)
 {
-	int FoundIndex = -1;
-	FoundIndex = SequenceArray.IndexOfByPredicate([InName](const ULGUIPrefabSequence* Item) {
-		return Item->GetFName() == InName;
-		});
+	int FoundIndex = FindSequenceIndexByName(InName);
 	if (FoundIndex != INDEX_NONE)
 	{
 		CurrentSequenceIndex = FoundIndex;
@@ -165,10 +199,7 @@ void ULGUIPrefabSequenceComponent::SetSequenceByName(FName InName)
 }
 void ULGUIPrefabSequenceComponent::SetSequenceByDisplayName(const FString& InName)
 {
-	int FoundIndex = -1;
-	FoundIndex = SequenceArray.IndexOfByPredicate([InName](const ULGUIPrefabSequence* Item) {
-		return Item->GetDisplayNameString() == InName;
-		});
+	int FoundIndex = FindSequenceIndexByDisplayName(InName);
 	if (FoundIndex != INDEX_NONE)
 	{
 		CurrentSequenceIndex = FoundIndex;
@@ -181,6 +212,8 @@ ULGUIPrefabSequence* ULGUIPrefabSequenceComponent::AddNewAnimation()
 	auto NewSequence = NewObject<ULGUIPrefabSequence>(this, NAME_None, RF_Public | RF_Transactional);
 	auto MovieScene = NewSequence->GetMovieScene();
 	SequenceArray.Add(NewSequence);
+	SequenceDisplayNameToIndex.Reset();
+	SequenceNameToIndex.Reset();
 	return NewSequence;
 }
 
@@ -196,6 +229,8 @@ bool ULGUIPrefabSequenceComponent::DeleteAnimationByIndex(int32 InIndex)
 		SequenceItem->ConditionalBeginDestroy();
 	}
 	SequenceArray.RemoveAt(InIndex);
+	SequenceDisplayNameToIndex.Reset();
+	SequenceNameToIndex.Reset();
 	return true;
 }
 ULGUIPrefabSequence* ULGUIPrefabSequenceComponent::DuplicateAnimationByIndex(int32 InIndex)
@@ -214,5 +249,7 @@ ULGUIPrefabSequence* ULGUIPrefabSequenceComponent::DuplicateAnimationByIndex(int
 		NewSequence->GetMovieScene()->SetDisplayRate(SourceSequence->GetMovieScene()->GetDisplayRate());
 	}
 	SequenceArray.Insert(NewSequence, InIndex + 1);
+	SequenceDisplayNameToIndex.Reset();
+	SequenceNameToIndex.Reset();
 	return NewSequence;
 }
@@ -31,7 +31,7 @@ FString FLGUIPrefabSequenceObjectReference::GetActorPathRelativeToContextActor(A
 	}
 	return TEXT("");
 }
-AActor* FLGUIPrefabSequenceObjectReference::GetActorFromContextActorByRelativePath(AActor* InContextActor, const FString& InPath)
+AActor* FLGUIPrefabSequenceObjectReference::GetActorFromContextActorByRelativePath(AActor* InContextActor, const FString& InPath, TMap<FString, AActor*>* InOutPathCache)
 {
 	if (InPath == TEXT("/"))
 	{
@@ -39,29 +39,38 @@ AActor* FLGUIPrefabSequenceObjectReference::GetActorFromContextActorByRelativePa
 	}
 	else
 	{
+		if (InOutPathCache != nullptr)
+		{
+			if (auto FoundActorPtr = InOutPathCache->Find(InPath))
+			{
+				return *FoundActorPtr;
+			}
+		}
 		TArray<FString> SplitedArray;
+		InPath.ParseIntoArray(SplitedArray, TEXT("/"), false);
+
+		AActor* ParentActor = InContextActor;
+		int StartIndex = 0;
+		if (InOutPathCache != nullptr)
 		{
-			if (InPath.Contains(TEXT("/")))
+			//start from the deepest cached parent
+			FString ParentPath;
+			for (int i = 0; i + 1 < SplitedArray.Num(); i++)
 			{
-				FString SourceString = InPath;
-				FString Left, Right;
-				TArray<AActor*> ChildrenActors;
-				while (SourceString.Split(TEXT("/"), &Left, &Right, ESearchCase::CaseSensitive))
+				ParentPath = i == 0 ? SplitedArray[i] : ParentPath + TEXT("/") + SplitedArray[i];
+				if (auto FoundActorPtr = InOutPathCache->Find(ParentPath))
 				{
-					SplitedArray.Add(Left);
-					SourceString = Right;
+					ParentActor = *FoundActorPtr;
+					StartIndex = i + 1;
+				}
+				else
+				{
+					break;
 				}
-				SplitedArray.Add(Right);
-			}
-			else
-			{
-				SplitedArray.Add(InPath);
 			}
 		}
-
-		AActor* ParentActor = InContextActor;
 		TArray<AActor*> ChildrenActors;
-		for (int i = 0; i < SplitedArray.Num(); i++)
+		for (int i = StartIndex; i < SplitedArray.Num(); i++)
 		{
 			auto& PathItem = SplitedArray[i];
 			ParentActor->GetAttachedActors(ChildrenActors);
@@ -76,6 +85,10 @@ AActor* FLGUIPrefabSequenceObjectReference::GetActorFromContextActorByRelativePa
 			}
 			if (FoundChildActor != nullptr)
 			{
+				if (InOutPathCache != nullptr)
+				{
+					InOutPathCache->Add(FString::Join(TArrayView<FString>(SplitedArray.GetData(), i + 1), TEXT("/")), FoundChildActor);
+				}
 				if (i + 1 == SplitedArray.Num())
 				{
 					return FoundChildActor;
@@ -90,9 +103,9 @@ AActor* FLGUIPrefabSequenceObjectReference::GetActorFromContextActorByRelativePa
 	}
 	return nullptr;
 }
-bool FLGUIPrefabSequenceObjectReference::FixObjectReferenceFromEditorHelpers(AActor* InContextActor)
+bool FLGUIPrefabSequenceObjectReference::FixObjectReferenceFromEditorHelpers(AActor* InContextActor, TMap<FString, AActor*>* InOutPathCache)
 {
-	if (auto FoundHelperActor = GetActorFromContextActorByRelativePath(InContextActor, this->HelperActorPath))
+	if (auto FoundHelperActor = GetActorFromContextActorByRelativePath(InContextActor, this->HelperActorPath, InOutPathCache))
 	{
 		HelperActor = FoundHelperActor;
 		HelperActorLabel = HelperActor->GetActorLabel();
@@ -220,23 +233,29 @@ bool FLGUIPrefabSequenceObjectReference::CheckTargetObject()const
 			}
 			else
 			{
-				TArray<UActorComponent*> Components;
-				HelperActor->GetComponents(HelperClass, Components);
-				if (Components.Num() == 1)
+				//single pass without collecting components: if only one component match class then use it, otherwise use the one match name
+				UActorComponent* FirstMatchClass = nullptr;
+				int MatchClassCount = 0;
+				for (auto Comp : HelperActor->GetComponents())
 				{
-					Object = Components[0];
-					return true;
-				}
-				else if (Components.Num() > 1)
-				{
-					for (auto Comp : Components)
+					if (Comp == nullptr || !Comp->IsA(HelperClass))
+					{
+						continue;
+					}
+					if (Comp->GetFName() == HelperComponentName)
 					{
-						if (Comp->GetFName() == HelperComponentName)
-						{
-							Object = Comp;
-							return true;
-						}
+						Object = Comp;
+						return true;
 					}
+					if (MatchClassCount++ == 0)
+					{
+						FirstMatchClass = Comp;
+					}
+				}
+				if (MatchClassCount == 1)
+				{
+					Object = FirstMatchClass;
+					return true;
 				}
 			}
 		}
@@ -250,30 +269,64 @@ UObject* FLGUIPrefabSequenceObjectReference::Resolve() const
 	return Object;
 }
 
+int32 FLGUIPrefabSequenceObjectReferenceMap::FindBindingIndex(const FGuid& ObjectId)const
+{
+	if (!bBindingIdToIndexValid)
+	{
+		bBindingIdToIndexValid = true;
+		BindingIdToIndex.Reset();
+		BindingIdToIndex.Reserve(BindingIds.Num());
+		for (int i = 0; i < BindingIds.Num(); i++)
+		{
+			BindingIdToIndex.Add(BindingIds[i], i);
+		}
+	}
+	if (auto IndexPtr = BindingIdToIndex.Find(ObjectId))
+	{
+		return *IndexPtr;
+	}
+	return INDEX_NONE;
+}
+
+void FLGUIPrefabSequenceObjectReferenceMap::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		bBindingIdToIndexValid = false;
+	}
+}
+
 bool FLGUIPrefabSequenceObjectReferenceMap::HasBinding(const FGuid& ObjectId) const
 {
-	return BindingIds.Contains(ObjectId);
+	return FindBindingIndex(ObjectId) != INDEX_NONE;
 }
 
 void FLGUIPrefabSequenceObjectReferenceMap::RemoveBinding(const FGuid& ObjectId)
 {
-	int32 Index = BindingIds.IndexOfByKey(ObjectId);
+	int32 Index = FindBindingIndex(ObjectId);
 	if (Index != INDEX_NONE)
 	{
 		BindingIds.RemoveAtSwap(Index, 1, false);
 		References.RemoveAtSwap(Index, 1, false);
+		//RemoveAtSwap move last binding to this index
+		BindingIdToIndex.Remove(ObjectId);
+		if (BindingIds.IsValidIndex(Index))
+		{
+			BindingIdToIndex.Add(BindingIds[Index], Index);
+		}
 	}
 }
 
 void FLGUIPrefabSequenceObjectReferenceMap::CreateBinding(const FGuid& ObjectId, const FLGUIPrefabSequenceObjectReference& ObjectReference)
 {
-	int32 ExistingIndex = BindingIds.IndexOfByKey(ObjectId);
+	int32 ExistingIndex = FindBindingIndex(ObjectId);
 	if (ExistingIndex == INDEX_NONE)
 	{
 		ExistingIndex = BindingIds.Num();
 
 		BindingIds.Add(ObjectId);
 		References.AddDefaulted();
+		BindingIdToIndex.Add(ObjectId, ExistingIndex);
 	}
 
 	References[ExistingIndex].Array.AddUnique(ObjectReference);
@@ -281,7 +334,7 @@ void FLGUIPrefabSequenceObjectReferenceMap::CreateBinding(const FGuid& ObjectId,
 
 void FLGUIPrefabSequenceObjectReferenceMap::ResolveBinding(const FGuid& ObjectId, TArray<UObject*, TInlineAllocator<1>>& OutObjects) const
 {
-	int32 Index = BindingIds.IndexOfByKey(ObjectId);
+	int32 Index = FindBindingIndex(ObjectId);
 	if (Index == INDEX_NONE)
 	{
 		return;
@@ -328,13 +381,14 @@ bool FLGUIPrefabSequenceObjectReferenceMap::IsEditorHelpersGood(AActor* InContex
 bool FLGUIPrefabSequenceObjectReferenceMap::FixObjectReferences(AActor* InContextActor)
 {
 	bool anythingChanged = false;
+	TMap<FString, AActor*> PathCache;
 	for (auto& Reference : References)
 	{
 		for (auto& RefItem : Reference.Array)
 		{
 			if (!RefItem.IsObjectReferenceGood(InContextActor) && RefItem.CanFixObjectReferenceFromEditorHelpers())
 			{
-				if (RefItem.FixObjectReferenceFromEditorHelpers(InContextActor))
+				if (RefItem.FixObjectReferenceFromEditorHelpers(InContextActor, &PathCache))
 				{
 					anythingChanged = true;
 				}
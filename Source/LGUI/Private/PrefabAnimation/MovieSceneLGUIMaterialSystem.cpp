@@ -1,4 +1,4 @@
-// Copyright Epic Games, Inc. All Rights Reserved.
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "PrefabAnimation/MovieSceneLGUIMaterialSystem.h"
 #include "PrefabAnimation/MovieSceneLGUIComponentTypes.h"
@@ -13,6 +13,17 @@
 #include "Materials/MaterialInstanceDynamic.h"
 
 #include "Core/ActorComponent/UIBatchMeshRenderable.h"
+#include "Core/Actor/UIContainerActor.h"
+#include "Core/Actor/UISpriteActor.h"
+#include "PrefabAnimation/LGUIPrefabSequence.h"
+#include "PrefabAnimation/LGUIPrefabSequenceComponent.h"
+#include "PrefabAnimation/LGUIPrefabSequencePlayer.h"
+#include "PrefabAnimation/MovieSceneLGUIMaterialTrack.h"
+#include "Sections/MovieSceneParameterSection.h"
+#include "MovieScene.h"
+#include "Materials/Material.h"
+#include "Engine/World.h"
+#include "LGUI.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(MovieSceneLGUIMaterialSystem)
 
@@ -55,13 +66,9 @@ void FLGUIMaterialAccessor::SetMaterial(UMaterialInterface* InMaterial) const
 
 UMaterialInstanceDynamic* FLGUIMaterialAccessor::CreateDynamicMaterial(UMaterialInterface* InMaterial)
 {
-	// Need to create a new MID, either because the parent has changed, or because one doesn't already exist
-	TStringBuilder<128> DynamicName;
-	InMaterial->GetFName().ToString(DynamicName);
-	DynamicName.Append(TEXT("_Animated"));
-	FName UniqueDynamicName = MakeUniqueObjectName(Renderable, UMaterialInstanceDynamic::StaticClass() , DynamicName.ToString());
-
-	UMaterialInstanceDynamic* MID = UMaterialInstanceDynamic::Create(InMaterial, Renderable, UniqueDynamicName);
+	// Need a MID, either because the parent has changed, or because one doesn't already exist.
+	// MID is pooled on the renderable, so replaying an animation don't create new MID. Parameter values are cleared on reuse.
+	UMaterialInstanceDynamic* MID = Renderable->GetOrCreateAnimatedCustomUIMaterial(InMaterial);
 	SetMaterial(MID);
 	return MID;
 }
@@ -129,3 +136,131 @@ void UMovieSceneLGUIMaterialSystem::SavePreAnimatedState(const FPreAnimationPara
 
 	SystemImpl.SavePreAnimatedState(Linker, BuiltInComponents->BoundObject, LGUIComponents->LGUIMaterialPath, InParameters);
 }
+
+#if !UE_BUILD_SHIPPING
+/** Build a prefab sequence that animate CustomUIMaterial parameters of many sprites, evaluate it through sequence player, check the animated value and restore, and log the time. */
+struct FLGUIMaterialTrackBenchmark
+{
+	static void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 BindingCount = FMath::Max(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200, 1);
+		const int32 ParameterCount = FMath::Max(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 4, 1);
+		const int32 FrameCount = FMath::Max(Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 300, 1);
+		if (World == nullptr)
+		{
+			UE_LOG(LGUI, Error, TEXT("[%s] Need a world to spawn actors"), ANSI_TO_TCHAR(__FUNCTION__));
+			return;
+		}
+
+		const int32 DisplayFrameCount = 30;//one second at 30fps
+		auto RootActor = World->SpawnActor<AUIContainerActor>();
+		auto SequenceComp = NewObject<ULGUIPrefabSequenceComponent>(RootActor);
+		SequenceComp->RegisterComponent();
+		auto Sequence = SequenceComp->AddNewAnimation();
+		auto MovieScene = Sequence->GetMovieScene();
+		MovieScene->SetTickResolutionDirectly(FFrameRate(60000, 1));
+		MovieScene->SetDisplayRate(FFrameRate(DisplayFrameCount, 1));
+		const FFrameNumber EndFrame(60000);
+		MovieScene->SetPlaybackRange(TRange<FFrameNumber>(FFrameNumber(0), EndFrame));
+
+		TArray<FName> ParameterNames;
+		for (int32 i = 0; i < ParameterCount; i++)
+		{
+			ParameterNames.Add(FName(TEXT("LGUIBenchmarkParameter"), i + 1));
+		}
+		auto ParentMaterial = UMaterial::GetDefaultMaterial(MD_Surface);
+		TArray<AUISpriteActor*> SpriteActors;
+		for (int32 i = 0; i < BindingCount; i++)
+		{
+			auto SpriteActor = World->SpawnActor<AUISpriteActor>();
+			SpriteActor->AttachToActor(RootActor, FAttachmentTransformRules::KeepRelativeTransform);
+			SpriteActors.Add(SpriteActor);
+			auto Sprite = SpriteActor->GetUISprite();
+			Sprite->SetCustomUIMaterial(ParentMaterial);
+
+			const FGuid BindingId = MovieScene->AddPossessable(Sprite->GetName(), Sprite->GetClass());
+			Sequence->BindPossessableObject(BindingId, *Sprite, RootActor);
+			auto Track = MovieScene->AddTrack<UMovieSceneLGUIMaterialTrack>(BindingId);
+			Track->SetPropertyName(UUIBatchMeshRenderable::GetCustomUIMaterialPropertyName());
+			auto Section = CastChecked<UMovieSceneParameterSection>(Track->CreateNewSection());
+			Section->SetRange(TRange<FFrameNumber>(FFrameNumber(0), EndFrame));
+			for (auto& ParameterName : ParameterNames)
+			{
+				Section->AddScalarParameterKey(ParameterName, FFrameNumber(0), 0.0f);
+				Section->AddScalarParameterKey(ParameterName, EndFrame, 1.0f);
+			}
+			Track->AddSection(*Section);
+		}
+
+		SequenceComp->InitSequencePlayer();
+		auto Player = SequenceComp->GetSequencePlayer();
+		auto Evaluate = [&]() {
+			Player->Play();
+			auto StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < FrameCount; i++)
+			{
+				Player->SetPlaybackPosition(FMovieSceneSequencePlaybackParams(FFrameTime(i % DisplayFrameCount), EUpdatePositionMethod::Play));
+			}
+			const double Time = FPlatformTime::Seconds() - StartTime;
+			//stop at middle so every parameter should be 0.5
+			Player->SetPlaybackPosition(FMovieSceneSequencePlaybackParams(FFrameTime(DisplayFrameCount / 2), EUpdatePositionMethod::Jump));
+			return Time;
+		};
+		auto CountMismatch = [&]() {
+			int32 MismatchCount = 0;
+			for (auto SpriteActor : SpriteActors)
+			{
+				auto MID = Cast<UMaterialInstanceDynamic>(SpriteActor->GetUISprite()->GetCustomUIMaterial());
+				for (auto& ParameterName : ParameterNames)
+				{
+					float Value = 0;
+					if (MID == nullptr || !MID->GetScalarParameterValue(FHashedMaterialParameterInfo(ParameterName), Value, true) || !FMath::IsNearlyEqual(Value, 0.5f, 0.01f))
+					{
+						MismatchCount++;
+					}
+				}
+			}
+			return MismatchCount;
+		};
+		auto CountNotRestored = [&]() {
+			int32 NotRestoredCount = 0;
+			for (auto SpriteActor : SpriteActors)
+			{
+				if (SpriteActor->GetUISprite()->GetCustomUIMaterial() != ParentMaterial)
+				{
+					NotRestoredCount++;
+				}
+			}
+			return NotRestoredCount;
+		};
+
+		//first play create MID for every binding, replay reuse them
+		const double FirstPlayTime = Evaluate();
+		int32 MismatchCount = CountMismatch();
+		Player->Stop();
+		int32 NotRestoredCount = CountNotRestored();
+		const double ReplayTime = Evaluate();
+		MismatchCount += CountMismatch();
+		Player->Stop();
+		NotRestoredCount += CountNotRestored();
+
+		const bool bPass = MismatchCount == 0 && NotRestoredCount == 0;
+		UE_LOG(LGUI, Log, TEXT("[%s] %s. %d bindings x %d parameters, %d frames, first play: %.3fms (%.4fms/frame), replay: %.3fms (%.4fms/frame), mismatch: %d, not restored: %d")
+			, ANSI_TO_TCHAR(__FUNCTION__), bPass ? TEXT("PASS") : TEXT("FAIL")
+			, BindingCount, ParameterCount, FrameCount
+			, FirstPlayTime * 1000, FirstPlayTime * 1000 / FrameCount, ReplayTime * 1000, ReplayTime * 1000 / FrameCount
+			, MismatchCount, NotRestoredCount);
+
+		Player->TearDown();
+		for (int32 i = SpriteActors.Num() - 1; i >= 0; i--)
+		{
+			SpriteActors[i]->Destroy();
+		}
+		RootActor->Destroy();
+	}
+};
+static FAutoConsoleCommand LGUIMaterialTrackBenchmarkCommand(
+	TEXT("lgui.PrefabAnimation.MaterialTrackBenchmark"),
+	TEXT("Spawn many sprites and a prefab sequence animating their CustomUIMaterial parameters, evaluate it headless through sequence player, check result and log the time. Args: [BindingCount=200] [ParameterCount=4] [FrameCount=300]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&FLGUIMaterialTrackBenchmark::Run));
+#endif
@@ -175,6 +175,10 @@ public:
 	void MarkCanvasUpdate(bool bMaterialOrTextureChanged, bool bTransformOrVertexPositionChanged, bool bHierarchyOrderChanged, bool bForceRebuildDrawcall = false);
 	void MarkCanvasUpdateRecursive(bool bMaterialOrTextureChanged, bool bTransformOrVertexPositionChanged, bool bHierarchyOrderChanged, bool bForceRebuildDrawcall = false);
 	void MarkItemTransformOrVertexPositionChanged(UUIBaseRenderable* InRenderable);
+	/** Canvas's transform changed, all cached UI element to canvas transform need to recalculate */
+	void MarkCanvasTransformChanged();
+	/** Release the cached transform slot of the renderable, call this when renderable is removed from this canvas */
+	void ReleaseCacheTransformSlot(UUIBaseRenderable* InRenderable);
 
 	/** is point visible in Canvas. may not visible if use clip. texture clip just return true. rect clip will ignore feather value */
 	bool CalculatePointVisibilityOnClip(const FVector& worldPoint);
@@ -618,6 +622,7 @@ private:
 	mutable FMatrix cacheViewProjectionMatrix = FMatrix::Identity;//cache to prevent multiple calculation in same frame
 	mutable float LastRenderTime = 0;
 	friend class FLGUIRenderSceneProxy;
+	friend struct FLGUIFlattenHierarchyOrderCheck;
 	/**
 	 * RenderMode can affect UI's renderer, basically WorldSpace use UE's buildin renderer, others use LGUI's renderer. Different renderers cannot share same render data.
 	 * eg: when attach to other canvas, this will tell which render mode in old canvas, and if not compatible then recreate render data.
@@ -652,7 +657,18 @@ private:
 	/** rect clip's max position */
 	FVector2D clipRectMax = FVector2D(0, 0);
 
-	TMap<UUIBaseRenderable*, FLGUICacheTransformContainer> CacheUIItemToCanvasTransformMap;//UI element relative to canvas transform
+	/**
+	 * UI element relative to canvas transform. Every renderable get a slot index (UUIBaseRenderable::CacheTransformSlotIndex) when first time query it's transform,
+	 * and store data in these arrays with the slot index, dirty bit mark the slot need to recalculate.
+	 */
+	TArray<FLGUICacheTransformContainer> CacheTransformArray;
+	TArray<UUIBaseRenderable*> CacheTransformSlotOwnerArray;
+	TBitArray<> CacheTransformDirtyBits;
+	TArray<int32> FreeCacheTransformSlotArray;
+	/** Inverse of canvas's transform, only recalculate when canvas's transform change */
+	FTransform CacheInverseCanvasTransform;
+	bool bCacheInverseCanvasTransformDirty = true;
+	int32 AllocateCacheTransformSlot(UUIBaseRenderable* InRenderable);
 
 	void MarkRectClipParameterChanged_Recursive();//Rect clip can inherit from parent, so we need to update child canvas too
 	void MarkClipTypeChanged_Recursive();//Rect clip can inherit from parent, so we need to update child canvas too
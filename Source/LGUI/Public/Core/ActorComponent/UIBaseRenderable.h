@@ -96,6 +96,7 @@ public:
 
 protected:
 	friend class FUIBaseRenderableCustomization;
+	friend class ULGUICanvas;
 	virtual void BeginPlay() override;
 	virtual void TickComponent( float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction ) override;
 #if WITH_EDITOR
@@ -189,6 +190,9 @@ public:
 protected:
 	uint8 bColorChanged : 1;
 	uint8 bTransformChanged : 1;
+private:
+	/** Slot index of LGUICanvas's cached transform array */
+	int32 CacheTransformSlotIndex = INDEX_NONE;
 public:
 #pragma region TweenAnimation
 	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "delay,ease"), Category = "LTweenLGUI")
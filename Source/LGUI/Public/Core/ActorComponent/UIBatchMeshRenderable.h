@@ -74,6 +74,21 @@ public:
 		static FVector2D CalculatePivotOffset(float InWidth, float InHeight, const FVector2D& InPivot);
 };
 
+/** Cached output of a GeometryModifier */
+struct FUIGeometryModifierStage
+{
+	TWeakObjectPtr<class UUIGeometryModifierBase> Modifier = nullptr;
+	/** Output of this modifier. Last stage use UIBatchMeshRenderable's geometry as output */
+	TSharedPtr<UIGeometry> OutputGeometry = nullptr;
+	/** Input data count when last modify, if count change then all channel need to update */
+	int32 InputVertexCount = INDEX_NONE;
+	int32 InputTriangleIndexCount = INDEX_NONE;
+	/** Modifier request to modify again with these channel, without update BaseGeometry */
+	bool bVertexPositionDirty = false;
+	bool bUVDirty = false;
+	bool bColorDirty = false;
+};
+
 /** UI element which have render geometry, and can be batched and renderred by LGUICanvas */
 UCLASS(Abstract, Blueprintable, ClassGroup=(LGUI))
 class LGUI_API UUIBatchMeshRenderable : public UUIBaseRenderable
@@ -102,13 +117,19 @@ protected:
 
 	/** if have GeometryModifier component */
 	bool HaveGeometryModifier(bool includeDisabled = true);
-	/** Will any geometry modifier change these data? */
-	void GeometryModifierWillChangeVertexData(bool& OutTriangleIndices, bool& OutVertexPosition, bool& OutUV, bool& OutColor);
 	/** 
-	 * use GeometryModifier to modify geometry 
+	 * use GeometryModifier to modify geometry, from BaseGeometry to geometry.
+	 * Only changed channel is updated, and pass out the changed channel of final geometry.
 	 */
-	void ApplyGeometryModifier(bool triangleChanged, bool uvChanged, bool colorChanged, bool vertexPositionChanged);
+	void ApplyGeometryModifier(bool& InOutTriangleChanged, bool& InOutVertexPositionChanged, bool& InOutUVChanged, bool& InOutColorChanged);
 	TInlineComponentArray<class UUIGeometryModifierBase*> GeometryModifierComponentArray;
+private:
+	/** Geometry before apply GeometryModifier. Cached so modifier only need to update changed channel. Only valid when have enabled GeometryModifier. */
+	TSharedPtr<UIGeometry> BaseGeometry = nullptr;
+	/** Every enabled GeometryModifier is a stage, input is previous stage's output */
+	TArray<FUIGeometryModifierStage> GeometryModifierStageArray;
+	/** Collect enabled GeometryModifier as stage, return true if stages changed */
+	bool UpdateGeometryModifierStage();
 public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		UMaterialInterface* GetCustomUIMaterial()const { return CustomUIMaterial; }
@@ -125,6 +146,11 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		UMaterialInstanceDynamic* GetMaterialInstanceDynamic()const;
+	/**
+	 * Get a MaterialInstanceDynamic of InParentMaterial for animating CustomUIMaterial (eg. LGUIPrefabSequence material track).
+	 * Created MaterialInstanceDynamic is kept with this UI item, so play animation again will reuse it and parameters already initialized on it.
+	 */
+	UMaterialInstanceDynamic* GetOrCreateAnimatedCustomUIMaterial(UMaterialInterface* InParentMaterial);
 protected:
 	virtual void OnAnchorChange(bool InPivotChange, bool InWidthChange, bool InHeightChange, bool InDiscardCache = true)override;
 public:
@@ -144,6 +170,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void MarkVerticesDirty();
 
+	/**
+	 * Only apply the GeometryModifier again with these channel, OnUpdateGeometry will not be called because BaseGeometry is cached.
+	 * Useful for modifier that change every frame, eg: UIEffectTextAnimation.
+	 */
+	void MarkGeometryModifierDirty(class UUIGeometryModifierBase* InModifier, bool InVertexPositionDirty, bool InVertexUVDirty, bool InVertexColorDirty);
 	void AddGeometryModifier(class UUIGeometryModifierBase* InModifier);
 	void RemoveGeometryModifier(class UUIGeometryModifierBase* InModifier);
 	void SortGeometryModifier();
@@ -172,6 +203,13 @@ protected:
 	virtual void OnBeforeCreateOrUpdateGeometry();
 	/** fill and update ui geometry */
 	virtual void OnUpdateGeometry(UIGeometry& InGeo, bool InTriangleChanged, bool InVertexPositionChanged, bool InVertexUVChanged, bool InVertexColorChanged);
+	/**
+	 * Can modify vertex position or uv of created geometry directly, without going through OnUpdateGeometry.
+	 * @return false if geometry is not created yet, or already marked dirty, or have GeometryModifier.
+	 */
+	bool CanModifyGeometryInPlace()const;
+	/** Call this after modify geometry in place, to transform vertices and update drawcall. */
+	void ApplyGeometryModifiedInPlace();
 
 	virtual void UpdateGeometry()override final;
 	virtual void GetGeometryBoundsInLocalSpace(FVector2D& OutMinPoint, FVector2D& OutMaxPoint)const override;
@@ -199,10 +237,14 @@ private:
 	uint8 bUVChanged:1;
 	/** triangle index change */
 	uint8 bTriangleChanged:1;
+	/** some GeometryModifier stage need to modify again */
+	uint8 bGeometryModifierDirty:1;
 	FVector2D LocalMinPoint = FVector2D(0, 0), LocalMaxPoint = FVector2D(0, 0);
 #if WITH_EDITORONLY_DATA
 	FVector LocalMinPoint3D = FVector::ZeroVector, LocalMaxPoint3D = FVector::ZeroVector;
 #endif
 	void CalculateLocalBounds();
 	UPROPERTY(Transient)TObjectPtr<ULGUIGeometryHelper> GeometryHelper = nullptr;
+	/** MaterialInstanceDynamic created for animating CustomUIMaterial, one for each parent material */
+	UPROPERTY(Transient)TArray<TObjectPtr<UMaterialInstanceDynamic>> AnimatedCustomUIMaterialPool;
 };
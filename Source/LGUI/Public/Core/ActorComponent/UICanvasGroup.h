@@ -59,18 +59,32 @@ protected:
 	TWeakObjectPtr<UUIItem> UIItem = nullptr;
 	/** Nearest up parent UICanvasGroup */
 	TWeakObjectPtr<UUICanvasGroup> ParentUICanvasGroup = nullptr;
+	/** UICanvasGroups that use this as parent. Parent push change to children directly, so children no need to query up. */
+	TArray<TWeakObjectPtr<UUICanvasGroup>> ChildrenUICanvasGroup;
 	FSimpleMulticastDelegate InteractableStateChangeDelegate;
 	FSimpleMulticastDelegate AlphaChangeDelegate;
 
-	FDelegateHandle ParentInteractableStateChangeDelegateHandle;
 	void OnParentInteractableStateChange();
-	FDelegateHandle ParentAlphaChangeDelegteHandle;
 	void OnAlphaChange();
+	/** Mark self and children's final alpha dirty, so GetFinalAlpha is still correct before change is notified */
+	void MarkFinalAlphaDirtyRecursive();
+	/**
+	 * Notify listeners, then go down to children.
+	 * @param InSkipIfNotChanged Skip if final alpha is same as last notified, only for deferred notify, because immediate notify always broadcast.
+	 */
+	void NotifyAlphaChange(bool InSkipIfNotChanged);
 
 	mutable float CacheFinalAlpha = 1.0f;
 	mutable bool bIsAlphaDirty = true;
+	/** Final alpha value when last notify listeners */
+	float NotifiedFinalAlpha = 1.0f;
+	/** Alpha change is recorded in LGUIManager and wait to be notified */
+	bool bIsAlphaChangeDeferred = false;
+	/** Cached final interactable, updated when self or parent change */
 	bool bPrevIsInteractable = true;
 	void CheckInteractableStateChange();
+	bool CalculateFinalInteractable()const;
+	friend class ULGUIManagerWorldSubsystem;
 public:
 	FDelegateHandle RegisterInteractableStateChange(const FSimpleDelegate& InCallback);
 	void UnregisterInteractableStateChange(const FDelegateHandle& InHandle);
@@ -85,7 +99,7 @@ public:
 	 * Return alpha property value directly, not concern parent's alpha.
 	 */
 	UFUNCTION(BlueprintCallable, Category = LGUI) float GetAlpha() const { return Alpha; }
-	/** Return final calculated interactable, will concern parent's value */
+	/** Return final calculated interactable, will concern parent's value. This value is cached. */
 	UFUNCTION(BlueprintCallable, Category = LGUI) bool GetFinalInteractable() const;
 	/** Return Interactable property value directly, not concern parent's property. */
 	UFUNCTION(BlueprintCallable, Category = LGUI) bool GetInteractable() const { return bInteractable; }
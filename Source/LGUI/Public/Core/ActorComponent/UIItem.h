@@ -288,6 +288,15 @@ public:
 private:
 	void SetOnAnchorChange(bool InPivotChange, bool InWidthChange, bool InHeightChange);
 	void SetOnTransformChange(bool InPositionChanged, bool InScaleChanged);
+	friend class ULGUIManagerWorldSubsystem;
+	/** If deferred hierarchy change is enabled, register this UIItem to LGUIManager and return true, then the change only need to be recorded, LGUIManager will resolve it before layout. */
+	bool TryDeferHierarchyChange();
+	/**
+	 * Resolve recorded anchor/transform change on this UIItem and all it's children, merged with change inherited from parent.
+	 * Called by LGUIManager once per frame.
+	 */
+	void ResolveDeferredHierarchyChange(bool InAnchorChange, bool InWidthChange, bool InHeightChange, bool InPositionChange, bool InScaleChange);
+	void ClearDeferredHierarchyChange();
 protected:
 	virtual void OnAnchorChange(bool InPivotChange, bool InWidthChange, bool InHeightChange, bool InDiscardCache = true);
 public:
@@ -297,6 +306,9 @@ private:
 	mutable uint8 bWidthCached : 1, bHeightCached : 1, bAnchorLeftCached : 1, bAnchorRightCached : 1, bAnchorTopCached : 1, bAnchorBottomCached : 1;
 	mutable uint8 bNeedSortUIChildren : 1;
 	uint8 bIsDetaching : 1;
+	/** deferred hierarchy change flags, merged until resolved */
+	uint8 bDeferredChangeRegistered : 1, bDeferredAnchorChanged : 1, bDeferredHorizontalPositionChanged : 1, bDeferredVerticalPositionChanged : 1;
+	uint8 bDeferredWidthChanged : 1, bDeferredHeightChanged : 1, bDeferredTransformPositionChanged : 1, bDeferredTransformScaleChanged : 1;
 	FVector2f PrevScale2D = FVector2f::One();
 #pragma region UICanvasGroup
 protected:
@@ -365,11 +377,26 @@ private:
 	/** Only for RootUIItem */
 	void RecalculateFlattenHierarchyIndex()const;
 	void CalculateFlattenHierarchyIndex_Recursive(int& index)const;
+	/** Tell canvas that flatten hierarchy index changed, need to sort render order */
+	void NotifyFlattenHierarchyIndexChanged();
+	/** Collect flatten hierarchy index of this and all children in hierarchy order */
+	void CollectFlattenHierarchyIndex_Recursive(TArray<int32>& OutIndexArray)const;
+	/** Assign flatten hierarchy index to this and all children in hierarchy order, from the given index array */
+	void AssignFlattenHierarchyIndex_Recursive(const TArray<int32>& InIndexArray, int32& InOutArrayIndex)const;
+	/** Flatten hierarchy index of the last UIItem in this hierarchy (include this one) */
+	int32 GetLastFlattenHierarchyIndexInHierarchy()const;
+	/** Flatten hierarchy index of the first UIItem after this hierarchy, return false if this hierarchy is the last one */
+	bool GetNextFlattenHierarchyIndexAfterHierarchy(int32& OutIndex)const;
+	/** Try to insert new attached child's flatten hierarchy index into the gap of existing index, return false if gap is not enough */
+	bool TryInsertFlattenHierarchyIndex(UUIItem* InChild);
 	void ApplyHierarchyIndex();
 public:
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		int32 GetHierarchyIndex() const { return hierarchyIndex; }
-	/** Get flatten hierarchy index, calculate from the first top most UIItem. */
+	/**
+	 * Get flatten hierarchy index, calculate from the first top most UIItem.
+	 * Only use it to compare render order, because there could be gap between neighbour UIItem's index.
+	 */
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		int32 GetFlattenHierarchyIndex()const;
 	UFUNCTION(BlueprintCallable, Category = LGUI)
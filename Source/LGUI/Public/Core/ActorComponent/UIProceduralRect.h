@@ -263,6 +263,11 @@ protected:
 	virtual void MarkAllDirty()override;
 
 	void CheckAdditionalShaderChannels();
+	/**
+	 * Fill block data and write to ProceduralRectData. Rects with identical data share the same block.
+	 * @return true if DataStartPosition changed
+	 */
+	bool UpdateBlockData();
 	void OnDataTextureChanged(class UTexture* Texture);
 	FDelegateHandle OnDataTextureChangedDelegateHandle;
 	uint8 bNeedUpdateBlockData : 1;
@@ -28,6 +28,7 @@ protected:
 	virtual void OnRegister()override;
 	virtual void OnUnregister()override;
 	virtual void OnComponentDestroyed(bool bDestroyingHierarchy)override;
+	virtual void Serialize(FArchive& Ar)override;
 	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None)override;
 public:
 #if WITH_EDITOR
@@ -140,6 +141,15 @@ private:
 	virtual bool GetCanLayoutControlAnchor_Implementation(class UUIItem* InUIItem, FLGUICanLayoutControlAnchor& OutResult)const override;
 	mutable FTextGeometryCache CacheTextGeometryData;
 	bool UpdateCacheTextGeometry()const;
+	friend struct FLGUITextSetNumberCompare;
+	/** Set formatted number as text, update changed chars in place if layout not change. */
+	void SetNumberText(FStringView InNumberText);
+	/** number set by SetNumberText, so new number can compare with it without FText. Only valid if bHasNumberText */
+	FString numberText;
+	bool bHasNumberText = false;
+	/** geometry is updated in place by SetNumberText but text is not, FText is created from numberText when text is needed */
+	mutable bool bNumberTextPending = false;
+	void ConditionalApplyPendingNumberText()const;
 public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		const TArray<FUITextCharProperty>& GetCharPropertyArray()const;
@@ -181,7 +191,7 @@ public:
 	void GenerateRichTextImageObject();
 public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI") ULGUIFontData_BaseObject* GetFont()const { return font; }
-	UFUNCTION(BlueprintCallable, Category = "LGUI")	const FText& GetText()const { return text; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI")	const FText& GetText()const;
 	UE_DEPRECATED(4.24, "Use GetFontSize instead")
 	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (DeprecatedFunction, DeprecationMessage = "Use GetFontSize instead"))
 		float GetSize()const { return size; }
@@ -211,6 +221,18 @@ public:
 		void SetFont(ULGUIFontData_BaseObject* newFont);
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void SetText(const FText& newText);
+	/**
+	 * Set number as text, formatted without FText and culture (use '.' as decimal point, ',' as group separator). Useful for label that change frequently, eg: score, timer, currency.
+	 * If only digits change and layout is not affected (same char count, digit glyphs have same xadvance, no rich text and kerning), then only changed chars' vertex position and uv are updated, no layout calculation.
+	 * @param InFractionDigits Digit count after decimal point, 0-9.
+	 * @param InMinIntegerDigits Pad integer part with '0' to this digit count.
+	 * @param InUseGrouping Separate every 3 integer digits with ','.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (AdvancedDisplay = "InMinIntegerDigits,InUseGrouping"))
+		void SetNumber(double InValue, int32 InFractionDigits = 0, int32 InMinIntegerDigits = 1, bool InUseGrouping = false);
+	/** Integer version of SetNumber, for value that can't fit in double precision. */
+	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (AdvancedDisplay = "InMinIntegerDigits,InUseGrouping"))
+		void SetInteger(int64 InValue, int32 InMinIntegerDigits = 1, bool InUseGrouping = false);
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void SetFontSize(float newSize);
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
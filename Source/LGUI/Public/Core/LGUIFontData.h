@@ -7,27 +7,6 @@
 #include "Core/LGUIFreeTypeRenderFontData.h"
 #include "LGUIFontData.generated.h"
 
-struct FLGUIFontKeyData
-{
-public:
-	FLGUIFontKeyData() {}
-	FLGUIFontKeyData(const TCHAR& inCharCode, const uint16& inCharSize)
-	{
-		this->charCode = inCharCode;
-		this->charSize = inCharSize;
-	}
-	TCHAR charCode = 0;
-	uint16 charSize = 0;
-	bool operator==(const FLGUIFontKeyData& other)const
-	{
-		return this->charCode == other.charCode && this->charSize == other.charSize;
-	}
-	friend FORCEINLINE uint32 GetTypeHash(const FLGUIFontKeyData& other)
-	{
-		return HashCombine(GetTypeHash(other.charCode), GetTypeHash(other.charSize));
-	}
-};
-
 /**
  * Font asset for UIText to render
  */
@@ -55,7 +34,12 @@ public:
 	//End ULGUIFreeTypeRenderFontData interface
 protected:
 	float boldSize; float italicSlop;
-	TMap<FLGUIFontKeyData, FLGUICharData> charDataMap;
+	/** Glyph table of each char size */
+	TMap<uint16, TUniquePtr<FLGUICharDataTable>> charDataTableMap;
+	/** Text usually request many chars with same size in a row, so remember last used table to skip the size map */
+	uint16 lastCharSize = 0;
+	FLGUICharDataTable* lastCharDataTable = nullptr;
+	FLGUICharDataTable* FindCharDataTable(uint16 charSize);
 	virtual UTexture2D* CreateFontTexture(int InTextureSize)override;
 	virtual void ApplyPackingAtlasTextureExpand(UTexture2D* newTexture, int newTextureSize)override;
 
@@ -119,3 +119,34 @@ public:
 
 	static ULGUIFontData_BaseObject* GetDefaultFont();
 };
+
+/**
+ * Glyph cache of a single UIText, reused across geometry rebuilds, so frequently changed text (eg. numeric label) no need to search font's char map for every char.
+ * Only cache char code below CachedCharCount, with at most MaxCharSizeCount different char sizes (layout size and scaled render size), other chars fallback to font.
+ * Each page only store glyphs that are used, so a label with a few different chars only take a few entries.
+ */
+struct LGUI_API FUITextGlyphCache
+{
+public:
+	static constexpr int32 CachedCharCount = 256;
+	static constexpr int32 MaxCharSizeCount = 2;
+	/** Call this before GetCharData, cache will be cleared if font change. */
+	void Prepare(ULGUIFontData_BaseObject* InFont);
+	/** Get char data from cache, or from font and store it if cacheable. InFont must be the one passed to Prepare. */
+	FLGUICharData_HighPrecision GetCharData(ULGUIFontData_BaseObject* InFont, TCHAR InCharCode, float InCharSize);
+	/** Font texture is expanded to double size, so uv of cached glyphs should scale down by half. */
+	void ApplyFontTextureScaleUp();
+	void Reset();
+private:
+	struct FCharSizePage
+	{
+		float CharSize = 0;
+		/** index + 1 of char code in CharDataArray, 0 means not cached */
+		uint8 CharCodeToIndex[CachedCharCount];
+		TArray<FLGUICharData_HighPrecision> CharDataArray;
+	};
+	TWeakObjectPtr<ULGUIFontData_BaseObject> Font = nullptr;
+	TArray<FCharSizePage, TInlineAllocator<MaxCharSizeCount>> PageArray;
+	/** page to replace when all pages are used and a new char size come */
+	int32 NextReplacePageIndex = 0;
+};
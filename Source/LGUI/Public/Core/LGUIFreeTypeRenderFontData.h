@@ -6,6 +6,7 @@
 #include "Engine/DataAsset.h"
 #include "RHI.h"
 #include "Utils/MaxRectsBinPack/MaxRectsBinPack.h"
+#include "Utils/MaxRectsBinPack/SkylineBinPack.h"
 #include "Core/LGUIFontData_BaseObject.h"
 #include "LGUISettings.h"
 #include "LGUIFreeTypeRenderFontData.generated.h"
@@ -40,6 +41,104 @@ enum class ELGUIDynamicFontLineHeightType :uint8
 	FontSizeAsLineHeight,
 };
 
+/**
+ * Flat glyph table, direct-indexed by char code.
+ * Char codes inside BMP are stored in lazily allocated 256-char pages, so ASCII/Latin-1 and CJK glyph lookup only take two array index, no hashing.
+ * Char codes outside BMP fallback to a map.
+ */
+class LGUI_API FLGUICharDataTable
+{
+public:
+	FORCEINLINE const FLGUICharData* Find(const TCHAR& charCode)const
+	{
+		const uint32 code = (uint32)charCode;
+		if (code < FLGUICharDataTable::BMPCharCount)
+		{
+			const uint32 pageIndex = code >> FLGUICharDataTable::PageShift;
+			if (pageIndex < (uint32)Pages.Num())
+			{
+				if (const auto& page = Pages[pageIndex])
+				{
+					const uint32 charIndex = code & FLGUICharDataTable::PageMask;
+					return page->bValid[charIndex] ? &page->Chars[charIndex] : nullptr;
+				}
+			}
+			return nullptr;
+		}
+		return ExtraChars.Find(charCode);
+	}
+	void Add(const TCHAR& charCode, const FLGUICharData& charData)
+	{
+		const uint32 code = (uint32)charCode;
+		if (code < FLGUICharDataTable::BMPCharCount)
+		{
+			const uint32 pageIndex = code >> FLGUICharDataTable::PageShift;
+			if (pageIndex >= (uint32)Pages.Num())
+			{
+				Pages.SetNum(pageIndex + 1);
+			}
+			auto& page = Pages[pageIndex];
+			if (!page.IsValid())
+			{
+				page = MakeUnique<FPage>();
+			}
+			const uint32 charIndex = code & FLGUICharDataTable::PageMask;
+			page->Chars[charIndex] = charData;
+			page->bValid[charIndex] = true;
+		}
+		else
+		{
+			ExtraChars.Add(charCode, charData);
+		}
+	}
+	/** Call function for every cached char data */
+	template<typename Func>
+	void ForEach(Func InFunction)
+	{
+		for (auto& page : Pages)
+		{
+			if (!page.IsValid())continue;
+			for (int i = 0; i < FLGUICharDataTable::PageSize; i++)
+			{
+				if (page->bValid[i])
+				{
+					InFunction(page->Chars[i]);
+				}
+			}
+		}
+		for (auto& KeyValue : ExtraChars)
+		{
+			InFunction(KeyValue.Value);
+		}
+	}
+	void ScaleDownUV()
+	{
+		ForEach([](FLGUICharData& charData) {
+			charData.uv0X *= 0.5f;
+			charData.uv0Y *= 0.5f;
+			charData.uv3X *= 0.5f;
+			charData.uv3Y *= 0.5f;
+			});
+	}
+	void Empty()
+	{
+		Pages.Empty();
+		ExtraChars.Empty();
+	}
+private:
+	static constexpr int32 PageShift = 8;
+	static constexpr int32 PageSize = 1 << PageShift;
+	static constexpr uint32 PageMask = PageSize - 1;
+	static constexpr uint32 BMPCharCount = 0x10000;
+	struct FPage
+	{
+		FLGUICharData Chars[FLGUICharDataTable::PageSize];
+		bool bValid[FLGUICharDataTable::PageSize] = { false };
+	};
+	TArray<TUniquePtr<FPage>> Pages;
+	TMap<TCHAR, FLGUICharData> ExtraChars;
+};
+
 /**
  * Font asset for UIText to render
  */
@@ -86,6 +185,12 @@ protected:
 	 */
 	UPROPERTY(EditAnywhere, Category = "LGUI")
 		int32 rectPackCellSize = 256;
+	/**
+	 * Use skyline algorithm to pack glyph instead of max-rects. Skyline is much faster when insert glyph, and good enough when glyph size is similar (eg. CJK characters with few font sizes).
+	 * But if glyph size varies a lot, it may leave more garbage area in texture.
+	 */
+	UPROPERTY(EditAnywhere, Category = "LGUI", AdvancedDisplay)
+		bool useSkylineRectPack = false;
 
 	/** Texture of this font */
 	UPROPERTY(VisibleAnywhere, Transient, Category = "LGUI")
@@ -131,7 +236,11 @@ protected:
 
 	/** for rect packing */
 	rbp::MaxRectsBinPack binPack;
+	/** for rect packing when useSkylineRectPack is true, always work in the same cell as binPack */
+	rbp::SkylineBinPack skylineBinPack;
 	TArray<rbp::Rect> freeRects;
+	/** move rect packing to next cell */
+	void UseNextRectPackCell();
 	/** current texture size */
 	int32 textureSize;
 	/** 1.0 / textureSize */
@@ -163,10 +272,10 @@ protected:
 		int pixelSize;
 	};
 	/**
-	 * Insert rect into area, assign pixel if succeed
+	 * Insert rect into area with binPack (or skylineBinPack if useSkylineRectPack), assign pixel if succeed
 	 * return: if can fit in rect area return true, else false
 	 */
-	bool PackRectAndInsertChar(const FGlyphBitmap& InGlyphBitmap, rbp::MaxRectsBinPack& InOutBinpack, UTexture2D* InTexture, FLGUICharData& OutResult);
+	bool PackRectAndInsertChar(const FGlyphBitmap& InGlyphBitmap, UTexture2D* InTexture, FLGUICharData& OutResult);
 	void UpdateFontTextureRegion(UTexture2D* Texture, FUpdateTextureRegion2D* Region, uint32 SrcPitch, uint32 SrcBpp, uint8* SrcData);
 	void RenewFontTexture(int oldTextureSize, int newTextureSize);
 
@@ -8,6 +8,19 @@
 
 class USceneComponent;
 
+UENUM(BlueprintType, Category = LGUI)
+enum class ELGUILifeCycleBehaviourUpdateRate :uint8
+{
+	/** Update every frame */
+	EveryFrame,
+	/** Update once every "UpdateFrameInterval" frames, DeltaTime is the time since last Update */
+	EveryNFrames,
+	/** Update one by one in a round-robin way, each frame only update as many as the time budget allow (lgui.LifeCycleBehaviour.TimeSlicedUpdateBudget). DeltaTime is the time since last Update */
+	TimeSliced,
+
+	Count UMETA(Hidden),
+};
+
 /**
  * Base class for LGUI's life cycle behviour related component.
  * I'm trying to make this ULGUILifeCycleBehaviour more like Unity's MonoBehaviour. You will see it contains function like Awake/Start/Update/OnDestroy/OnEnable/OnDisable.
@@ -33,6 +46,12 @@ protected:
 private:
 	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour")
 		bool enable = true;
+	/** How often "Update" is called. Not every behaviour need to update every frame, use other rate can save some performance. */
+	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour", AdvancedDisplay)
+		ELGUILifeCycleBehaviourUpdateRate UpdateRate = ELGUILifeCycleBehaviourUpdateRate::EveryFrame;
+	/** Frame interval for "EveryNFrames" UpdateRate */
+	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour", AdvancedDisplay, meta = (ClampMin = "1", EditCondition = "UpdateRate == ELGUILifeCycleBehaviourUpdateRate::EveryNFrames"))
+		int32 UpdateFrameInterval = 2;
 #if WITH_EDITORONLY_DATA
 	/** This will allow Update function execute in edit mode. */
 	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour")
@@ -43,9 +62,9 @@ protected:
 	//for UI object
 	virtual void OnUIActiveInHierarchyStateChanged(bool InState);
 	FDelegateHandle UIActiveInHierarchyStateChangedDelegateHandle;
-	//for not UI object
+	//for not UI object, called by LGUIManager only when RootComponent's render state is dirty
 	void OnComponentRenderStateDirty(UActorComponent& InComp);
-	FDelegateHandle ComponentRenderStateDirtyDelegateHandle;
+	uint8 bIsListeningRootComponentRenderState : 1;
 protected:
 	uint8 bIsAwakeCalled : 1;
 	uint8 bIsStartCalled : 1;
@@ -55,6 +74,9 @@ protected:
 	uint8 bPrevIsRootComponentVisible : 1;
 	/** use this to tell if the class is compiled from blueprint, only blueprint can execute ReceiveXXX. */
 	uint8 bCanExecuteBlueprintEvent : 1;
+	/** Handle of update entry in LGUIManager, UpdateRate is cached when add to update. */
+	ELGUILifeCycleBehaviourUpdateRate UpdateBucket = ELGUILifeCycleBehaviourUpdateRate::EveryFrame;
+	int32 UpdateEntryIndex = INDEX_NONE;
 protected:
 	friend class ULGUIManagerWorldSubsystem;
 	UPROPERTY(Transient) mutable TWeakObjectPtr<USceneComponent> RootComp = nullptr;
@@ -115,6 +137,16 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
 		void SetCanExecuteUpdate(bool value);
+	/**
+	 * Set how often "Update" is called.
+	 * @param	InFrameInterval		Frame interval for "EveryNFrames" UpdateRate
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		void SetUpdateRate(ELGUILifeCycleBehaviourUpdateRate value, int32 InFrameInterval = 2);
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		ELGUILifeCycleBehaviourUpdateRate GetUpdateRate()const { return UpdateRate; }
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		int32 GetUpdateFrameInterval()const { return UpdateFrameInterval; }
 
 	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
 		void SetEnable(bool value);
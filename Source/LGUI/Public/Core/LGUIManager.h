@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Tickable.h"
+#include "PlayTween/LGUIPlayTweenDriver.h"
 #include "LGUIManager.generated.h"
 
 class UUIItem;
@@ -82,6 +83,96 @@ struct FLGUILifeCycleBehaviourArrayContainer
 	TArray<TFunction<void()>> Functions;
 };
 
+/** LGUILifeCycleBehaviour's update data, classified when add to update */
+USTRUCT()
+struct FLGUILifeCycleBehaviourUpdateEntry
+{
+	GENERATED_BODY()
+	UPROPERTY(VisibleAnywhere, Category = "LGUI")
+		TWeakObjectPtr<ULGUILifeCycleBehaviour> Behaviour = nullptr;
+	/** Root component when classify bRootIsUIItem, check it before use bRootIsUIItem, because root component could change after add to update */
+	TWeakObjectPtr<USceneComponent> RootComponent = nullptr;
+	/** Root component is UIItem, so use UI's game pause setting */
+	bool bRootIsUIItem = false;
+	/** Removed during update, will be cleanup after update */
+	bool bPendingRemove = false;
+	int32 FrameInterval = 1;
+	uint32 NextUpdateFrame = 0;
+	double LastUpdateTime = 0;
+};
+/** LGUILifeCycleBehaviours with same UpdateRate */
+USTRUCT()
+struct FLGUILifeCycleBehaviourUpdateBucket
+{
+	GENERATED_BODY()
+	UPROPERTY(VisibleAnywhere, Category = "LGUI")
+		TArray<FLGUILifeCycleBehaviourUpdateEntry> Entries;
+	/** Entries that removed during update */
+	TArray<int32> PendingRemoveIndices;
+	/** For TimeSliced, start index of next frame */
+	int32 Cursor = 0;
+};
+
+/**
+ * Component instances in a root actor's hierarchy, grouped by component class.
+ * Maintained incrementally on UI actor attach/detach and on UIItem/LGUILifeCycleBehaviour register/unregister.
+ * Only UIItem and LGUILifeCycleBehaviour (and their child classes) on UI actors are indexed, because only they notify these changes.
+ * Query for other component class, or in a hierarchy that have non-UI child actor, is not handled by index.
+ * @see ULGUIBPLibrary::EnableHierarchyComponentIndex
+ */
+struct FLGUIHierarchyComponentIndex
+{
+	struct FComponentEntry
+	{
+		TWeakObjectPtr<UActorComponent> Component = nullptr;
+		/** Owner actor's hierarchy order */
+		int32 Order = 0;
+	};
+	/** Range of actor's hierarchy order, [Start, End), actor itself is Start, children are after it */
+	struct FActorRange
+	{
+		int32 Start = 0;
+		int32 End = 0;
+		/** Have non-UI actor in children, which is not indexed */
+		bool bHasUnindexedChild = false;
+	};
+	TWeakObjectPtr<AActor> RootActor = nullptr;
+	/** Indexed actors and their components */
+	TMap<TWeakObjectPtr<AActor>, TArray<TWeakObjectPtr<UActorComponent>>> ActorToComponents;
+	/** Exact component class to components, sorted by owner's hierarchy order, so components in an actor's hierarchy is a continuous range */
+	mutable TMap<TWeakObjectPtr<UClass>, TArray<FComponentEntry>> ClassToComponents;
+	/** Indexed actor to it's hierarchy order range. Built when needed, after actor add or remove */
+	mutable TMap<TWeakObjectPtr<AActor>, FActorRange> ActorRanges;
+	mutable bool bHierarchyOrderDirty = true;
+
+	void Rebuild();
+	/** Can component of this class be indexed */
+	static bool IsIndexedClass(UClass* InClass);
+	/** Can this actor be indexed, only UI actor can */
+	static bool IsIndexedActor(AActor* InActor);
+	bool Contains(AActor* InActor)const { return ActorToComponents.Contains(InActor); }
+	/** Is InActor the root actor or attached to it */
+	bool IsInHierarchy(AActor* InActor)const;
+	/** Add actor's components, if already exist then refresh them */
+	void AddActor(AActor* InActor);
+	void RemoveActor(AActor* InActor);
+	void AddActorRecursive(AActor* InActor);
+	void RemoveActorRecursive(AActor* InActor);
+	void AddComponent(UActorComponent* InComp);
+	void RemoveComponent(UActorComponent* InComp);
+	/**
+	 * Same as ULGUIBPLibrary::GetComponentsInChildren, result is in hierarchy order (same as tree walk, but components in a same actor may have different order).
+	 * If InFirstOnly then only the nearest one is collected.
+	 * @return false if index can't handle this query (InClass is not indexed, or InActor's hierarchy is not fully indexed), caller should walk the tree.
+	 */
+	bool Collect(AActor* InActor, UClass* InClass, bool InIncludeSelf, const TSet<AActor*>& InExcludeNode, bool InFirstOnly, TArray<UActorComponent*>& OutArray)const;
+private:
+	/** Build ActorRanges and sort ClassToComponents by hierarchy order, if actor changed */
+	void EnsureHierarchyOrder()const;
+	/** @return true if have non-UI actor in children */
+	bool BuildHierarchyOrder_Recursive(AActor* InActor, int32& InOutOrder)const;
+};
+
 class ILGUICultureChangedInterface;
 enum class ELGUIRenderMode : uint8;
 
@@ -139,14 +230,21 @@ private:
 	bool bShouldSortWorldSpaceCanvas = true;
 	bool bShouldSortRenderTargetSpaceCanvas = true;
 
+	/** Same as ELGUILifeCycleBehaviourUpdateRate::Count */
+	static constexpr int32 LGUILifeCycleBehaviourUpdateBucketCount = 3;
+	/** Index is ELGUILifeCycleBehaviourUpdateRate */
 	UPROPERTY(VisibleAnywhere, Category = "LGUI")
-		TArray<TWeakObjectPtr<ULGUILifeCycleBehaviour>> LGUILifeCycleBehavioursForUpdate;
+		FLGUILifeCycleBehaviourUpdateBucket LGUILifeCycleBehaviourUpdateBuckets[LGUILifeCycleBehaviourUpdateBucketCount];
 	UPROPERTY(VisibleAnywhere, Category = "LGUI")
 		TArray<TWeakObjectPtr<ULGUILifeCycleBehaviour>> LGUILifeCycleBehavioursForStart;
 	bool bIsExecutingStart = false;
 	bool bIsExecutingUpdate = false;
-	int32 CurrentExecutingUpdateIndex = -1;
-	TArray<ULGUILifeCycleBehaviour*> LGUILifeCycleBehavioursNeedToRemoveFromUpdate;
+	/** Accumulated DeltaTime and frame count, for LGUILifeCycleBehaviour that not update every frame */
+	double LGUILifeCycleBehaviourUpdateTime = 0;
+	uint32 LGUILifeCycleBehaviourUpdateFrame = 0;
+	void AddLGUILifeCycleBehaviourToUpdateBucket(ULGUILifeCycleBehaviour* InComp);
+	void RemoveLGUILifeCycleBehaviourFromUpdateBucket(ULGUILifeCycleBehaviour* InComp);
+	void UpdateLGUILifeCycleBehaviours(float DeltaTime);
 #if WITH_EDITORONLY_DATA
 	int32 PrevScreenSpaceOverlayCanvasCount = 1;
 #endif
@@ -158,7 +256,50 @@ private:
 
 	void UpdateLayout();
 	bool bNeedUpdateLayout = false;
+
+	/** UIItems which have recorded anchor/transform change, waiting to be resolved. */
+	TArray<TWeakObjectPtr<UUIItem>> DeferredHierarchyChangeUIItemArray;
+	/** Reusable buffer for ResolveDeferredHierarchyChange, sorted by hierarchy depth. Reset every time it is used. */
+	TArray<TPair<int32, UUIItem*>> DeferredHierarchyChangeSortedArray;
+	/** Resolve all recorded anchor/transform change, parent first, so every UIItem is only visited once. */
+	void ResolveDeferredHierarchyChange();
+	/** UICanvasGroups which have recorded alpha change, waiting to notify UI elements. */
+	TArray<TWeakObjectPtr<class UUICanvasGroup>> DeferredAlphaChangeCanvasGroupArray;
+	void ResolveDeferredCanvasGroupAlphaChange();
+	/** LGUICanvasScalers which have recorded viewport resize, waiting to apply canvas size and scale. */
+	TArray<TWeakObjectPtr<class ULGUICanvasScaler>> PendingViewportResizeCanvasScalerArray;
+	void ResolvePendingViewportResize();
+	/** UIWidgets that want to redraw at this frame, collected when redraw scheduler is enabled. */
+	TArray<TWeakObjectPtr<class UUIWidget>> UIWidgetRedrawRequestArray;
+	/** Draw requested UIWidgets by priority, within per-frame budget. */
+	void DrawScheduledUIWidgets();
+	/** Root actor to it's hierarchy component index */
+	TMap<TWeakObjectPtr<AActor>, FLGUIHierarchyComponentIndex> HierarchyComponentIndexMap;
+	/** Count of all HierarchyComponentIndexMap in all worlds, so notify can early out if no index at all. */
+	static int32 HierarchyComponentIndexCount;
 public:
+	static void EnableHierarchyComponentIndex(AActor* InRootActor);
+	static void DisableHierarchyComponentIndex(AActor* InRootActor);
+	static void RefreshHierarchyComponentIndex(AActor* InRootActor);
+	/** Find index that contains InActor, return nullptr if InActor is not in any indexed hierarchy. */
+	static const FLGUIHierarchyComponentIndex* FindHierarchyComponentIndex(AActor* InActor);
+	/** Actor's attach parent changed, add it to or remove it from index. */
+	static void NotifyHierarchyComponentIndexAttachmentChanged(AActor* InActor);
+	/** Component register or unregister. If InComp is actor's root component then the whole actor is added or removed. */
+	static void NotifyHierarchyComponentIndexRegisterChanged(UActorComponent* InComp, bool InRegistered);
+	/** Non-UI actor attach to or detach from InActor. */
+	static void NotifyHierarchyComponentIndexChildrenChanged(AActor* InActor);
+private:
+	FLGUIPlayTweenDriver PlayTweenDriver;
+public:
+	FLGUIPlayTweenDriver& GetPlayTweenDriver() { return PlayTweenDriver; }
+public:
+	/** Is UIWidget redraw handled by LGUIManager, @see lgui.UIWidget.MaxRedrawPerFrame */
+	static bool IsUIWidgetRedrawScheduled(UWorld* InWorld);
+	void AddUIWidgetRedrawRequest(class UUIWidget* InWidget);
+	void AddDeferredHierarchyChangeUIItem(UUIItem* InItem);
+	void AddDeferredAlphaChangeCanvasGroup(class UUICanvasGroup* InCanvasGroup);
+	void AddPendingViewportResizeCanvasScaler(class ULGUICanvasScaler* InCanvasScaler);
 #if WITH_EDITOR
 	static void RefreshAllUI(UWorld* InWorld = nullptr);
 #endif
@@ -250,4 +391,13 @@ public:
 	static void AddLGUILifeCycleBehavioursForStart(ULGUILifeCycleBehaviour* InComp);
 	static void RemoveLGUILifeCycleBehavioursFromStart(ULGUILifeCycleBehaviour* InComp);
 	static void ProcessLGUILifecycleEvent(ULGUILifeCycleBehaviour* InComp);
+
+	/** Listen render state dirty of a none-UI root component, return true if success */
+	static bool AddRootComponentRenderStateListener(USceneComponent* InRootComp, ULGUILifeCycleBehaviour* InComp);
+	static void RemoveRootComponentRenderStateListener(USceneComponent* InRootComp, ULGUILifeCycleBehaviour* InComp);
+private:
+	/** Map root component to LGUILifeCycleBehaviours that use it, so render state dirty only goes to these behaviours */
+	TMap<TWeakObjectPtr<UActorComponent>, TArray<TWeakObjectPtr<ULGUILifeCycleBehaviour>>> RootComponentRenderStateListenerMap;
+	FDelegateHandle ComponentRenderStateDirtyDelegateHandle;
+	void OnComponentRenderStateDirty(UActorComponent& InComp);
 };
@@ -35,8 +35,40 @@ private:
 	//Pixel position
 	FIntVector2 CurrentPosition = FIntVector2(0, 0);
 	bool bIsInitialized = false;
+	/** Free blocks, kept as a heap ordered by row then column, so lowest position is reused first and live blocks stay packed at texture's top rows. */
 	TArray<FIntVector2> NotUsingPositionArray;
 
+	struct FBlockInfo
+	{
+		int32 RefCount = 0;
+		/** Crc of block's data, only valid if bHasHash */
+		uint32 Hash = 0;
+		bool bHasHash = false;
+	};
+	/** Allocated blocks, key is PositionToKey */
+	TMap<uint64, FBlockInfo> BlockInfoMap;
+	/** Data hash to block, for finding block with identical data */
+	TMultiMap<uint32, uint64> HashToBlockMap;
+	/** CPU side copy of texture's data, TextureSize * TextureSize pixels, 4 bytes per pixel. */
+	TArray<uint8> ShadowData;
+	/** Changed pixels in this frame, key is row, value is min and max pixel in row. */
+	TMap<int32, FIntPoint> DirtyRowRangeMap;
+	bool bIsPendingFlush = false;
+
+	uint32 AllocatedBlockCount = 0;
+	uint32 SharedBlockCount = 0;
+	uint32 UploadRegionCount = 0;
+	uint32 UploadBlockCount = 0;
+
+	static TArray<TWeakObjectPtr<ULGUIProceduralRectData>> PendingFlushArray;
+
+	static uint64 PositionToKey(const FIntVector2& InPosition) { return ((uint64)(uint32)InPosition.Y << 32) | (uint64)(uint32)InPosition.X; }
+	static FIntVector2 KeyToPosition(uint64 InKey) { return FIntVector2((int32)(uint32)(InKey & 0xFFFFFFFF), (int32)(uint32)(InKey >> 32)); }
+	uint8* GetShadowBlock(const FIntVector2& InPosition) { return ShadowData.GetData() + (InPosition.Y * TextureSize + InPosition.X) * 4; }
+	FIntVector2 AllocateBlock();
+	void ReleaseBlock(const FIntVector2& InPosition);
+	void WriteBlock(const FIntVector2& InPosition, const uint8* InData);
+
 	void CreateTexture();
 	bool ExpandTexture();
 
@@ -55,7 +87,36 @@ public:
 	 */
 	FIntVector2 RegisterBuffer();
 	void UnregisterBuffer(const FIntVector2& InPosition);
-	void UpdateBlock(const FIntVector2& InPosition, uint8* InData);
+	/**
+	 * Write data to the block, data is copied to CPU side buffer and upload to texture at FlushPendingUpdate.
+	 * Block must not be shared with others, use UpdateSharedBlock if block is acquired from that function.
+	 * @param InData BlockSizeInByte bytes
+	 */
+	void UpdateBlock(const FIntVector2& InPosition, const uint8* InData);
+	/**
+	 * Write data to the block, if other block have identical data then share that block, if current block is shared then split to a new block.
+	 * @param InOutPosition Current block position, will be changed to the block that actually hold the data.
+	 * @param InData BlockSizeInByte bytes
+	 * @return true if block position changed, caller should update position in vertex data.
+	 */
+	bool UpdateSharedBlock(FIntVector2& InOutPosition, const uint8* InData);
+	/** Upload all changed data to texture, changed blocks in adjacent rows are merged into single region. */
+	void FlushPendingUpdate();
+	/** Call FlushPendingUpdate for all ProceduralRectData that have changed data. */
+	static void FlushAllPendingUpdate();
+
+	/** Count of blocks currently in use. */
+	int32 GetAllocatedBlockCount()const { return BlockInfoMap.Num(); }
+	/** Count of blocks that is released and can be reused. */
+	int32 GetNotUsingBlockCount()const { return NotUsingPositionArray.Num(); }
+	/** Total count of new block allocation since initialize. */
+	uint32 GetTotalAllocatedBlockCount()const { return AllocatedBlockCount; }
+	/** Total count of times that a block's data is found identical with other block and shared. */
+	uint32 GetTotalSharedBlockCount()const { return SharedBlockCount; }
+	/** Total count of texture region update command. */
+	uint32 GetTotalUploadRegionCount()const { return UploadRegionCount; }
+	/** Total count of block data that actually changed and need upload. */
+	uint32 GetTotalUploadBlockCount()const { return UploadBlockCount; }
 
 	UTexture* GetDataTexture()const { return Texture; }
 	UMaterialInterface* GetMaterial(ELGUICanvasClipType clipType);
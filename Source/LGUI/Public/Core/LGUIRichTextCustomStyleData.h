@@ -67,14 +67,22 @@ class LGUI_API ULGUIRichTextCustomStyleData : public UObject
 private:
 	UPROPERTY(EditAnywhere, Category = "LGUI")
 		TMap<FName, FLGUIRichTextCustomStyleItemData> DataMap;
+	/**
+	 * Increase when data change, so cached rich text parse result can tell if it is outdated.
+	 * DataMap can only be changed in editor, so this only increase in PostEditChangeProperty. Any new place that change DataMap should call NotifyDataChange.
+	 */
+	uint32 DataVersion = 0;
+	/** Increase DataVersion and broadcast OnDataChange. */
+	void NotifyDataChange();
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		const TMap<FName, FLGUIRichTextCustomStyleItemData>& GetDataMap()const { return DataMap; }
+	uint32 GetDataVersion()const { return DataVersion; }
 
 	DECLARE_EVENT(ULGUIRichTextCustomStyleData, FLGUIRichTextCustomStyleDataRefreshEvent);
-	/** Called when any data change, and need UIText to refresh. */
+	/** Called when any data change, and need UIText to refresh. Broadcast by NotifyDataChange. */
 	FLGUIRichTextCustomStyleDataRefreshEvent OnDataChange;
 };
@@ -49,4 +49,8 @@ public:
 		float GetAnimationFps()const { return animationFps; }
 
 	virtual void CreateOrUpdateObject(class UUIItem* parent, const TArray<FUIText_RichTextImageTag>& imageTagArray, TArray<class UUIItem*>& inOutCreatedImageObjectArray, bool listImageObjectInEditorOutliner)override;
+	/** Handle is the element id in imageMap */
+	virtual int32 GetImageHandle(const FName& InImageName)const override;
+private:
+	const FLGUIRichTextImageItemData* FindImageItem(const FUIText_RichTextImageTag& InImageTag)const;
 };
\ No newline at end of file
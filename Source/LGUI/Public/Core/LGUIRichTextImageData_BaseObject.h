@@ -13,8 +13,24 @@ class LGUI_API ULGUIRichTextImageData_BaseObject :public UObject
 	GENERATED_BODY()
 public:
 	DECLARE_EVENT(ULGUIRichTextImageData_BaseObject, FLGUIRichTextImageDataRefreshEvent);
-	/** Called when any data change, and need UIText to refresh. */
+	/** Called when any data change, and need UIText to refresh. Use NotifyDataChange to broadcast it, so DataVersion is increased too. */
 	FLGUIRichTextImageDataRefreshEvent OnDataChange;
 	/** Create or update image object. */
 	virtual void CreateOrUpdateObject(class UUIItem* parent, const TArray<FUIText_RichTextImageTag>& imageTagArray, TArray<class UUIItem*>& inOutCreatedImageObjectArray, bool listImageObjectInEditorOutliner) {};
+	/**
+	 * Resolve image name to handle, which is stored in FUIText_RichTextImageTag::ImageHandle, so CreateOrUpdateObject don't need to find image by name again.
+	 * Handle is valid until DataVersion change. Return INDEX_NONE if not found.
+	 */
+	virtual int32 GetImageHandle(const FName& InImageName)const { return INDEX_NONE; }
+	uint32 GetDataVersion()const { return DataVersion; }
+protected:
+	/** Increase DataVersion and broadcast OnDataChange. */
+	void NotifyDataChange()
+	{
+		DataVersion++;
+		OnDataChange.Broadcast();
+	}
+private:
+	/** Increase when data change, so cached rich text parse result (which contains image handle) can tell if it is outdated */
+	uint32 DataVersion = 0;
 };
\ No newline at end of file
@@ -80,7 +80,7 @@ public:
 	//End ULGUIFontDataBaseObject interface
 protected:
 	float italicSlop = 0.0f; float oneDivideFontSize = 1.0f; float objectScale = 1.0f;
-	TMap<TCHAR, FLGUICharData> charDataMap;
+	FLGUICharDataTable charDataTable;
 	TMap<FLGUISDFFontKerningPair, int16> KerningPairsMap;
 	virtual UTexture2D* CreateFontTexture(int InTextureSize)override;
 	virtual void ApplyPackingAtlasTextureExpand(UTexture2D* newTexture, int newTextureSize)override;
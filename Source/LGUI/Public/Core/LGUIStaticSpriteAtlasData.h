@@ -71,12 +71,25 @@ public:
 	/** Return true if some spriteData is invalid */
 	bool CheckInvalidSpriteData()const;
 	void CleanupInvalidSpriteData();
+	/**
+	 * Reassign sprites of these atlases by usage, so sprites that are used together (eg. referenced by same prefab) are packed into same atlas as much as possible, which reduce drawcall break.
+	 * @param InAtlasArray	Sprites of these atlases are collected and reassigned to these atlases, then repack changed atlases.
+	 * @param InUsageArray	Each item is a group of sprites that are used together. Bigger group is processed first.
+	 * @return false if sprites can't fit into these atlases (checked with sprite size and a test pack of every changed atlas), nothing is changed in this case.
+	 */
+	static bool RegroupSpritesByUsage(const TArray<ULGUIStaticSpriteAtlasData*>& InAtlasArray, const TArray<TArray<ULGUISpriteData*>>& InUsageArray);
+	/** Count textures that render these sprites, which is the minimal drawcall count of these sprites. Sprites in same static atlas, or with same packingTag, share one texture. */
+	static int32 GetExpectedTextureCount(const TArray<ULGUISpriteData*>& InSpriteArray);
 
 	virtual void BeginCacheForCookedPlatformData(const ITargetPlatform* TargetPlatform)override;
 	virtual void WillNeverCacheCookedPlatformDataAgain()override;
 	virtual void ClearCachedCookedPlatformData(const ITargetPlatform* TargetPlatform)override;
 private:
-	bool PackAtlasTest(uint32 size, TArray<rbp::Rect>& result);
+	bool PackAtlasTest(const TArray<TObjectPtr<ULGUISpriteData>>& InSpriteArray, uint32 size, TArray<rbp::Rect>& result)const;
+	/** Size of the sprite take in this atlas, include space and padding */
+	FIntPoint GetSpritePackSize(ULGUISpriteData* InSpriteData)const;
+	/** Area of the sprite take in this atlas, include space and padding */
+	int64 GetSpritePackArea(ULGUISpriteData* InSpriteData)const;
 	bool bWarningIsAlreadyAppearedAtCurrentPackingSession = false;
 	bool bIsYesToAll = false;
 	bool bIsNoToAll = false;
@@ -122,6 +122,8 @@ struct FUIText_RichTextImageTag
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = LGUI) FVector2D Position = FVector2D::ZeroVector;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = LGUI) float Size = 0;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = LGUI) FColor TintColor = FColor::White;
+	/** Resolved by ULGUIRichTextImageData_BaseObject::GetImageHandle when parse rich text, INDEX_NONE if not resolved */
+	int32 ImageHandle = INDEX_NONE;
 };
 
 UENUM(BlueprintType, meta = (Bitflags), Category = LGUI)
@@ -195,8 +197,25 @@ public:
 	TArray<FUIText_RichTextCustomTag> cacheRichTextCustomTagArray;
 	TArray<FUIText_RichTextImageTag> cacheRichTextImageTagArray;
 #pragma endregion OutputResults
+private:
+	/** glyph cache reused across geometry rebuilds, only created when geometry is built again, so static text don't pay for it */
+	TSharedPtr<struct FUITextGlyphCache> glyphCache;
+	bool bHasBuiltGeometry = false;
+	/** return nullptr for the first build, create glyph cache for later builds */
+	struct FUITextGlyphCache* GetGlyphCacheForBuild();
+	/** buffers reused by UpdateContentInPlace, created at first in place update */
+	TSharedPtr<struct FUITextCharsUpdateBuffer> charsUpdateBuffer;
 public:
 	void MarkDirty();
 	/** check if dirty before calculate geometry */
 	void ConditaionalCalculateGeometry();
+	/**
+	 * Change content by replace glyph of changed chars in created geometry, without calculate layout.
+	 * @return false if not possible, then should use SetInputParameters and ConditaionalCalculateGeometry.
+	 */
+	bool UpdateContentInPlace(FStringView InContent);
+	/** font texture is expanded to double size, fix uv of cached glyphs */
+	void ApplyFontTextureScaleUpToGlyphCache();
+	/** clear cached glyphs, call this if font's glyph data could change without notify this text */
+	void ClearGlyphCache();
 };
@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "Utils/LGUIUtils.h"
 #include "LGUITextData.h"
+#include "UObject/ObjectKey.h"
 
 //a set of helpers to parse rich text
 namespace LGUIRichTextParser
@@ -33,10 +34,190 @@ namespace LGUIRichTextParser
 		CustomTagMode customTagMode = CustomTagMode::None;
 		FName customTag;
 		FName imageTag;
+		/** image resolved by ULGUIRichTextImageData_BaseObject::GetImageHandle, INDEX_NONE if not found */
+		int32 imageHandle = INDEX_NONE;
 
 		int charIndex = 0;
 	};
 	
+	enum class RichTextTokenType : uint8
+	{
+		Bold, Italic, Underline, Strikethrough,
+		Size, Color, Sup, Sub, Image, CustomTag,
+		EndBold, EndItalic, EndUnderline, EndStrikethrough,
+		EndSize, EndColor, EndSup, EndSub, EndCustomTag,
+	};
+	/** A tag found in rich text. value is a view into the source text, so it is valid only when the source text is alive and not changed. */
+	struct RichTextToken
+	{
+		RichTextTokenType type;
+		/** index of '<' in source text */
+		int32 startIndex = 0;
+		/** index of '>' in source text */
+		int32 endIndex = 0;
+		/** size or color value, image name, or tag name of end tag and custom tag */
+		FStringView value;
+	};
+	/** Reusable token storage, so tokenize rich text don't allocate after it warm up. */
+	struct RichTextTokenArena
+	{
+		TArray<RichTextToken> tokenArray;
+
+		/**
+		 * Find all tags in text, ordered by startIndex. Only syntax is checked here, RichTextParser::ApplyToken decide if a tag take effect.
+		 * Tags never overlap, because tag value stop at '<'.
+		 */
+		void Tokenize(FStringView text)
+		{
+			tokenArray.Reset();
+			const int32 textLength = text.Len();
+			for (int32 charIndex = 0; charIndex < textLength; charIndex++)
+			{
+				if (text[charIndex] != '<')continue;
+				RichTextToken token;
+				token.startIndex = charIndex;
+				if (GetToken(text, charIndex, token))
+				{
+					tokenArray.Add(token);
+					charIndex = token.endIndex;
+				}
+			}
+		}
+	private:
+		static bool Match(FStringView text, int32 startIndex, const TCHAR* str, int32 strLength)
+		{
+			if (startIndex + strLength > text.Len())return false;
+			for (int32 i = 0; i < strLength; i++)
+			{
+				if (text[startIndex + i] != str[i])return false;
+			}
+			return true;
+		}
+		//find '>' from startIndex, stop at another tag or space or new line. return -1 if not found
+		static int32 FindTagEnd(FStringView text, int32 startIndex)
+		{
+			for (int32 i = startIndex; i < text.Len(); i++)
+			{
+				if (text[i] == '>')
+				{
+					return i;
+				}
+				else if (text[i] == '<'//reach another tag
+					|| text[i] == ' '//reach space
+					|| text[i] == '\n'//reach new line
+					|| text[i] == '\t'//reach new line
+					)
+				{
+					break;
+				}
+			}
+			return -1;
+		}
+		//value tag like 'size=xx>', value start at valueStartIndex and end with '>'
+		static bool GetValueToken(FStringView text, int32 valueStartIndex, RichTextTokenType type, RichTextToken& token)
+		{
+			auto endIndex = FindTagEnd(text, valueStartIndex);
+			if (endIndex <= valueStartIndex)return false;
+			token.type = type;
+			token.endIndex = endIndex;
+			token.value = text.Mid(valueStartIndex, endIndex - valueStartIndex);
+			return true;
+		}
+		static bool GetImageToken(FStringView text, int32 valueStartIndex, RichTextToken& token)
+		{
+			for (int32 i = valueStartIndex + 1; i < text.Len(); i++)
+			{
+				if (text[i] == '>')
+				{
+					if (text[i - 1] == '/')//image is self-close tag, must end with '/>'
+					{
+						token.type = RichTextTokenType::Image;
+						token.endIndex = i;
+						token.value = text.Mid(valueStartIndex, i - valueStartIndex - 1);
+						return true;
+					}
+					break;
+				}
+				else if (text[i] == '<'//reach another tag
+					|| text[i] == ' '//reach space
+					|| text[i] == '\n'//reach new line
+					|| text[i] == '\t'//reach new line
+					)
+				{
+					break;
+				}
+			}
+			return false;
+		}
+		static bool GetToken(FStringView text, int32 charIndex, RichTextToken& token)
+		{
+			const int32 textLength = text.Len();
+			if (charIndex + 2 < textLength && text[charIndex + 2] == '>')
+			{
+				token.endIndex = charIndex + 2;
+				switch (text[charIndex + 1])
+				{
+				case 'b': token.type = RichTextTokenType::Bold; return true;
+				case 'i': token.type = RichTextTokenType::Italic; return true;
+				case 'u': token.type = RichTextTokenType::Underline; return true;
+				case 's': token.type = RichTextTokenType::Strikethrough; return true;
+				}
+				return false;
+			}
+			else if (charIndex + 5 < textLength && Match(text, charIndex + 1, TEXT("size="), 5))
+			{
+				return GetValueToken(text, charIndex + 6, RichTextTokenType::Size, token);
+			}
+			else if (charIndex + 6 < textLength && Match(text, charIndex + 1, TEXT("color="), 6))
+			{
+				return GetValueToken(text, charIndex + 7, RichTextTokenType::Color, token);
+			}
+			else if (charIndex + 4 < textLength && Match(text, charIndex + 1, TEXT("sup>"), 4))
+			{
+				token.type = RichTextTokenType::Sup;
+				token.endIndex = charIndex + 4;
+				return true;
+			}
+			else if (charIndex + 4 < textLength && Match(text, charIndex + 1, TEXT("sub>"), 4))
+			{
+				token.type = RichTextTokenType::Sub;
+				token.endIndex = charIndex + 4;
+				return true;
+			}
+			else if (charIndex + 6 < textLength && Match(text, charIndex + 1, TEXT("img="), 4))
+			{
+				return GetImageToken(text, charIndex + 5, token);
+			}
+			else if (charIndex + 1 < textLength && text[charIndex + 1] == '/')//end
+			{
+				if (charIndex + 3 < textLength && text[charIndex + 3] == '>')
+				{
+					token.endIndex = charIndex + 3;
+					switch (text[charIndex + 2])
+					{
+					case 'b': token.type = RichTextTokenType::EndBold; return true;
+					case 'i': token.type = RichTextTokenType::EndItalic; return true;
+					case 'u': token.type = RichTextTokenType::EndUnderline; return true;
+					case 's': token.type = RichTextTokenType::EndStrikethrough; return true;
+					}
+					return false;
+				}
+				//end tag name is kept as value, so it can fallback to end custom tag
+				if (!GetValueToken(text, charIndex + 2, RichTextTokenType::EndCustomTag, token))return false;
+				if (token.value.Equals(TEXTVIEW("size"), ESearchCase::CaseSensitive))token.type = RichTextTokenType::EndSize;
+				else if (token.value.Equals(TEXTVIEW("color"), ESearchCase::CaseSensitive))token.type = RichTextTokenType::EndColor;
+				else if (token.value.Equals(TEXTVIEW("sup"), ESearchCase::CaseSensitive))token.type = RichTextTokenType::EndSup;
+				else if (token.value.Equals(TEXTVIEW("sub"), ESearchCase::CaseSensitive))token.type = RichTextTokenType::EndSub;
+				return true;
+			}
+			else if (charIndex + 1 < textLength)//custom tag
+			{
+				return GetValueToken(text, charIndex + 1, RichTextTokenType::CustomTag, token);
+			}
+			return false;
+		}
+	};
+
 	struct RichTextParser
 	{
 	private:
@@ -44,10 +225,10 @@ namespace LGUIRichTextParser
 		int						italicCount = 0;
 		int						underlineCount = 0;
 		int						strikethroughCount = 0;
-		TArray<float>			sizeArray;
-		TArray<FColor>			colorArray;
-		TArray<SupOrSubMode>	supOrSubArray;
-		TArray<FName>			customTagArray;
+		TArray<float, TInlineAllocator<8>>			sizeArray;
+		TArray<FColor, TInlineAllocator<8>>			colorArray;
+		TArray<SupOrSubMode, TInlineAllocator<8>>	supOrSubArray;
+		TArray<FName, TInlineAllocator<8>>			customTagArray;
 		FName imageTag = NAME_None;
 
 		int originSize;
@@ -98,293 +279,101 @@ namespace LGUIRichTextParser
 			customTagArray.Reset();
 			imageTag = NAME_None;
 		}
-		bool Parse(const FString& text, const int& textLength, int& startIndex, RichTextParseResult& parseResult)
+		/**
+		 * Apply the tag to parser state.
+		 * @return false if the tag don't take effect (filtered, or no matching begin tag), then the tag should display as plain text.
+		 */
+		bool ApplyToken(const RichTextToken& token, RichTextParseResult& parseResult)
 		{
 			bool haveSymbol = false;
-			int charIndex = startIndex;
-			if (text[charIndex] == '<')
+			switch (token.type)
 			{
-				if (charIndex + 2 < textLength && text[charIndex + 2] == '>')
-				{
-					if (text[charIndex + 1] == 'b')//begin bold
-					{
-						if (enableBold)
-						{
-							startIndex += 3;
-							boldCount++;
-							haveSymbol = true;
-						}
-					}
-					else if (text[charIndex + 1] == 'i')//begin italic
-					{
-						if (enableItalic)
-						{
-							startIndex += 3;
-							italicCount++;
-							haveSymbol = true;
-						}
-					}
-					else if (text[charIndex + 1] == 'u')//begin underline
-					{
-						if (enableUnderline)
-						{
-							startIndex += 3;
-							underlineCount++;
-							haveSymbol = true;
-						}
-					}
-					else if (text[charIndex + 1] == 's')//begin strikethough
-					{
-						if (enableStrikethrough)
-						{
-							startIndex += 3;
-							strikethroughCount++;
-							haveSymbol = true;
-						}
-					}
-				}
-				else if (charIndex + 5 < textLength
-					&& text[charIndex + 1] == 's'
-					&& text[charIndex + 2] == 'i'
-					&& text[charIndex + 3] == 'z'
-					&& text[charIndex + 4] == 'e'
-					&& text[charIndex + 5] == '='
-					)//being size=
+			case RichTextTokenType::Bold: if (enableBold) { boldCount++; haveSymbol = true; } break;
+			case RichTextTokenType::Italic: if (enableItalic) { italicCount++; haveSymbol = true; } break;
+			case RichTextTokenType::Underline: if (enableUnderline) { underlineCount++; haveSymbol = true; } break;
+			case RichTextTokenType::Strikethrough: if (enableStrikethrough) { strikethroughCount++; haveSymbol = true; } break;
+			case RichTextTokenType::EndBold: if (enableBold && boldCount > 0) { boldCount--; haveSymbol = true; } break;
+			case RichTextTokenType::EndItalic: if (enableItalic && italicCount > 0) { italicCount--; haveSymbol = true; } break;
+			case RichTextTokenType::EndUnderline: if (enableUnderline && underlineCount > 0) { underlineCount--; haveSymbol = true; } break;
+			case RichTextTokenType::EndStrikethrough: if (enableStrikethrough && strikethroughCount > 0) { strikethroughCount--; haveSymbol = true; } break;
+			case RichTextTokenType::Size:
+			{
+				float parsedSize;
+				bool absoluteOrAdditional;
+				if (enableSize && GetSize(token.value, parsedSize, absoluteOrAdditional))
 				{
-					if (enableSize)
-					{
-						int charEndIndex;
-						float parsedSize;
-						bool absoluteOrAdditional;
-						if (GetSize(text, textLength, charIndex + 6, charEndIndex, parsedSize, absoluteOrAdditional))
-						{
-							startIndex += charEndIndex - charIndex + 1;
-							if (absoluteOrAdditional)
-							{
-								sizeArray.Add(parsedSize);
-							}
-							else
-							{
-								sizeArray.Add(originSize + parsedSize);
-							}
-							haveSymbol = true;
-						}
-					}
+					sizeArray.Add(absoluteOrAdditional ? parsedSize : originSize + parsedSize);
+					haveSymbol = true;
 				}
-				else if (charIndex + 6 < textLength
-					&& text[charIndex + 1] == 'c'
-					&& text[charIndex + 2] == 'o'
-					&& text[charIndex + 3] == 'l'
-					&& text[charIndex + 4] == 'o'
-					&& text[charIndex + 5] == 'r'
-					&& text[charIndex + 6] == '='
-					)//begin color=
+			}
+			break;
+			case RichTextTokenType::Color:
+			{
+				FColor parsedColor;
+				if (enableColor && GetColor(token.value, parsedColor))
 				{
-					if (enableColor)
-					{
-						int charEndIndex;
-						FColor parsedColor;
-						if (GetColor(text, textLength, charIndex + 7, charEndIndex, parsedColor))
-						{
-							startIndex += charEndIndex - charIndex + 1;
-							colorArray.Add(parsedColor);
-							haveSymbol = true;
-						}
-					}
+					colorArray.Add(parsedColor);
+					haveSymbol = true;
 				}
-				else if (charIndex + 4 < textLength
-					&& text[charIndex + 1] == 's'
-					&& text[charIndex + 2] == 'u'
-					&& text[charIndex + 3] == 'p'
-					&& text[charIndex + 4] == '>'
-					)//begin sup
+			}
+			break;
+			case RichTextTokenType::Sup: if (enableSuperscript) { supOrSubArray.Add(SupOrSubMode::Sup); haveSymbol = true; } break;
+			case RichTextTokenType::Sub: if (enableSubscript) { supOrSubArray.Add(SupOrSubMode::Sub); haveSymbol = true; } break;
+			case RichTextTokenType::Image:
+			{
+				if (enableImage)
 				{
-					if (enableSuperscript)
-					{
-						startIndex += 5;
-						supOrSubArray.Add(SupOrSubMode::Sup);
-						haveSymbol = true;
-					}
+					imageTag = FName(token.value.Len(), token.value.GetData());
+					haveSymbol = true;
 				}
-				else if (charIndex + 4 < textLength
-					&& text[charIndex + 1] == 's'
-					&& text[charIndex + 2] == 'u'
-					&& text[charIndex + 3] == 'b'
-					&& text[charIndex + 4] == '>'
-					)//begin sub
+			}
+			break;
+			//end tag with empty stack is treated as end of custom tag with same name
+			case RichTextTokenType::EndSize:
+			{
+				if (sizeArray.Num() > 0)
 				{
-					if (enableSubscript)
-					{
-						startIndex += 5;
-						supOrSubArray.Add(SupOrSubMode::Sub);
-						haveSymbol = true;
-					}
+					if (enableSize) { sizeArray.RemoveAt(sizeArray.Num() - 1); haveSymbol = true; }
 				}
-				else if (charIndex + 6 < textLength
-					&& text[charIndex + 1] == 'i'
-					&& text[charIndex + 2] == 'm'
-					&& text[charIndex + 3] == 'g'
-					&& text[charIndex + 4] == '='
-					)//begin image=
+				else haveSymbol = EndCustomTag(token, parseResult);
+			}
+			break;
+			case RichTextTokenType::EndColor:
+			{
+				if (colorArray.Num() > 0)
 				{
-					if (enableImage)
-					{
-						int charEndIndex;
-						if (GetImageTag(text, textLength, charIndex + 5, charEndIndex, imageTag))
-						{
-							startIndex += charEndIndex - charIndex + 1;
-							haveSymbol = true;
-						}
-					}
+					if (enableColor) { colorArray.RemoveAt(colorArray.Num() - 1); haveSymbol = true; }
 				}
-				else if (charIndex + 1 < textLength && text[charIndex + 1] == '/')//end
+				else haveSymbol = EndCustomTag(token, parseResult);
+			}
+			break;
+			case RichTextTokenType::EndSup:
+			case RichTextTokenType::EndSub:
+			{
+				if (supOrSubArray.Num() > 0)
 				{
-					if (charIndex + 3 < textLength && text[charIndex + 3] == '>')
-					{
-						if (text[charIndex + 2] == 'b' && boldCount > 0)//end bold
-						{
-							if (enableBold)
-							{
-								startIndex += 4;
-								boldCount--;
-								haveSymbol = true;
-							}
-						}
-						else if (text[charIndex + 2] == 'i' && italicCount > 0)//end italic
-						{
-							if (enableItalic)
-							{
-								startIndex += 4;
-								italicCount--;
-								haveSymbol = true;
-							}
-						}
-						else if (text[charIndex + 2] == 'u' && underlineCount > 0)//end underline
-						{
-							if (enableUnderline)
-							{
-								startIndex += 4;
-								underlineCount--;
-								haveSymbol = true;
-							}
-						}
-						else if (text[charIndex + 2] == 's' && strikethroughCount > 0)//end strikethough
-						{
-							if (enableStrikethrough)
-							{
-								startIndex += 4;
-								strikethroughCount--;
-								haveSymbol = true;
-							}
-						}
-					}
-					else if (charIndex + 6 < textLength
-						&& text[charIndex + 2] == 's'
-						&& text[charIndex + 3] == 'i'
-						&& text[charIndex + 4] == 'z'
-						&& text[charIndex + 5] == 'e'
-						&& text[charIndex + 6] == '>'
-						&& sizeArray.Num() > 0
-						)//end size
-					{
-						if (enableSize)
-						{
-							startIndex += 7;
-							sizeArray.RemoveAt(sizeArray.Num() - 1);
-							haveSymbol = true;
-						}
-					}
-					else if (charIndex + 7 < textLength
-						&& text[charIndex + 2] == 'c'
-						&& text[charIndex + 3] == 'o'
-						&& text[charIndex + 4] == 'l'
-						&& text[charIndex + 5] == 'o'
-						&& text[charIndex + 6] == 'r'
-						&& text[charIndex + 7] == '>'
-						&& colorArray.Num() > 0
-						)//end color
-					{
-						if (enableColor)
-						{
-							startIndex += 8;
-							colorArray.RemoveAt(colorArray.Num() - 1);
-							haveSymbol = true;
-						}
-					}
-					else if (charIndex + 5 < textLength
-						&& text[charIndex + 2] == 's'
-						&& text[charIndex + 3] == 'u'
-						&& text[charIndex + 4] == 'p'
-						&& text[charIndex + 5] == '>'
-						&& supOrSubArray.Num() > 0
-						)//end sup
-					{
-						if (enableSuperscript)
-						{
-							startIndex += 6;
-							supOrSubArray.RemoveAt(supOrSubArray.Num() - 1);
-							haveSymbol = true;
-						}
-					}
-					else if (charIndex + 5 < textLength
-						&& text[charIndex + 2] == 's'
-						&& text[charIndex + 3] == 'u'
-						&& text[charIndex + 4] == 'b'
-						&& text[charIndex + 5] == '>'
-						&& supOrSubArray.Num() > 0
-						)//end sub
-					{
-						if (enableSubscript)
-						{
-							startIndex += 6;
-							supOrSubArray.RemoveAt(supOrSubArray.Num() - 1);
-							haveSymbol = true;
-						}
-					}
-					else if (customTagArray.Num() > 0
-						)//end custom tag
-					{
-						if (enableCustomTag)
-						{
-							int charEndIndex;
-							FName tag;
-							if (GetCustomTag(text, textLength, charIndex + 2, charEndIndex, tag))
-							{
-								auto foundIndex = customTagArray.IndexOfByKey(tag);
-								if (foundIndex != -1)
-								{
-									customTagArray.RemoveAt(foundIndex);
-									startIndex += charEndIndex - charIndex + 1;
-									parseResult.customTag = tag;
-									parseResult.customTagMode = CustomTagMode::End;
-									haveSymbol = true;
-								}
-							}
-						}
-					}
+					if (token.type == RichTextTokenType::EndSup ? enableSuperscript : enableSubscript) { supOrSubArray.RemoveAt(supOrSubArray.Num() - 1); haveSymbol = true; }
 				}
-				else if(charIndex + 1 < textLength
-					)//check custom tag
+				else haveSymbol = EndCustomTag(token, parseResult);
+			}
+			break;
+			case RichTextTokenType::EndCustomTag: haveSymbol = EndCustomTag(token, parseResult); break;
+			case RichTextTokenType::CustomTag:
+			{
+				if (enableCustomTag)
 				{
-					if (enableCustomTag)
+					FName tag(token.value.Len(), token.value.GetData());
+					if (customTagArray.IndexOfByKey(tag) == INDEX_NONE)
 					{
-						int charEndIndex;
-						FName tag;
-						if (GetCustomTag(text, textLength, charIndex + 1, charEndIndex, tag))
-						{
-							auto foundIndex = customTagArray.IndexOfByKey(tag);
-							if (foundIndex == -1)
-							{
-								startIndex += charEndIndex - charIndex + 1;
-								customTagArray.Add(tag);
-								parseResult.customTag = tag;
-								parseResult.customTagMode = CustomTagMode::Start;
-								haveSymbol = true;
-							}
-						}
+						customTagArray.Add(tag);
+						parseResult.customTag = tag;
+						parseResult.customTagMode = CustomTagMode::Start;
+						haveSymbol = true;
 					}
 				}
 			}
+			break;
+			}
 			if (haveSymbol)
 			{
 				parseResult.bold = boldCount > 0 || originBold;
@@ -405,223 +394,281 @@ namespace LGUIRichTextParser
 			return haveSymbol;
 		}
 	private:
-		//get size from 'size=' or 'size=+' or 'size=-', end with '>'
+		bool EndCustomTag(const RichTextToken& token, RichTextParseResult& parseResult)
+		{
+			if (!enableCustomTag || customTagArray.Num() == 0)return false;
+			FName tag(token.value.Len(), token.value.GetData());
+			auto foundIndex = customTagArray.IndexOfByKey(tag);
+			if (foundIndex == INDEX_NONE)return false;
+			customTagArray.RemoveAt(foundIndex);
+			parseResult.customTag = tag;
+			parseResult.customTagMode = CustomTagMode::End;
+			return true;
+		}
+		//get size from 'size=' or 'size=+' or 'size=-' value
 		//return true if is valid
-		static bool GetSize(const FString& text, int textLength, int startIndex, int& outEndIndex, float& outSize, bool& outAbsoluteOrAdditional)
+		static bool GetSize(FStringView sizeStr, float& outSize, bool& outAbsoluteOrAdditional)
 		{
-			int endIndex = -1;
-			for (int i = startIndex; i < textLength; i++)
+			outAbsoluteOrAdditional = sizeStr[0] != '+' && sizeStr[0] != '-';
+			if (IsNumeric(sizeStr))
 			{
-				if (text[i] == '>')
-				{
-					endIndex = i;
-					break;
-				}
-				else if (text[i] == '<'//reach another tag
-					|| text[i] == ' '//reach space
-					|| text[i] == '\n'//reach new line
-					|| text[i] == '\t'//reach new line
-					)
-				{
-					break;
-				}
-			}
-			if (endIndex != -1 && endIndex > startIndex)//found end
-			{
-				FString sizeStr = text.Mid(startIndex, endIndex - startIndex);
-				outAbsoluteOrAdditional = sizeStr[0] != '+' && sizeStr[0] != '-';
-				if (sizeStr.IsNumeric())
-				{
-					outSize = FCString::Atof(*sizeStr);
-					outEndIndex = endIndex;
-					return true;
-				}
+				outSize = Atof(sizeStr);
+				return true;
 			}
 			return false;
 		}
-		static bool GetCustomTag(const FString& text, int textLength, int startIndex, int& outEndIndex, FName& outTag)
+		//same as FCString::IsNumeric, but check in range, so no need to create sub string
+		static bool IsNumeric(FStringView str)
 		{
-			int endIndex = -1;
-			for (int i = startIndex; i < textLength; i++)
+			int i = 0;
+			if (str[0] == '-' || str[0] == '+')
 			{
-				if (text[i] == '>')
+				i++;
+			}
+			bool hasDot = false;
+			for (; i < str.Len(); i++)
+			{
+				if (str[i] == '.')
 				{
-					endIndex = i;
-					break;
+					if (hasDot)return false;
+					hasDot = true;
 				}
-				else if (text[i] == '<'//reach another tag
-					|| text[i] == ' '//reach space
-					|| text[i] == '\n'//reach new line
-					|| text[i] == '\t'//reach new line
-					)
+				else if (!FChar::IsDigit(str[i]))
 				{
-					break;
+					return false;
 				}
 			}
-			if (endIndex != -1 && endIndex > startIndex)//found end
+			return true;
+		}
+		static float Atof(FStringView str)
+		{
+			TCHAR buffer[64];
+			if (str.Len() < UE_ARRAY_COUNT(buffer))
 			{
-				outTag = FName(*text.Mid(startIndex, endIndex - startIndex));
-				outEndIndex = endIndex;
-				return true;
+				FMemory::Memcpy(buffer, str.GetData(), str.Len() * sizeof(TCHAR));
+				buffer[str.Len()] = 0;
+				return FCString::Atof(buffer);
 			}
-			return false;
+			return FCString::Atof(*FString(str.Len(), str.GetData()));
 		}
-		static bool GetImageTag(const FString& text, int textLength, int startIndex, int& outEndIndex, FName& outTag)
+		static int HexValue(TCHAR c)
 		{
-			int endIndex = -1;
-			for (int i = startIndex + 1; i < textLength; i++)
+			if (c >= '0' && c <= '9')return c - '0';
+			if (c >= 'a' && c <= 'f')return c - 'a' + 10;
+			if (c >= 'A' && c <= 'F')return c - 'A' + 10;
+			return -1;
+		}
+		//get color from 'color=red' or 'color=#ffffff' value
+		//return true if is valid
+		bool GetColor(FStringView colorStr, FColor& outColor)
+		{
+			const int colorStrLength = colorStr.Len();
+			struct FNamedColor
 			{
-				if (text[i] == '>')
+				FStringView name;
+				FColor color;
+			};
+			static const FNamedColor namedColorArray[] =
+			{
+				{ TEXTVIEW("black"), FColor::Black },
+				{ TEXTVIEW("white"), FColor::White },
+				{ TEXTVIEW("gray"), FColor(128, 128, 128) },
+				{ TEXTVIEW("silver"), FColor(192, 192, 192) },
+				{ TEXTVIEW("red"), FColor::Red },
+				{ TEXTVIEW("green"), FColor::Green },
+				{ TEXTVIEW("blue"), FColor::Blue },
+				{ TEXTVIEW("orange"), FColor(255, 165, 0) },
+				{ TEXTVIEW("purple"), FColor(128, 0, 128) },
+				{ TEXTVIEW("yellow"), FColor(255, 255, 0) },
+			};
+			for (auto& namedColor : namedColorArray)
+			{
+				if (colorStr.Equals(namedColor.name, ESearchCase::IgnoreCase))
 				{
-					if (text[i - 1] == '/')//image is self-close tag, must end with '/>'
-					{
-						endIndex = i;
-						break;
-					}
-					else
+					outColor = namedColor.color;
+					outColor.A = originCanvasGroupAlpha;
+					return true;
+				}
+			}
+			if (colorStr[0] == '#')
+			{
+				if (colorStrLength == 7 || colorStrLength == 9)//#ffffff/#ffffff00
+				{
+					outColor.A = originCanvasGroupAlpha;
+					for (int i = 1; i < colorStrLength; i += 2)
 					{
-						break;
+						int firstIndex = HexValue(colorStr[i]);
+						int secondIndex = HexValue(colorStr[i + 1]);
+						if (firstIndex != -1 && secondIndex != -1)//valid
+						{
+							uint8 value = (uint8)(firstIndex * 16 + secondIndex);
+							switch (i)
+							{
+							case 1:outColor.R = value; break;
+							case 3:outColor.G = value; break;
+							case 5:outColor.B = value; break;
+							case 7:
+							{
+								outColor.A = (uint8)(LGUIUtils::Color255To1_Table[originCanvasGroupAlpha] * value);
+							}
+							break;
+							}
+						}
+						else
+						{
+							return false;
+						}
 					}
+					return true;
 				}
-				else if (text[i] == '<'//reach another tag
-					|| text[i] == ' '//reach space
-					|| text[i] == '\n'//reach new line
-					|| text[i] == '\t'//reach new line
+			}
+			return false;
+		}
+	};
+
+	/** Parameters that affect rich text parse result, except the text itself */
+	struct RichTextParseParameter
+	{
+		float size = 0;
+		FColor color;
+		uint8 canvasGroupAlpha = 0;
+		bool bold = false;
+		bool italic = false;
+		int32 flags = 0;
+		FObjectKey customStyleData;
+		uint32 customStyleDataVersion = 0;
+		/** image name is resolved to handle in parse result, so image data is also part of the key */
+		FObjectKey imageData;
+		uint32 imageDataVersion = 0;
+
+		friend uint32 GetTypeHash(const RichTextParseParameter& In)
+		{
+			uint32 hash = GetTypeHash(In.size);
+			hash = HashCombine(hash, In.color.DWColor());
+			hash = HashCombine(hash, ((uint32)In.canvasGroupAlpha << 2) | ((uint32)In.bold << 1) | (uint32)In.italic);
+			hash = HashCombine(hash, (uint32)In.flags);
+			hash = HashCombine(hash, GetTypeHash(In.customStyleData));
+			hash = HashCombine(hash, In.customStyleDataVersion);
+			hash = HashCombine(hash, GetTypeHash(In.imageData));
+			hash = HashCombine(hash, In.imageDataVersion);
+			return hash;
+		}
+		bool operator==(const RichTextParseParameter& Other)const
+		{
+			return size == Other.size
+				&& color == Other.color
+				&& canvasGroupAlpha == Other.canvasGroupAlpha
+				&& bold == Other.bold
+				&& italic == Other.italic
+				&& flags == Other.flags
+				&& customStyleData == Other.customStyleData
+				&& customStyleDataVersion == Other.customStyleDataVersion
+				&& imageData == Other.imageData
+				&& imageDataVersion == Other.imageDataVersion
+				;
+		}
+	};
+
+	/**
+	 * Cache parse result of rich text, so rebuild a text with same content and same parse parameters don't need to parse again.
+	 * A text is only added after it missed twice, so text that change every rebuild (eg. a counter) don't pay for the copy.
+	 */
+	struct RichTextParseCache
+	{
+		struct Entry
+		{
+			uint32 hash = 0;
+			FString text;
+			RichTextParseParameter parameter;
+
+			/** text content without rich text tags */
+			FString content;
+			TArray<RichTextParseResult> parseResultArray;
+			uint64 lastUseIndex = 0;
+		};
+	private:
+		TArray<Entry> entryArray;
+		/** hash of recently missed text, to decide if a missed text should be added */
+		TArray<uint32> missHashArray;
+		int32 missHashWriteIndex = 0;
+		uint64 useIndex = 0;
+	public:
+		static uint32 GetHash(const FString& text, const RichTextParseParameter& parameter)
+		{
+			return HashCombine(GetTypeHash(text), GetTypeHash(parameter));
+		}
+		/** Find cached entry by hash from GetHash, return nullptr if not found. The entry is valid until next Add. */
+		const Entry* Find(uint32 hash, const FString& text, const RichTextParseParameter& parameter)
+		{
+			for (auto& entry : entryArray)
+			{
+				if (entry.hash == hash
+					&& entry.parameter == parameter
+					&& entry.text.Equals(text, ESearchCase::CaseSensitive)
 					)
 				{
-					break;
+					entry.lastUseIndex = ++useIndex;
+					return &entry;
 				}
 			}
-			if (endIndex != -1 && endIndex > startIndex)//found end
+			return nullptr;
+		}
+		/** Record a missed text, return true if the same text also missed recently so it worth to be added. */
+		bool RecordMiss(int32 capacity, uint32 hash)
+		{
+			auto foundIndex = missHashArray.IndexOfByKey(hash);
+			if (foundIndex != INDEX_NONE)
 			{
-				outTag = FName(*text.Mid(startIndex, endIndex - startIndex - 1));
-				outEndIndex = endIndex;
+				missHashArray[foundIndex] = 0;
 				return true;
 			}
+			if (missHashArray.Num() != capacity)
+			{
+				missHashArray.SetNumZeroed(capacity);
+				missHashWriteIndex = 0;
+			}
+			missHashWriteIndex = (missHashWriteIndex + 1) % capacity;
+			missHashArray[missHashWriteIndex] = hash;
 			return false;
 		}
-		//get color from 'color=red' or 'color=#ffffff', end with '>'
-		//return true if is valid
-		bool GetColor(const FString& text, int textLength, int startIndex, int& outEndIndex, FColor& outColor)
+		/** Add entry to cache, replace the least recently used one if cache is full. Return the added entry, nullptr if capacity is 0. */
+		const Entry* Add(int32 capacity, uint32 hash, const FString& text, const RichTextParseParameter& parameter
+			, const FString& content, const TArray<RichTextParseResult>& parseResultArray)
 		{
-			int endIndex = -1;
-			for (int i = startIndex; i < textLength; i++)
+			if (capacity <= 0)
 			{
-				if (text[i] == '>')
-				{
-					endIndex = i;
-					break;
-				}
-				else if (text[i] == '<'//reach another tag
-					|| text[i] == ' '//reach space
-					|| text[i] == '\n'//reach new line
-					|| text[i] == '\t'//reach new line
-					)
-				{
-					break;
-				}
+				entryArray.Empty();
+				missHashArray.Empty();
+				return nullptr;
 			}
-			if (endIndex != -1 && endIndex > startIndex)//found end
+			while (entryArray.Num() > capacity)
 			{
-				outEndIndex = endIndex;
-				FString colorString = text.Mid(startIndex, endIndex - startIndex);
-				colorString.ToLowerInline();
-				if (colorString == TEXT("black"))
-				{
-					outColor = FColor::Black;
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("white"))
-				{
-					outColor = FColor::White;
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("gray"))
-				{
-					outColor = FColor(128, 128, 128);
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("silver"))
-				{
-					outColor = FColor(192, 192, 192);
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("red"))
-				{
-					outColor = FColor::Red;
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("green"))
-				{
-					outColor = FColor::Green;
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("blue"))
-				{
-					outColor = FColor::Blue;
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("orange"))
-				{
-					outColor = FColor(255, 165, 0);
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("purple"))
-				{
-					outColor = FColor(128, 0, 128);
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString == TEXT("yellow"))
-				{
-					outColor = FColor(255, 255, 0);
-					outColor.A = originCanvasGroupAlpha;
-					return true;
-				}
-				else if (colorString[0] == '#')
+				entryArray.RemoveAt(entryArray.Num() - 1, 1, false);
+			}
+			Entry* entryPtr = nullptr;
+			if (entryArray.Num() < capacity)
+			{
+				entryPtr = &entryArray.AddDefaulted_GetRef();
+			}
+			else
+			{
+				entryPtr = &entryArray[0];
+				for (auto& entry : entryArray)
 				{
-					const static TArray<TCHAR> hexTable = { '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f' };
-					if (colorString.Len() == 7 || colorString.Len() == 9)//#ffffff/#ffffff00
+					if (entry.lastUseIndex < entryPtr->lastUseIndex)
 					{
-						outColor.A = originCanvasGroupAlpha;
-						int colorStringLength = colorString.Len();
-						for (int i = 1; i < colorStringLength; i += 2)
-						{
-							int firstIndex = hexTable.IndexOfByKey(colorString[i]);
-							int secondIndex = hexTable.IndexOfByKey(colorString[i + 1]);
-							if (firstIndex != -1 && secondIndex != -1)//valid
-							{
-								uint8 value = (uint8)(firstIndex * 16 + secondIndex);
-								switch (i)
-								{
-								case 1:outColor.R = value; break;
-								case 3:outColor.G = value; break;
-								case 5:outColor.B = value; break;
-								case 7:
-								{
-									outColor.A = (uint8)(LGUIUtils::Color255To1_Table[originCanvasGroupAlpha] * value);
-								}
-								break;
-								}
-							}
-							else
-							{
-								return false;
-							}
-						}
-						return true;
+						entryPtr = &entry;
 					}
 				}
 			}
-			return false;
+			auto& entry = *entryPtr;
+			entry.hash = hash;
+			entry.text = text;
+			entry.parameter = parameter;
+			entry.content = content;
+			entry.parseResultArray = parseResultArray;
+			entry.lastUseIndex = ++useIndex;
+			return entryPtr;
 		}
 	};
 }
\ No newline at end of file
@@ -41,6 +41,14 @@ public:
 	FVector3f Tangent;
 };
 
+/** Reusable buffers for UIGeometry::UpdateUITextChars, owned by each text so nothing is shared between texts. */
+struct FUITextCharsUpdateBuffer
+{
+	TArray<FLGUIOriginVertexData> oldCharOriginVertices, newCharOriginVertices;
+	TArray<FLGUIMeshVertex> oldCharVertices, newCharVertices;
+	TArray<FLGUIMeshIndexBufferType> charTriangles;
+};
+
 class LGUI_API UIGeometry
 {
 public:
@@ -199,7 +207,19 @@ public:
 		, ULGUICanvas* renderCanvas, class UUIText* uiComp
 		, TArray<FUITextLineProperty>& cacheLinePropertyArray, TArray<FUITextCharProperty>& cacheCharPropertyArray, TArray<FUIText_RichTextCustomTag>& cacheRichTextCustomTagArray
 		, TArray<FUIText_RichTextImageTag>& cacheRichTextImageTagArray
-		, ULGUIFontData_BaseObject* font, bool richText, int32 richTextFilterFlags);
+		, ULGUIFontData_BaseObject* font, bool richText, int32 richTextFilterFlags
+		, struct FUITextGlyphCache* glyphCache = nullptr);
+	/**
+	 * Replace glyph of changed chars in text geometry created by UpdateUIText, without doing layout again. Only for non-rich text without kerning, and not ClampContent.
+	 * @return false if layout could change (eg. char count or xadvance change), then geometry should be updated with UpdateUIText.
+	 */
+	static bool UpdateUITextChars(const FString& oldText, FStringView newText, const FColor& color, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
+		, EUITextFontStyle fontStyle, EUITextOverflowType overflowType
+		, ULGUICanvas* renderCanvas, class UUIText* uiComp
+		, const TArray<FUITextCharProperty>& cacheCharPropertyArray
+		, ULGUIFontData_BaseObject* font
+		, FUITextCharsUpdateBuffer& updateBuffer
+		, struct FUITextGlyphCache* glyphCache = nullptr);
 #pragma endregion
 
 public:
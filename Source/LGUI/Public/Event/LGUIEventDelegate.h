@@ -75,6 +75,7 @@ struct LGUI_API FLGUIEventDelegateData
 private:
 	friend struct FLGUIEventDelegate;
 	friend class FLGUIEventDelegateCustomization;
+	friend struct FLGUIEventDelegateBenchmark;
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(EditAnywhere, Transient, Category = "LGUI")bool BoolValue = false;
 	UPROPERTY(EditAnywhere, Transient, Category = "LGUI")float FloatValue = 0;
@@ -130,6 +131,22 @@ private:
 		bool UseNativeParameter = false;
 private:
 	UPROPERTY(Transient) TObjectPtr<UFunction> CacheFunction = nullptr;
+	/** CacheFunction's invocation data is prepared */
+	bool bInvocationPrepared = false;
+	/** CacheFunction is a plain native function, can call it's thunk directly without ProcessEvent */
+	bool bUseNativeInvoke = false;
+	/** Target is actor, need to check if actor can execute function */
+	bool bNativeInvokeTargetIsActor = false;
+	FNativeFuncPtr CacheNativeFunc = nullptr;
+	/** If function's parameter is passed by reference, then need to provide it as out parameter */
+	FProperty* CacheOutParmProperty = nullptr;
+	/** Parameter deserialized from ParamBuffer, so no need to do it for every execute */
+	FString CacheStringValue;
+	FName CacheNameValue;
+	FText CacheTextValue;
+	/** ParamBuffer that cached parameter is deserialized from, ParamBuffer could be edited after cache (eg. in PIE), compare it to know if need to deserialize again */
+	TArray<uint8> CacheParamBuffer;
+	bool bCacheParameterValid = false;
 public:
 	void Execute();
 	void Execute(void* InParam, ELGUIEventDelegateParameterType InParameterType);
@@ -145,6 +162,11 @@ private:
 	void FindAndExecute(UObject* Target, void* ParamData = nullptr);
 	void ExecuteTargetFunction(UObject* Target, UFunction* Func);
 	void ExecuteTargetFunction(UObject* Target, UFunction* Func, void* ParamData);
+	/** Prepare data for execute target function, only need to do once after CacheFunction is found */
+	void PrepareInvocation(UObject* Target, UFunction* Func);
+	/** Deserialize String/Name/Text parameter from ParamBuffer if it's changed */
+	void ConditionalUpdateCacheParameter();
+	void InvokeFunction(UObject* Target, UFunction* Func, void* ParamData);
 };
 
 /**
@@ -160,6 +182,7 @@ public:
 	FLGUIEventDelegate(ELGUIEventDelegateParameterType InParameterType);
 private:
 	friend class FLGUIEventDelegateCustomization;
+	friend struct FLGUIEventDelegateBenchmark;
 	/** event list */
 	UPROPERTY(EditAnywhere, Category = "LGUI")
 		mutable TArray<FLGUIEventDelegateData> eventList;
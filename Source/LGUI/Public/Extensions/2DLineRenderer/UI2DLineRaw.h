@@ -32,6 +32,17 @@ protected:
 public:
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		void SetPoints(const TArray<FVector2D>& InPoints);
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		const TArray<FVector2D>& GetPoints()const { return PointArray; }
+	/** Add a point at end. Only the new segment and previous end point will be tessellated. */
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		void AddPoint(const FVector2D& InPoint);
+	/** Remove the end point. Only the new end point will be tessellated. */
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		void RemoveLastPoint();
+	/** Change a single point. Only this point and it's neighbours will be tessellated. */
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		void SetPoint(int32 InIndex, const FVector2D& InPoint);
 };
 
 
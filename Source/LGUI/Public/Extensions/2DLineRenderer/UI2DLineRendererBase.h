@@ -69,9 +69,63 @@ protected:
 		, FVector2D& OutPosA, FVector2D& OutPosB
 		, FVector2D& InOutPrevLineDir);
 	FORCEINLINE bool CanConnectStartEndPoint(int InPointCount) { return EndType == EUI2DLineRenderer_EndType::ConnectStartAndEnd && InPointCount >= 3; }
-	void Update2DLineRendererBaseTriangle(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray);
-	void Update2DLineRendererBaseUV(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray);
-	void Update2DLineRendererBaseVertex(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray);
+	/** @param InStartPointIndex only update triangles of segments from this point */
+	void Update2DLineRendererBaseTriangle(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray, int32 InStartPointIndex = 0);
+	/** @param InStartPointIndex only update uv of vertices from this point */
+	void Update2DLineRendererBaseUV(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray, int32 InStartPointIndex = 0);
+	/**
+	 * @param InStartPointIndex InEndPointIndex only calculate points in this range
+	 * @param InUpdateStartPoint calculate start point and start cap even if InStartPointIndex is not 0, because start cap's vertex index change with point count
+	 */
+	void Update2DLineRendererBaseVertex(UIGeometry& InGeo, const TArray<FVector2D>& InPointArray, int32 InStartPointIndex = 0, int32 InEndPointIndex = MAX_int32, bool InUpdateStartPoint = true);
+
+	/**
+	 * Mark only some points changed (eg. add/remove/set a single point), so next geometry update only tessellate these points and their neighbours.
+	 * Will fallback to tessellate all points if anything that affect the whole line is changed, eg. line width, sprite, size, color.
+	 * @param InStartPointIndex first changed point
+	 * @param InEndPointIndex last changed point
+	 * @param InPointCountChanged points are added or removed
+	 */
+	void MarkPointsDirty(int32 InStartPointIndex, int32 InEndPointIndex, bool InPointCountChanged);
+private:
+	/** Changed point range recorded by MarkPointsDirty, INDEX_NONE if not recorded. */
+	int32 DirtyPointStartIndex = INDEX_NONE;
+	int32 DirtyPointEndIndex = INDEX_NONE;
+	/** Parameters used by last tessellation, if any of these changed then all points need to be tessellated. */
+	struct F2DLineTessellationState
+	{
+		float PivotOffsetX = 0, PivotOffsetY = 0;
+		float LineWidth = 0, LineWidthOffset = 0;
+		EUI2DLineRenderer_EndType EndType = EUI2DLineRenderer_EndType::None;
+		bool bEndCapSizeAffectByLineWidth = false;
+		bool bRequireNormalOrTangent = false;
+		const UObject* Sprite = nullptr;
+		FVector4f SpriteUV = FVector4f::Zero();
+		FIntVector4 SpriteSizeAndBorder = FIntVector4::ZeroValue;
+		FColor Color = FColor::White;
+		bool operator==(const F2DLineTessellationState& Other)const
+		{
+			return PivotOffsetX == Other.PivotOffsetX && PivotOffsetY == Other.PivotOffsetY
+				&& LineWidth == Other.LineWidth && LineWidthOffset == Other.LineWidthOffset
+				&& EndType == Other.EndType && bEndCapSizeAffectByLineWidth == Other.bEndCapSizeAffectByLineWidth
+				&& bRequireNormalOrTangent == Other.bRequireNormalOrTangent
+				&& Sprite == Other.Sprite && SpriteUV == Other.SpriteUV && SpriteSizeAndBorder == Other.SpriteSizeAndBorder
+				&& Color == Other.Color;
+		}
+	};
+	F2DLineTessellationState PrevTessellationState;
+	bool bHasPrevTessellationState = false;
+	int32 PrevPointCount = 0;
+	int32 PrevVertexCount = 0;
+	int32 PrevTriangleIndicesCount = 0;
+	/** Geometry filled by last tessellation. UIBatchMeshRenderable clear geometry (keep memory) before OnUpdateGeometry, so we can only check array memory and our own counts. */
+	const UIGeometry* PrevGeometry = nullptr;
+	/** Last tessellation only update changed points. */
+	bool bLastTessellationIncremental = false;
+	friend struct FLGUI2DLineIncrementalUpdateCheck;
+	F2DLineTessellationState MakeTessellationState()const;
+	/** Is the line direction before this point can be calculated from nearby points, so tessellation can start from this point. */
+	bool CanStartTessellationFromPoint(const TArray<FVector2D>& InPointArray, int32 InPointIndex);
 public:
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		float GetLineWidth()const { return LineWidth; }
@@ -55,6 +55,12 @@ private:
 	/** Enable backside interaction? Front side always interactable. */
 	UPROPERTY(EditAnywhere, Category = LGUI)
 		bool bEnableInteractOnBackside = false;
+	/**
+	 * Use a simple box as collision instead of cooking triangle mesh collision, so geometry change don't need physics cooking.
+	 * Hit uv is calculated analytically from ray and geometry parameters (Pivot, CylinderArcAngle, render target size).
+	 */
+	UPROPERTY(EditAnywhere, Category = LGUI)
+		bool bUseSimpleCollision = false;
 	/**
 	 * Android GLES is flipped, so we flip it back. This just set the material property "FlipY".
 	 * No need for UE5.1 and upward
@@ -89,7 +95,14 @@ private:
 	void UpdateLocalBounds();
 	void UpdateCollision();
 	void UpdateMeshData();
+	/** Calculate hit uv from physics hit result (face index and hit point), or mesh data. */
+	bool LineTraceHitUVFromMesh(const int32& InHitFaceIndex, const FVector& InHitPoint, const FVector& InLineStart, const FVector& InLineEnd, FVector2D& OutHitUV)const;
+	/** Calculate hit uv from ray in world space and geometry parameters, no physics data needed. */
+	bool LineTraceHitUVAnalytic(const FVector& InLineStart, const FVector& InLineEnd, FVector2D& OutHitUV)const;
+	/** Ray in local space intersect with cylinder's segment quad. OutHitT is ray's interpolation parameter from start to end. */
+	bool LineTraceCylinderSegment(int32 InSegment, const FVector& InLocalRayStart, const FVector& InLocalRayEnd, float& OutHitT, FVector2D& OutHitUV)const;
 	friend class FLGUIRenderTargetGeometrySource_SceneProxy;
+	friend struct FLGUIRenderTargetGeometryLineTraceSweep;
 	TArray<FDynamicMeshVertex> Vertices;
 	TArray<uint16> Triangles;
 #if WITH_EDITOR
@@ -142,6 +155,8 @@ public:
 		bool GetEnableInteractOnBackside()const { return bEnableInteractOnBackside; }
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		bool GetFlipVerticalOnGLES()const { return bFlipVerticalOnGLES; }
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		bool GetUseSimpleCollision()const { return bUseSimpleCollision; }
 
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		void SetCanvas(ULGUICanvas* Value);
@@ -155,6 +170,8 @@ public:
 		void SetEnableInteractOnBackside(bool Value);
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		void SetFlipVerticalOnGLES(bool Value);
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		void SetUseSimpleCollision(bool Value);
 
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		FIntPoint GetRenderTargetSize()const;
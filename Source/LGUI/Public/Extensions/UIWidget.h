@@ -113,6 +113,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 	void SetManuallyRedraw(bool bUseManualRedraw);
 
+	/** @see bSkipRedrawIfNoChange */
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+	bool GetSkipRedrawIfNoChange() const { return bSkipRedrawIfNoChange; }
+	/** @see bSkipRedrawIfNoChange */
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+	void SetSkipRedrawIfNoChange(bool value) { bSkipRedrawIfNoChange = value; }
+
 	/** Returns the "actual" draw size of the quad in the world */
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 	FVector2D GetCurrentDrawSize() const;
@@ -202,6 +209,24 @@ protected:
 
 	/** Draws the current widget to the render target if possible. */
 	virtual void DrawWidgetToRenderTarget(float DeltaTime);
+	/** Draw widget with time since last draw, shared by tick and scheduled redraw. */
+	void DrawWidgetSinceLastDraw();
+
+	/** Draw widget now, this is called from LGUIManager when redraw is scheduled. */
+	void DrawScheduledRedraw();
+	/**
+	 * Priority for redraw scheduler, bigger value will be drawn first. Consider approximate pixel area on screen and how many frames this widget have been waiting.
+	 * @param InViewLocation view location for world space UI
+	 * @param InViewProjectionScale convert world size at distance 1 to pixel size, if <= 0 then world space UI's distance is not concerned
+	 */
+	float GetScheduledRedrawPriority(const FVector& InViewLocation, float InViewProjectionScale)const;
+public:
+	/** Redraw priority from pixel area on screen and waiting frames, wait longer get higher priority, so small or far widgets will not starve. */
+	static float CalculateScheduledRedrawPriority(float InScreenPixelArea, int32 InWaitFrames) { return InScreenPixelArea * (1 + InWaitFrames); }
+private:
+	/** Frame count that this widget want to redraw but skipped by redraw scheduler */
+	int32 ScheduledRedrawWaitFrames = 0;
+	friend class ULGUIManagerWorldSubsystem;
 
 protected:
 	/** How this widget should deal with timing, pausing, etc. */
@@ -219,6 +244,15 @@ protected:
 	/** Has anyone requested we redraw? */
 	bool bRedrawRequested;
 
+	/**
+	 * Skip redraw if content is not changed since last draw, so static widget will not draw to render target again and again.
+	 * Content is treated as changed when: RequestRenderUpdate is called, widget or draw size changed, UMG animation is playing, or user input happened.
+	 * Change by code (eg. set text of TextBlock) or property binding is not detected, call RequestRenderUpdate after that.
+	 * Slate invalidation is not used here, because FWidgetRenderer paint the window without invalidation root, so it can't tell if anything changed.
+	 */
+	UPROPERTY(EditAnywhere, Category = LGUI, AdvancedDisplay)
+	bool bSkipRedrawIfNoChange = false;
+
 	/**
 	 * The time in between draws, if 0 - we would redraw every frame.  If 1, we would redraw every second.
 	 * This will work with bManuallyRedraw as well.  So you can say, manually redraw, but only redraw at this
@@ -307,6 +341,14 @@ private:
 	/** Set to true after a draw of an empty component.*/
 	bool bRenderCleared;
 	bool bOnWidgetVisibilityChangedRegistered;
+
+	/** content of last draw, for bSkipRedrawIfNoChange */
+	TWeakObjectPtr<UUserWidget> LastDrawnWidget;
+	TWeakPtr<SWidget> LastDrawnSlateWidget;
+	double LastDrawUserInteractionTime = 0;
+	/** pointer hit test this widget since last draw, means pointer input is routed to this widget */
+	bool bHitTestSinceLastDraw = false;
+	bool IsContentChangedSinceLastDraw()const;
 };
 
 /**
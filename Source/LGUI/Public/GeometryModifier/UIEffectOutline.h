@@ -29,6 +29,7 @@ public:
 	virtual void ModifyUIGeometry(UIGeometry& InGeometry
 		, bool InTriangleChanged, bool InUVChanged, bool InColorChanged, bool InVertexPositionChanged
 	)override;
+	virtual bool SupportIncrementalModify()const override { return true; }
 
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		FColor GetOutlineColor()const { return outlineColor; }
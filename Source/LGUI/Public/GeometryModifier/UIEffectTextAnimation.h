@@ -29,6 +29,7 @@ protected:
 		float offset = 0.5f;
 	class UUIText* GetUIText()const;
 	class UUIEffectTextAnimation* GetUIEffectTextAnimation()const;
+	void MarkAnimationDirty();
 private:
 	mutable TWeakObjectPtr<class UUIEffectTextAnimation> UIEffectTextAnimation = nullptr;
 public:
@@ -47,7 +48,7 @@ class LGUI_API UUIEffectTextAnimation_Property : public UObject
 	GENERATED_BODY()
 protected:
 	class UUIText* GetUIText();
-	void MarkUITextPositionDirty();
+	void MarkAnimationDirty();
 public:
 	virtual void Init() {};
 	virtual void Deinit() {};
@@ -85,6 +86,12 @@ public:
 	virtual void ModifyUIGeometry(UIGeometry& InGeometry
 		, bool InTriangleChanged, bool InUVChanged, bool InColorChanged, bool InVertexPositionChanged
 	)override;
+	/** Animation only write vertex position and color, and is applied on cached text geometry, so text layout is not calculated again when animate */
+	virtual bool SupportIncrementalModify()const override { return true; }
+	virtual void GetIncrementalModifyRequiredChannel(bool& InOutTriangleChanged, bool& InOutVertexPositionChanged, bool& InOutUVChanged, bool& InOutColorChanged)const override;
+	virtual void GetIncrementalModifyChangedChannel(bool& InOutTriangleChanged, bool& InOutVertexPositionChanged, bool& InOutUVChanged, bool& InOutColorChanged)const override;
+	/** Apply selector and properties again, without update UIText's geometry */
+	void MarkAnimationDirty();
 	class UUIText* GetUIText();
 
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
@@ -131,6 +131,17 @@ public:
 		OutUV = true;
 		OutColor = true;
 	}
+	/**
+	 * Is this modifier support incremental modify? If true:
+	 *		Only changed channel is passed in as true, data of other channel is still there from last modify, so only changed channel need to be written.
+	 *		Vertex and triangle count after modify must only be decided by input count and this modifier's properties, and should use AddUninitialized instead of AddDefaulted to keep old data.
+	 * If false, all input data is refreshed and the channels from ModifierWillChangeVertexData are passed in as changed.
+	 */
+	virtual bool SupportIncrementalModify()const { return false; }
+	/** For incremental modify, get channels that need to be copied from input before modify, from channels that changed before this modifier. Default is only changed channel. */
+	virtual void GetIncrementalModifyRequiredChannel(bool& InOutTriangleChanged, bool& InOutVertexPositionChanged, bool& InOutUVChanged, bool& InOutColorChanged)const {}
+	/** For incremental modify, get channels that will change after this modifier, from channels that changed before this modifier. Default is each channel only affect itself. */
+	virtual void GetIncrementalModifyChangedChannel(bool& InOutTriangleChanged, bool& InOutVertexPositionChanged, bool& InOutUVChanged, bool& InOutColorChanged)const {}
 protected:
 	UPROPERTY(Transient) TObjectPtr<ULGUIGeometryModifierHelper> GeometryModifierHelper = nullptr;
 	/**
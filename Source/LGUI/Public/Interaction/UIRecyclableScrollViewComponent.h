@@ -57,6 +57,20 @@ public:
 	// Called after calling "SetCell" function for all children
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "LGUI-RecyclableScrollView")
 		void AfterSetCell();
+	/**
+	 * Only used when VariableSizeCell is enabled.
+	 * @param	Index			Cell's data index.
+	 * @return	Cell size along scroll direction (width for horizontal, height for vertical). Return value <= 0 means use cell template's size.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		float GetItemSize(int Index);
+	/**
+	 * Only used when VariableSizeCell is enabled.
+	 * @param	Index			Cell's data index.
+	 * @return	Which template to create the cell. 0 means CellTemplate (or CellTemplatePrefab), 1 means the first one in ExtraCellTemplates, and so on.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		int GetItemTemplateIndex(int Index);
 };
 
 USTRUCT(BlueprintType)
@@ -68,6 +82,46 @@ public:
 		TObjectPtr<UActorComponent> CellComponent = nullptr;
 	UPROPERTY(EditAnywhere, Category = "LGUI")
 		TObjectPtr<UUIItem> UIItem = nullptr;
+	/** Which template this cell is created from. Always 0 if not use VariableSizeCell. */
+	UPROPERTY(EditAnywhere, Category = "LGUI")
+		int TemplateIndex = 0;
+};
+
+/** Recycled cells of a template, for VariableSizeCell mode. */
+USTRUCT()
+struct FUIRecyclableScrollViewCellPool
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(VisibleAnywhere, Category = "LGUI")
+		TArray<FUIRecyclableScrollViewCellContainer> CellList;
+};
+
+/**
+ * Binary indexed tree (Fenwick tree) of cell size along scroll direction.
+ * Convert between data index and content offset in O(log n), so a list with huge amount of variable size items can still find visible range quickly.
+ */
+struct LGUI_API FUIRecyclableScrollViewSizeTree
+{
+public:
+	/** Rebuild the whole tree in O(n). */
+	void Reset(const TArray<float>& InSizeArray, float InSpace);
+	/**
+	 * Rebuild tree nodes after item insert/remove at InStartIndex, nodes only cover items before InStartIndex are kept.
+	 * Cost is O(n - InStartIndex + log(n)^2), so change near the end is cheap.
+	 */
+	void ResetFrom(const TArray<float>& InSizeArray, float InSpace, int InStartIndex);
+	/** Add Delta to item's size. */
+	void Add(int Index, double Delta);
+	/** Sum of item size (include space) in range [0, Index). */
+	double GetPrefixSum(int Index)const;
+	double GetTotal()const { return GetPrefixSum(Num()); }
+	/** Find the item which contains the offset, result is clamped in valid range. */
+	int FindIndexByOffset(double Offset)const;
+	int Num()const { return FMath::Max(Tree.Num() - 1, 0); }
+private:
+	/** 1-based tree array */
+	TArray<double> Tree;
 };
 
 UENUM(BlueprintType)
@@ -130,6 +184,22 @@ protected:
 	/** Space between cells */
 	UPROPERTY(EditAnywhere, Category = "LGUI-RecyclableScrollView")
 		FVector2D Space = FVector2D::ZeroVector;
+	/**
+	 * Allow every cell to have it's own size and template, use DataSource's GetItemSize and GetItemTemplateIndex to tell the size and template for each data item.
+	 * Only cells inside visible area (plus CellCacheMargin) are alive, others are recycled to pool of their template.
+	 * Only valid if Rows and Columns equals 1, and not InfiniteLoop.
+	 */
+	UPROPERTY(EditAnywhere, Category = "LGUI-RecyclableScrollView")
+		bool bVariableSizeCell = false;
+	/**
+	 * Additional cell templates for VariableSizeCell. GetItemTemplateIndex return 1 means the first one in this array, and so on.
+	 * Each template must have a ActorComponent which implement UIRecyclableScrollViewCell interface.
+	 */
+	UPROPERTY(EditAnywhere, Category = "LGUI-RecyclableScrollView", meta = (EditCondition = "bVariableSizeCell"))
+		TArray<TObjectPtr<AUIBaseActor>> ExtraCellTemplates;
+	/** For VariableSizeCell, cells within this distance outside visible area will be kept alive, so small scroll back and forth will not cause SetCell. */
+	UPROPERTY(EditAnywhere, Category = "LGUI-RecyclableScrollView", meta = (EditCondition = "bVariableSizeCell", ClampMin = "0.0"))
+		float CellCacheMargin = 0;
 public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
 		TScriptInterface<IUIRecyclableScrollViewDataSource> GetDataSource()const { return DataSource; }
@@ -158,6 +228,12 @@ public:
 		AUIBaseActor* GetCellTemplate()const { return CellTemplate; }
 	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
 		class ULGUIPrefab* GetCellTemplatePrefab()const { return CellTemplatePrefab; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		bool GetVariableSizeCell()const { return bVariableSizeCell; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		const TArray<AUIBaseActor*>& GetExtraCellTemplates()const { return ExtraCellTemplates; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		float GetCellCacheMargin()const { return CellCacheMargin; }
 
 	/**
 	 * Delete all created cell objects.
@@ -193,6 +269,17 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
 		void SetCellTemplatePrefab(class ULGUIPrefab* value);
+	/** Set VariableSizeCell, will automatically recreate cells. */
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		void SetVariableSizeCell(bool value);
+	/**
+	 * Set additional cell templates for VariableSizeCell.
+	 * This function only set the parameter. If you want to refresh the display UI list, just call RecreateList.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		void SetExtraCellTemplates(const TArray<AUIBaseActor*>& value);
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		void SetCellCacheMargin(float value);
 
 	/** Recreate cell list. */
 	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
@@ -203,6 +290,29 @@ public:
 	/** Update list cell's data, this will not change current layout, only set data. */
 	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
 		void UpdateCellData();
+	/**
+	 * Tell the scrollview that new data items are inserted into DataSource, DataSource's GetItemCount should already include the new items.
+	 * For VariableSizeCell only new items' size is queried and existing cells are reused, otherwise will recreate the list.
+	 * @param Index		Data index of the first inserted item.
+	 * @param Count		Inserted item count.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		void InsertItems(int Index, int Count = 1);
+	/**
+	 * Tell the scrollview that data items are removed from DataSource, DataSource's GetItemCount should already exclude the removed items.
+	 * For VariableSizeCell existing cells are reused, otherwise will recreate the list.
+	 * @param Index		Data index of the first removed item.
+	 * @param Count		Removed item count.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		void RemoveItems(int Index, int Count = 1);
+	/**
+	 * For VariableSizeCell, query size and template of the data item again (call DataSource's GetItemSize and GetItemTemplateIndex), and update layout.
+	 * @param Index		Data index of the first changed item.
+	 * @param Count		Changed item count.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI-RecyclableScrollView")
+		void UpdateItemSize(int Index, int Count = 1);
 	/**
 	 * RecyclableScrollView will create a cache list to store cell object, use data-index to get the cell that represent the data.
 	 * @param Index		data index
@@ -223,6 +333,9 @@ public:
 private:
 	UPROPERTY(VisibleAnywhere, Transient, Category = "LGUI-RecyclableScrollView", AdvancedDisplay)
 		TArray<FUIRecyclableScrollViewCellContainer> CacheCellList;
+	/** For VariableSizeCell, recycled cells of each template */
+	UPROPERTY(VisibleAnywhere, Transient, Category = "LGUI-RecyclableScrollView", AdvancedDisplay)
+		TArray<FUIRecyclableScrollViewCellPool> CellPoolList;
 
 	void InitializeOnDataSource();
 	EUIRecyclableScrollViewCellTemplateType WorkingCellTemplateType = EUIRecyclableScrollViewCellTemplateType::Actor;
@@ -241,4 +354,31 @@ private:
 	int GetValidCellDataIndex(int InMinCellDataIndex)const;
 	void IncreaseMinMaxCellIndexInCacheCellList(int Count);
 	void DecreaseMinMaxCellIndexInCacheCellList(int Count);
+	void ScrollToContentPosition(float InTargetContentPos, bool InEaseAnimation, float InAnimationDuration);
+
+#pragma region VariableSizeCell
+	bool bVariableSizeCellWorking = false;
+	bool CanUseVariableSizeCell()const;
+	void InitializeVariableSizeCells();
+	/** Destroy all cells and pools */
+	void ClearVariableSizeCells();
+	/** Query size and template for data items in range [Index, Index + Count) */
+	void QueryVariableSizeCellData(int Index, int Count);
+	void UpdateVariableSizeContentSize();
+	/**
+	 * Find data range inside visible area, recycle cells out of range and create or reuse cells for new data.
+	 * @param InForceSetCell	true- recycle and set all cells, use this when data index or size of alive cells changed.
+	 */
+	void UpdateVariableSizeCells(bool InForceSetCell);
+	FUIRecyclableScrollViewCellContainer AcquireVariableSizeCell(int InTemplateIndex);
+	void ReleaseVariableSizeCell(const FUIRecyclableScrollViewCellContainer& InCell);
+	/** Working templates for VariableSizeCell, 0 is WorkingCellTemplate, others are ExtraCellTemplates */
+	TArray<TWeakObjectPtr<AUIBaseActor>> WorkingCellTemplateList;
+	/** Cell size along scroll direction, not include space */
+	TArray<float> VariableCellSizeArray;
+	TArray<int> VariableCellTemplateIndexArray;
+	FUIRecyclableScrollViewSizeTree VariableCellSizeTree;
+	/** Data index of the first cell in CacheCellList. For VariableSizeCell the CacheCellList is sorted by data index. */
+	int VariableCellStartDataIndex = 0;
+#pragma endregion
 };
@@ -122,6 +122,19 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, Category = LGUI, meta = (ComponentClass = "ActorComponent", DeterminesOutputType = "ComponentClass", AutoCreateRefTerm = "InExcludeNode"))
 		static UActorComponent* GetComponentInChildren(AActor* InActor, TSubclassOf<UActorComponent> ComponentClass, bool IncludeSelf, const TSet<AActor*>& InExcludeNode);
+	/**
+	 * Build a component index for InRootActor's hierarchy, then GetComponentsInChildren/GetComponentInChildren on this hierarchy become lookup instead of walking the tree.
+	 * The index is updated when UI actor attach/detach, and when UIItem or LGUILifeCycleBehaviour register/unregister.
+	 * Only UIItem and LGUILifeCycleBehaviour classes are indexed, query for other class, or for hierarchy that have non-UI child actor, still walk the tree.
+	 * Result is in hierarchy order same as tree walk (except different classes in a same actor), GetComponentInChildren return the nearest one.
+	 */
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		static void EnableHierarchyComponentIndex(AActor* InRootActor);
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		static void DisableHierarchyComponentIndex(AActor* InRootActor);
+	/** Rebuild component index of InRootActor's hierarchy. */
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		static void RefreshHierarchyComponentIndex(AActor* InRootActor);
 public:
 #pragma region EventDelegate
 	UFUNCTION(BlueprintCallable, Category = LGUI)static void LGUIEventDelegateExecuteEmpty(const FLGUIEventDelegate& InEvent) { InEvent.FireEvent(); }
@@ -88,9 +88,18 @@ protected:
 	void OnEditorViewportIndexAndKeyChange();
 	void OnPreviewSetting_EditorPreviewViewportIndexChange();
 #endif
-	void OnViewportParameterChanged();
-	void CheckAndApplyViewportParameter();
+	/**
+	 * Calculate and apply canvas size and scale.
+	 * @param InForceApply apply even if result is identical to current value, otherwise identical result is skipped so the whole hierarchy is not marked dirty.
+	 */
+	void OnViewportParameterChanged(bool InForceApply = false);
+	void CheckAndApplyViewportParameter(bool InForceApply = false);
+	void CalculateCanvasSizeAndScale(float& OutWidth, float& OutHeight, float& OutScale);
 	void OnViewportResized(FViewport*, uint32);
+	/** Viewport resize is recorded in LGUIManager and applied at it's next update, so multiple resize events in a frame only apply once. */
+	void ApplyPendingViewportResize();
+	friend class ULGUIManagerWorldSubsystem;
+	bool bIsViewportResizePending = false;
 	FDelegateHandle _ViewportResizeDelegateHandle;
 
 	friend class FUICanvasScalerCustomization;
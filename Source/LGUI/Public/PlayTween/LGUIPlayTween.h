@@ -46,12 +46,31 @@ protected:
 		TObjectPtr<ULTweener> tweener;
 	FSimpleMulticastDelegate onComplete_Delegate;
 	FLGUIMulticastInt32Delegate onCycleComplete_Delegate;
+	/** Slot index in FLGUIPlayTweenDriver, reused when play again. */
+	int32 driverSlotIndex = INDEX_NONE;
+	friend struct FLGUIPlayTweenDriver;
+	friend struct FLGUIPlayTweenDriverSlot;
+	void StartWithLTween();
+	void OnTweenStart();
+	void OnTweenUpdateProgress(float progress);
+	void OnTweenCycleComplete(int32 cycleCompleteCount);
+	void OnTweenComplete();
 public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void Start();
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void Stop();
+	/**
+	 * Play backward from current position, or from end to start if not playing.
+	 * Always use shared driver (in game world), and reuse the playing slot.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void Reverse();
+	/** Is this tween playing? */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		bool IsPlaying()const;
+	/** Return nullptr if this tween is played by shared driver (lgui.PlayTween.SharedDriver), which don't create tweener. */
+	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (DeprecatedFunction, DeprecationMessage = "Tweener is not created when play with shared driver. Use IsPlaying/Stop/Reverse instead."))
 		ULTweener* GetTweener()const { return tweener; }
 	FDelegateHandle RegisterOnComplete(const FSimpleDelegate& InDelegate);
 	FDelegateHandle RegisterOnComplete(const TFunction<void()>& InFunction);
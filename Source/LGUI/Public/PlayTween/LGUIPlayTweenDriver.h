@@ -0,0 +1,75 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "LTweener.h"
+
+class ULGUIPlayTween;
+class ULGUIPlayTweenSequenceComponent;
+class UCurveFloat;
+
+/** Play state of a ULGUIPlayTween, compiled from the tween's properties when start. */
+struct FLGUIPlayTweenDriverSlot
+{
+	TWeakObjectPtr<ULGUIPlayTween> PlayTween;
+	/** Sequence which play this tween, will be notified when the tween complete so it can play next tween in this slot. */
+	TWeakObjectPtr<ULGUIPlayTweenSequenceComponent> Sequence;
+	TWeakObjectPtr<UCurveFloat> EaseCurve;
+	/** nullptr means use EaseCurve */
+	ULTweener::FEaseFunction EaseFunction = nullptr;
+	float Duration = 0.0f;
+	float Delay = 0.0f;
+	/** total elapse time, include delay */
+	float ElapseTime = 0.0f;
+	/** value when cycle start, increase every cycle if loop type is Incremental */
+	float StartValue = 0.0f;
+	ELTweenLoop LoopType = ELTweenLoop::Once;
+	int32 MaxLoopCount = 0;
+	int32 LoopCycleCount = 0;
+	/** increase when this slot is played or stopped, so we can tell if the slot is changed inside tween's callback */
+	uint32 Serial = 0;
+	bool bIsActive = false;
+	bool bStarted = false;
+	bool bReverse = false;
+	bool bAffectByGamePause = false;
+	bool bAffectByTimeDilation = false;
+
+	void Compile(ULGUIPlayTween* InPlayTween);
+	float Evaluate(float InTime)const;
+};
+
+/**
+ * Shared driver for ULGUIPlayTween, so playing a tween don't need to create tweener object.
+ * Playing tweens are stored as slots in one array and updated by LGUIManagerWorldSubsystem, slots are reused when play again.
+ */
+struct LGUI_API FLGUIPlayTweenDriver
+{
+public:
+	/** @return nullptr if not in game world. */
+	static FLGUIPlayTweenDriver* Get(const UObject* InWorldContextObject);
+	/** Should tween start with shared driver, controlled by console variable "lgui.PlayTween.SharedDriver". */
+	static bool IsEnabled();
+
+	void Play(ULGUIPlayTween* InPlayTween);
+	/**
+	 * Play tween for sequence. Sequence play tweens one after one in the same slot.
+	 * @param InSlotIndex Slot of sequence's previous tween, INDEX_NONE to use a new slot.
+	 * @return Slot index.
+	 */
+	int32 PlayInSequence(ULGUIPlayTween* InPlayTween, ULGUIPlayTweenSequenceComponent* InSequence, int32 InSlotIndex);
+	void Stop(ULGUIPlayTween* InPlayTween);
+	/** Reverse playing direction in the same slot and keep current value. If not playing, then play from end to start. */
+	void Reverse(ULGUIPlayTween* InPlayTween);
+	bool IsPlaying(const ULGUIPlayTween* InPlayTween)const;
+
+	void Update(UWorld* InWorld);
+private:
+	TArray<FLGUIPlayTweenDriverSlot> Slots;
+	TArray<int32> FreeSlots;
+
+	int32 FindSlot(const ULGUIPlayTween* InPlayTween)const;
+	int32 AcquireSlot(ULGUIPlayTween* InPlayTween, int32 InPreferSlotIndex);
+	void ReleaseSlot(int32 InSlotIndex);
+	/** @return false if the tween is complete */
+	bool UpdateSlot(int32 InSlotIndex, FLGUIPlayTweenDriverSlot& InOutSlot, bool InIsGamePaused, float InDeltaTime, float InUnscaledDeltaTime);
+};
@@ -28,6 +28,12 @@ protected:
 
 	bool isPlaying = false;
 	int currentTweenPlayIndex = 0;
+	/** Current tween is played by FLGUIPlayTweenDriver, so no need to register tween's complete event. */
+	bool bIsPlayingWithDriver = false;
+	/** Driver slot of current tween, next tween will reuse this slot. */
+	int32 driverSlotIndex = INDEX_NONE;
+	friend struct FLGUIPlayTweenDriver;
+	void PlayTweenAtCurrentIndex();
 	void OnTweenComplete();
 	FDelegateHandle onCompleteDelegateHandle;
 	FSimpleMulticastDelegate onComplete_Delegate;
@@ -92,4 +92,11 @@ protected:
 
 	UPROPERTY(transient)
 		TObjectPtr<ULGUIPrefabSequencePlayer> SequencePlayer;
+private:
+	/** Name to index in SequenceArray, build when needed. Cached index is verified when use, so rename or array change will rebuild it. */
+	mutable TMap<FString, int32> SequenceDisplayNameToIndex;
+	mutable TMap<FName, int32> SequenceNameToIndex;
+	void RebuildSequenceNameCache()const;
+	int32 FindSequenceIndexByDisplayName(const FString& InName)const;
+	int32 FindSequenceIndexByName(FName InName)const;
 };
@@ -19,8 +19,12 @@ public:
 
 #if WITH_EDITOR
 	static FString GetActorPathRelativeToContextActor(AActor* InContextActor, AActor* InActor);
-	static AActor* GetActorFromContextActorByRelativePath(AActor* InContextActor, const FString& InPath);
-	bool FixObjectReferenceFromEditorHelpers(AActor* InContextActor);
+	/**
+	 * Find actor by path relative to context actor.
+	 * @param InOutPathCache Optional, path to actor cache, parent path is cached too, so references under same parent can skip searching in parent levels.
+	 */
+	static AActor* GetActorFromContextActorByRelativePath(AActor* InContextActor, const FString& InPath, TMap<FString, AActor*>* InOutPathCache = nullptr);
+	bool FixObjectReferenceFromEditorHelpers(AActor* InContextActor, TMap<FString, AActor*>* InOutPathCache = nullptr);
 	bool CanFixObjectReferenceFromEditorHelpers()const;
 	bool IsObjectReferenceGood(AActor* InContextActor)const;
 	bool IsEditorHelpersGood(AActor* InContextActor)const;
@@ -128,11 +132,28 @@ struct FLGUIPrefabSequenceObjectReferenceMap
 	//return true if anything changed
 	bool FixEditorHelpers(AActor* InContextActor);
 #endif
+	/** BindingIds may change by load or undo, so need to rebuild BindingIdToIndex. */
+	void PostSerialize(const FArchive& Ar);
 private:
+	/** Find index in BindingIds, use BindingIdToIndex. */
+	int32 FindBindingIndex(const FGuid& ObjectId)const;
 	
 	UPROPERTY()
 	TArray<FGuid> BindingIds;
 
 	UPROPERTY()
 	TArray<FLGUIPrefabSequenceObjectReferences> References;
+
+	/** BindingIds to index, the only place to find binding index. Build when needed, keep in sync when binding add or remove, rebuild after BindingIds serialized. */
+	mutable TMap<FGuid, int32> BindingIdToIndex;
+	mutable bool bBindingIdToIndexValid = false;
+};
+
+template<>
+struct TStructOpsTypeTraits<FLGUIPrefabSequenceObjectReferenceMap> : public TStructOpsTypeTraitsBase2<FLGUIPrefabSequenceObjectReferenceMap>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
 };
@@ -12,11 +12,13 @@
 Modified by lexliu:
 	Support ue4's native classes, remove std stuff
 	Add function to expend bin pack size, so I can add more rects and keep origin rects
+	Keep free rectangles sorted by area so search can skip rectangles that are too small, and only prune new free rectangles after place
 
 	This version is also public domain - do whatever you want with it.
 */
 
 #include "MaxRectsBinPack.h"
+#include "Algo/BinarySearch.h"
 
 namespace rbp {
 
@@ -62,6 +64,7 @@ namespace rbp {
 
 		freeRectangles.Reset();
 		freeRectangles.Add(n);
+		newFreeRectangles.Reset();
 	}
 
 	void MaxRectsBinPack::ExpendSize(int newWidth, int newHeight)
@@ -151,6 +154,9 @@ namespace rbp {
 
 		binWidth = newWidth;
 		binHeight = newHeight;
+
+		//rects are modified and added without care of containment and order
+		PruneFreeListFull();
 	}
 	void MaxRectsBinPack::PrepareExpendSizeForText(int newWidth, int newHeight, TArray<Rect>& outFreeRectangles, int cellSize, bool resetFreeAndUsedRects)
 	{
@@ -242,20 +248,7 @@ namespace rbp {
 		if (newNode.height == 0)
 			return newNode;
 
-		int numRectanglesToProcess = freeRectangles.Num();
-		for (int i = 0; i < numRectanglesToProcess; ++i)
-		{
-			if (SplitFreeNode(freeRectangles[i], newNode))
-			{
-				freeRectangles.RemoveAt(i);
-				--i;
-				--numRectanglesToProcess;
-			}
-		}
-
-		PruneFreeList();
-
-		usedRectangles.Add(newNode);
+		PlaceRect(newNode);
 		return newNode;
 	}
 
@@ -296,16 +289,20 @@ namespace rbp {
 
 	void MaxRectsBinPack::PlaceRect(const Rect &node)
 	{
-		int numRectanglesToProcess = freeRectangles.Num();
-		for (int i = 0; i < numRectanglesToProcess; ++i)
+		//remove splitted free nodes and keep the order, so the list is still sorted
+		int numRectanglesToKeep = 0;
+		for (int i = 0; i < freeRectangles.Num(); ++i)
 		{
-			if (SplitFreeNode(freeRectangles[i], node))
+			if (!SplitFreeNode(freeRectangles[i], node))
 			{
-				freeRectangles.RemoveAt(i);
-				--i;
-				--numRectanglesToProcess;
+				if (numRectanglesToKeep != i)
+				{
+					freeRectangles[numRectanglesToKeep] = freeRectangles[i];
+				}
+				++numRectanglesToKeep;
 			}
 		}
+		freeRectangles.SetNum(numRectanglesToKeep, false);
 
 		PruneFreeList();
 
@@ -357,7 +354,7 @@ namespace rbp {
 		bestY = MAXINT32;
 		bestX = MAXINT32;
 
-		for (int i = 0; i < freeRectangles.Num(); ++i)
+		for (int i = FindFirstFreeRectangleFitArea(width * height); i < freeRectangles.Num(); ++i)
 		{
 			// Try to place the rectangle in upright (non-flipped) orientation.
 			if (freeRectangles[i].width >= width && freeRectangles[i].height >= height)
@@ -399,7 +396,7 @@ namespace rbp {
 		bestShortSideFit = MAXINT32;
 		bestLongSideFit = MAXINT32;
 
-		for (int i = 0; i < freeRectangles.Num(); ++i)
+		for (int i = FindFirstFreeRectangleFitArea(width * height); i < freeRectangles.Num(); ++i)
 		{
 			// Try to place the rectangle in upright (non-flipped) orientation.
 			if (freeRectangles[i].width >= width && freeRectangles[i].height >= height)
@@ -450,7 +447,7 @@ namespace rbp {
 		bestShortSideFit = MAXINT32;
 		bestLongSideFit = MAXINT32;
 
-		for (int i = 0; i < freeRectangles.Num(); ++i)
+		for (int i = FindFirstFreeRectangleFitArea(width * height); i < freeRectangles.Num(); ++i)
 		{
 			// Try to place the rectangle in upright (non-flipped) orientation.
 			if (freeRectangles[i].width >= width && freeRectangles[i].height >= height)
@@ -501,9 +498,11 @@ namespace rbp {
 		bestAreaFit = MAXINT32;
 		bestShortSideFit = MAXINT32;
 
-		for (int i = 0; i < freeRectangles.Num(); ++i)
+		for (int i = FindFirstFreeRectangleFitArea(width * height); i < freeRectangles.Num(); ++i)
 		{
 			int areaFit = freeRectangles[i].width * freeRectangles[i].height - width * height;
+			if (areaFit > bestAreaFit)//free rectangles are sorted by area, rest ones can only be larger
+				break;
 
 			// Try to place the rectangle in upright (non-flipped) orientation.
 			if (freeRectangles[i].width >= width && freeRectangles[i].height >= height)
@@ -577,7 +576,7 @@ namespace rbp {
 
 		bestContactScore = -1;
 
-		for (int i = 0; i < freeRectangles.Num(); ++i)
+		for (int i = FindFirstFreeRectangleFitArea(width * height); i < freeRectangles.Num(); ++i)
 		{
 			// Try to place the rectangle in upright (non-flipped) orientation.
 			if (freeRectangles[i].width >= width && freeRectangles[i].height >= height)
@@ -608,13 +607,16 @@ namespace rbp {
 		return bestNode;
 	}
 
-	bool MaxRectsBinPack::SplitFreeNode(Rect freeNode, const Rect &usedNode)
+	bool MaxRectsBinPack::SplitFreeNode(const Rect &freeNode, const Rect &usedNode)
 	{
 		// Test with SAT if the rectangles even intersect.
 		if (usedNode.x >= freeNode.x + freeNode.width || usedNode.x + usedNode.width <= freeNode.x ||
 			usedNode.y >= freeNode.y + freeNode.height || usedNode.y + usedNode.height <= freeNode.y)
 			return false;
 
+		// We add up to four new free rectangles below. None of these four can be contained in another one, so only test them with rectangles from previous splits.
+		newFreeRectanglesLastSize = newFreeRectangles.Num();
+
 		if (usedNode.x < freeNode.x + freeNode.width && usedNode.x + usedNode.width > freeNode.x)
 		{
 			// New node at the top side of the used node.
@@ -622,7 +624,7 @@ namespace rbp {
 			{
 				Rect newNode = freeNode;
 				newNode.height = usedNode.y - newNode.y;
-				freeRectangles.Add(newNode);
+				InsertNewFreeRectangle(newNode);
 			}
 
 			// New node at the bottom side of the used node.
@@ -631,7 +633,7 @@ namespace rbp {
 				Rect newNode = freeNode;
 				newNode.y = usedNode.y + usedNode.height;
 				newNode.height = freeNode.y + freeNode.height - (usedNode.y + usedNode.height);
-				freeRectangles.Add(newNode);
+				InsertNewFreeRectangle(newNode);
 			}
 		}
 
@@ -642,7 +644,7 @@ namespace rbp {
 			{
 				Rect newNode = freeNode;
 				newNode.width = usedNode.x - newNode.x;
-				freeRectangles.Add(newNode);
+				InsertNewFreeRectangle(newNode);
 			}
 
 			// New node at the right side of the used node.
@@ -651,34 +653,80 @@ namespace rbp {
 				Rect newNode = freeNode;
 				newNode.x = usedNode.x + usedNode.width;
 				newNode.width = freeNode.x + freeNode.width - (usedNode.x + usedNode.width);
-				freeRectangles.Add(newNode);
+				InsertNewFreeRectangle(newNode);
 			}
 		}
 
 		return true;
 	}
 
+	void MaxRectsBinPack::InsertNewFreeRectangle(const Rect &newFreeRect)
+	{
+		for (int i = 0; i < newFreeRectanglesLastSize;)
+		{
+			// This new free rectangle is already accounted for?
+			if (IsContainedIn(newFreeRect, newFreeRectangles[i]))
+				return;
+
+			// Does this new free rectangle obsolete a previous new free rectangle?
+			if (IsContainedIn(newFreeRectangles[i], newFreeRect))
+			{
+				// Remove i'th new free rectangle, but keep rectangles added by current SplitFreeNode after newFreeRectanglesLastSize.
+				newFreeRectangles[i] = newFreeRectangles[--newFreeRectanglesLastSize];
+				newFreeRectangles[newFreeRectanglesLastSize] = newFreeRectangles.Last();
+				newFreeRectangles.Pop(false);
+			}
+			else
+				++i;
+		}
+		newFreeRectangles.Add(newFreeRect);
+	}
+
+	int MaxRectsBinPack::FindFirstFreeRectangleFitArea(int area) const
+	{
+		return Algo::LowerBoundBy(freeRectangles, area, &MaxRectsBinPack::RectArea);
+	}
+
 	void MaxRectsBinPack::PruneFreeList()
 	{
-		/*
-		///  Would be nice to do something like this, to avoid a Theta(n^2) loop through each pair.
-		///  But unfortunately it doesn't quite cut it, since we also want to detect containment.
-		///  Perhaps there's another way to do this faster than Theta(n^2).
-
-		if (freeRectangles.size() > 0)
-			clb::sort::QuickSort(&freeRectangles[0], freeRectangles.size(), NodeSortCmp);
-
-		for(size_t i = 0; i < freeRectangles.size()-1; ++i)
-			if (freeRectangles[i].x == freeRectangles[i+1].x &&
-				freeRectangles[i].y == freeRectangles[i+1].y &&
-				freeRectangles[i].width == freeRectangles[i+1].width &&
-				freeRectangles[i].height == freeRectangles[i+1].height)
+		if (newFreeRectangles.Num() == 0)
+			return;
+		newFreeRectangles.Sort([](const Rect& A, const Rect& B) { return RectArea(A) < RectArea(B); });
+
+		// Test new free rectangles against old ones. Old free rectangles can never be contained in a new one, because new ones are splitted from removed old ones.
+		// A rectangle can only contain another one which is not larger than it, so skip old rectangles smaller than the smallest new one.
+		for (int i = FindFirstFreeRectangleFitArea(RectArea(newFreeRectangles[0])); i < freeRectangles.Num(); ++i)
+		{
+			for (int j = 0; j < newFreeRectangles.Num();)
 			{
-				freeRectangles.erase(freeRectangles.begin() + i);
-				--i;
+				if (IsContainedIn(newFreeRectangles[j], freeRectangles[i]))
+				{
+					newFreeRectangles.RemoveAt(j, 1, false);
+				}
+				else
+				{
+					++j;
+				}
 			}
-		*/
+		}
 
+		// Merge sorted new free rectangles into sorted old ones, from back to front.
+		int oldIndex = freeRectangles.Num() - 1;
+		int newIndex = newFreeRectangles.Num() - 1;
+		freeRectangles.AddUninitialized(newFreeRectangles.Num());
+		for (int writeIndex = freeRectangles.Num() - 1; newIndex >= 0; --writeIndex)
+		{
+			if (oldIndex >= 0 && RectArea(freeRectangles[oldIndex]) > RectArea(newFreeRectangles[newIndex]))
+				freeRectangles[writeIndex] = freeRectangles[oldIndex--];
+			else
+				freeRectangles[writeIndex] = newFreeRectangles[newIndex--];
+		}
+		newFreeRectangles.Reset();
+		newFreeRectanglesLastSize = 0;
+	}
+
+	void MaxRectsBinPack::PruneFreeListFull()
+	{
 		/// Go through each pair and remove any rectangle that is redundant.
 		for (int i = 0; i < freeRectangles.Num(); ++i)
 			for (int j = i + 1; j < freeRectangles.Num(); ++j)
@@ -695,6 +743,8 @@ namespace rbp {
 					--j;
 				}
 			}
+
+		freeRectangles.StableSort([](const Rect& A, const Rect& B) { return RectArea(A) < RectArea(B); });
 	}
 
 }
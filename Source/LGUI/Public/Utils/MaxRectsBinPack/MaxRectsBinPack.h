@@ -12,6 +12,7 @@
 Modified by lexliu:
 	Support ue4's native classes, remove std stuff
 	Add function to expend bin pack size, so I can add more rects and keep origin rects
+	Keep free rectangles sorted by area so search can skip rectangles that are too small, and only prune new free rectangles after place
 
 	This version is also public domain - do whatever you want with it.
 */
@@ -91,7 +92,12 @@ namespace rbp {
 		bool binAllowFlip = false;
 
 		TArray<Rect> usedRectangles;
+		/** Sorted by area from small to large. */
 		TArray<Rect> freeRectangles;
+		/** Free rectangles created by SplitFreeNode in current PlaceRect, will merge into freeRectangles after prune. */
+		TArray<Rect> newFreeRectangles;
+		/** newFreeRectangles before this index are created by previous SplitFreeNode, only need to check containment with these. */
+		int newFreeRectanglesLastSize = 0;
 
 		/// Computes the placement score for placing the given rectangle with the given method.
 		/// @param score1 [out] The primary placement score will be outputted here.
@@ -112,11 +118,22 @@ namespace rbp {
 		Rect FindPositionForNewNodeContactPoint(int width, int height, int &contactScore) const;
 
 		/// @return True if the free node was split.
-		bool SplitFreeNode(Rect freeNode, const Rect &usedNode);
+		bool SplitFreeNode(const Rect &freeNode, const Rect &usedNode);
 
-		/// Goes through the free rectangle list and removes any redundant entries.
+		/// Add to newFreeRectangles if not contained by other new free rectangles.
+		void InsertNewFreeRectangle(const Rect &newFreeRect);
+
+		/// Removes new free rectangles which are contained by old ones, then merge new free rectangles into the sorted free rectangle list.
 		void PruneFreeList();
 
+		/// Goes through the whole free rectangle list and removes any redundant entries, then sort it. Only need this if free rectangles are modified from outside of PlaceRect.
+		void PruneFreeListFull();
+
+		/// @return Index of the first free rectangle whose area is not smaller than the given area. Rectangles before this can never fit.
+		int FindFirstFreeRectangleFitArea(int area) const;
+
+		static int RectArea(const Rect &rect) { return rect.width * rect.height; }
+
 		/// Returns true if a is contained in b.
 		static bool IsContainedIn(const Rect &a, const Rect &b)
 		{
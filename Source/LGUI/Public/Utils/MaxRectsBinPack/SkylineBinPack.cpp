@@ -0,0 +1,223 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+/** @file SkylineBinPack.cpp
+	@author Jukka Jylänki
+
+	@brief Implements different bin packer algorithms that use the SKYLINE data structure.
+
+	This work is released to Public Domain, do whatever you want with it.
+*/
+
+/*
+Modified by lexliu:
+	Support ue4's native classes, remove std stuff
+	Remove waste map and rotation, add bin offset so it can pack inside a cell of larger texture
+
+	This version is also public domain - do whatever you want with it.
+*/
+
+#include "SkylineBinPack.h"
+
+namespace rbp {
+
+	SkylineBinPack::SkylineBinPack()
+	{
+	}
+
+	SkylineBinPack::SkylineBinPack(int width, int height)
+	{
+		Init(0, 0, width, height);
+	}
+
+	void SkylineBinPack::Init(int width, int height)
+	{
+		Init(0, 0, width, height);
+	}
+
+	void SkylineBinPack::Init(int x, int y, int width, int height)
+	{
+		binX = x;
+		binY = y;
+		binWidth = width;
+		binHeight = height;
+
+		usedSurfaceArea = 0;
+		skyLine.Reset();
+		SkylineNode node;
+		node.x = 0;
+		node.y = 0;
+		node.width = binWidth;
+		skyLine.Add(node);
+	}
+
+	Rect SkylineBinPack::Insert(int width, int height, LevelChoiceHeuristic method)
+	{
+		int bestHeight;
+		int bestScore2;
+		int bestIndex;
+		Rect newNode;
+		switch (method)
+		{
+		default:
+		case LevelBottomLeft: newNode = FindPositionForNewNodeBottomLeft(width, height, bestHeight, bestScore2, bestIndex); break;
+		case LevelMinWasteFit: newNode = FindPositionForNewNodeMinWaste(width, height, bestHeight, bestScore2, bestIndex); break;
+		}
+
+		if (bestIndex == -1)
+		{
+			FMemory::Memset(&newNode, 0, sizeof(Rect));
+			return newNode;
+		}
+
+		AddSkylineLevel(bestIndex, newNode);
+		usedSurfaceArea += width * height;
+
+		newNode.x += binX;
+		newNode.y += binY;
+		return newNode;
+	}
+
+	bool SkylineBinPack::RectangleFits(int skylineNodeIndex, int width, int height, int &y) const
+	{
+		int x = skyLine[skylineNodeIndex].x;
+		if (x + width > binWidth)
+			return false;
+		int widthLeft = width;
+		int i = skylineNodeIndex;
+		y = skyLine[skylineNodeIndex].y;
+		while (widthLeft > 0)
+		{
+			y = FMath::Max(y, skyLine[i].y);
+			if (y + height > binHeight)
+				return false;
+			widthLeft -= skyLine[i].width;
+			++i;
+			check(i < skyLine.Num() || widthLeft <= 0);
+		}
+		return true;
+	}
+
+	int SkylineBinPack::ComputeWastedArea(int skylineNodeIndex, int width, int height, int y) const
+	{
+		int wastedArea = 0;
+		const int rectLeft = skyLine[skylineNodeIndex].x;
+		const int rectRight = rectLeft + width;
+		for (; skylineNodeIndex < skyLine.Num() && skyLine[skylineNodeIndex].x < rectRight; ++skylineNodeIndex)
+		{
+			if (skyLine[skylineNodeIndex].x >= rectRight || skyLine[skylineNodeIndex].x + skyLine[skylineNodeIndex].width <= rectLeft)
+				break;
+
+			int leftSide = skyLine[skylineNodeIndex].x;
+			int rightSide = FMath::Min(rectRight, leftSide + skyLine[skylineNodeIndex].width);
+			wastedArea += (rightSide - leftSide) * (y - skyLine[skylineNodeIndex].y);
+		}
+		return wastedArea;
+	}
+
+	void SkylineBinPack::AddSkylineLevel(int skylineNodeIndex, const Rect &rect)
+	{
+		SkylineNode newNode;
+		newNode.x = rect.x;
+		newNode.y = rect.y + rect.height;
+		newNode.width = rect.width;
+		skyLine.Insert(newNode, skylineNodeIndex);
+
+		for (int i = skylineNodeIndex + 1; i < skyLine.Num(); ++i)
+		{
+			if (skyLine[i].x < skyLine[i - 1].x + skyLine[i - 1].width)
+			{
+				int shrink = skyLine[i - 1].x + skyLine[i - 1].width - skyLine[i].x;
+
+				skyLine[i].x += shrink;
+				skyLine[i].width -= shrink;
+
+				if (skyLine[i].width <= 0)
+				{
+					skyLine.RemoveAt(i);
+					--i;
+				}
+				else
+					break;
+			}
+			else
+				break;
+		}
+		MergeSkylines();
+	}
+
+	void SkylineBinPack::MergeSkylines()
+	{
+		for (int i = 0; i < skyLine.Num() - 1; ++i)
+		{
+			if (skyLine[i].y == skyLine[i + 1].y)
+			{
+				skyLine[i].width += skyLine[i + 1].width;
+				skyLine.RemoveAt(i + 1);
+				--i;
+			}
+		}
+	}
+
+	Rect SkylineBinPack::FindPositionForNewNodeBottomLeft(int width, int height, int &bestHeight, int &bestWidth, int &bestIndex) const
+	{
+		bestHeight = MAX_int32;
+		bestIndex = -1;
+		// Used to break ties if there are nodes at the same level. Then pick the narrowest one.
+		bestWidth = MAX_int32;
+		Rect newNode;
+		FMemory::Memset(&newNode, 0, sizeof(Rect));
+		for (int i = 0; i < skyLine.Num(); ++i)
+		{
+			int y;
+			if (RectangleFits(i, width, height, y))
+			{
+				if (y + height < bestHeight || (y + height == bestHeight && skyLine[i].width < bestWidth))
+				{
+					bestHeight = y + height;
+					bestIndex = i;
+					bestWidth = skyLine[i].width;
+					newNode.x = skyLine[i].x;
+					newNode.y = y;
+					newNode.width = width;
+					newNode.height = height;
+				}
+			}
+		}
+		return newNode;
+	}
+
+	Rect SkylineBinPack::FindPositionForNewNodeMinWaste(int width, int height, int &bestHeight, int &bestWastedArea, int &bestIndex) const
+	{
+		bestHeight = MAX_int32;
+		bestWastedArea = MAX_int32;
+		bestIndex = -1;
+		Rect newNode;
+		FMemory::Memset(&newNode, 0, sizeof(Rect));
+		for (int i = 0; i < skyLine.Num(); ++i)
+		{
+			int y;
+			if (RectangleFits(i, width, height, y))
+			{
+				int wastedArea = ComputeWastedArea(i, width, height, y);
+				if (wastedArea < bestWastedArea || (wastedArea == bestWastedArea && y + height < bestHeight))
+				{
+					bestHeight = y + height;
+					bestWastedArea = wastedArea;
+					bestIndex = i;
+					newNode.x = skyLine[i].x;
+					newNode.y = y;
+					newNode.width = width;
+					newNode.height = height;
+				}
+			}
+		}
+		return newNode;
+	}
+
+	/// Computes the ratio of used surface area.
+	float SkylineBinPack::Occupancy() const
+	{
+		return (float)usedSurfaceArea / ((int64)binWidth * binHeight);
+	}
+
+}
@@ -0,0 +1,94 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+/** @file SkylineBinPack.h
+	@author Jukka Jylänki
+
+	@brief Implements different bin packer algorithms that use the SKYLINE data structure.
+
+	This work is released to Public Domain, do whatever you want with it.
+*/
+
+/*
+Modified by lexliu:
+	Support ue4's native classes, remove std stuff
+	Remove waste map and rotation, add bin offset so it can pack inside a cell of larger texture
+
+	This version is also public domain - do whatever you want with it.
+*/
+
+#include "CoreMinimal.h"
+#include "MaxRectsBinPack.h"
+#pragma once
+
+
+namespace rbp {
+
+	/** Represents a single level (a horizontal line) of the skyline/horizon/envelope. */
+	struct SkylineNode
+	{
+		/// The starting x-coordinate (leftmost).
+		int x;
+
+		/// The y-coordinate of the skyline level line.
+		int y;
+
+		/// The line width. The ending coordinate (inclusive) will be x+width-1.
+		int width;
+	};
+
+	/** Implements bin packing algorithms that use the SKYLINE data structure to store the bin contents.
+		Much faster than MaxRectsBinPack and good enough when rect sizes are similar, eg. glyphs of same font size. */
+	class LGUI_API SkylineBinPack
+	{
+	public:
+		/// Instantiates a bin of size (0,0). Call Init to create a new bin.
+		SkylineBinPack();
+
+		/// Instantiates a bin of the given size.
+		SkylineBinPack(int width, int height);
+
+		/// (Re)initializes the packer to an empty bin of width x height units. Call whenever
+		/// you need to restart with a new bin.
+		void Init(int width, int height);
+
+		/// (Re)initializes the packer to an empty bin of width x height units, and the result rect will offset by x and y.
+		void Init(int x, int y, int width, int height);
+
+		/// Defines the different heuristic rules that can be used to decide how to make the rectangle placements.
+		enum LevelChoiceHeuristic
+		{
+			LevelBottomLeft,
+			LevelMinWasteFit
+		};
+
+		/// Inserts a single rectangle into the bin.
+		Rect Insert(int width, int height, LevelChoiceHeuristic method);
+
+		/// Computes the ratio of used surface area to the total bin area.
+		float Occupancy() const;
+
+		int GetBinWidth()const { return binWidth; }
+		int GetBinHeight()const { return binHeight; }
+	private:
+		int binX = 0;
+		int binY = 0;
+		int binWidth = 0;
+		int binHeight = 0;
+
+		TArray<SkylineNode> skyLine;
+
+		int64 usedSurfaceArea = 0;
+
+		Rect FindPositionForNewNodeBottomLeft(int width, int height, int &bestHeight, int &bestWidth, int &bestIndex) const;
+		Rect FindPositionForNewNodeMinWaste(int width, int height, int &bestHeight, int &bestWastedArea, int &bestIndex) const;
+
+		bool RectangleFits(int skylineNodeIndex, int width, int height, int &y) const;
+		int ComputeWastedArea(int skylineNodeIndex, int width, int height, int y) const;
+
+		void AddSkylineLevel(int skylineNodeIndex, const Rect &rect);
+
+		/// Merges all skyline nodes that are at the same level.
+		void MergeSkylines();
+	};
+
+}
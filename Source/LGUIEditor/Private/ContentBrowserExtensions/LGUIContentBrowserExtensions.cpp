@@ -11,6 +11,10 @@
 #include "DataFactory/LGUISpriteDataFactory.h"
 #include "DataFactory/LGUIPrefabFactory.h"
 #include "PrefabSystem/LGUIPrefab.h"
+#include "Core/LGUIStaticSpriteAtlasData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Utils/LGUIUtils.h"
+#include "LGUIEditorModule.h"
 
 #define LOCTEXT_NAMESPACE "LGUI"
 
@@ -53,6 +57,17 @@ public:
 		);
 	}
 
+	static void CreateStaticSpriteAtlasActionsSubMenu(FMenuBuilder& MenuBuilder, TArray<ULGUIStaticSpriteAtlasData*> SelectedAssets)
+	{
+		MenuBuilder.AddSubMenu(
+			LOCTEXT("StaticSpriteAtlasActionsSubMenuLabel", "LGUIStaticSpriteAtlas"),
+			LOCTEXT("StaticSpriteAtlasActionsSubMenuToolTip", "Atlas-related actions for this static sprite atlas."),
+			FNewMenuDelegate::CreateStatic(&FLGUIContentBrowserExtensions_Impl::PopulateStaticSpriteAtlasActionsMenu, SelectedAssets),
+			false,
+			FSlateIcon(FLGUIEditorStyle::GetStyleSetName(), "LGUIEditor.SpriteDataAction")
+		);
+	}
+
 	static void PopulateSpriteActionsMenu(FMenuBuilder& MenuBuilder, TArray<UTexture2D*> SelectedAssets)
 	{
 		// Create sprites
@@ -168,6 +183,127 @@ public:
 			EUserInterfaceActionType::Button);
 	}
 
+	static void PopulateStaticSpriteAtlasActionsMenu(FMenuBuilder& MenuBuilder, TArray<ULGUIStaticSpriteAtlasData*> SelectedAssets)
+	{
+		struct LOCAL
+		{
+			/** Collect sprites referenced by each prefab, include sprites of sub prefabs because they are renderred together. */
+			static void CollectPrefabSpriteUsage(TArray<FName>& OutPrefabNameArray, TArray<TArray<ULGUISpriteData*>>& OutUsageArray)
+			{
+				FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry"));
+				IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+				auto PrefabClassName = ULGUIPrefab::StaticClass()->GetClassPathName();
+				auto SpriteClassName = ULGUISpriteData::StaticClass()->GetClassPathName();
+				TArray<FAssetData> PrefabAssetArray;
+				AssetRegistry.GetAssetsByClass(PrefabClassName, PrefabAssetArray);
+				for (auto& PrefabAsset : PrefabAssetArray)
+				{
+					TArray<ULGUISpriteData*> SpriteArray;
+					TSet<FName> VisitedPackages;
+					TArray<FName> PackagesToVisit = { PrefabAsset.PackageName };
+					while (PackagesToVisit.Num() > 0)
+					{
+						auto PackageName = PackagesToVisit.Pop(false);
+						if (VisitedPackages.Contains(PackageName))continue;
+						VisitedPackages.Add(PackageName);
+
+						TArray<FName> Dependencies;
+						AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+						for (auto& Dependency : Dependencies)
+						{
+							TArray<FAssetData> DependencyAssetArray;
+							AssetRegistry.GetAssetsByPackageName(Dependency, DependencyAssetArray);
+							for (auto& DependencyAsset : DependencyAssetArray)
+							{
+								if (DependencyAsset.AssetClassPath == SpriteClassName)
+								{
+									if (auto Sprite = Cast<ULGUISpriteData>(DependencyAsset.GetAsset()))
+									{
+										SpriteArray.AddUnique(Sprite);
+									}
+								}
+								else if (DependencyAsset.AssetClassPath == PrefabClassName)
+								{
+									PackagesToVisit.Add(Dependency);
+								}
+							}
+						}
+					}
+					if (SpriteArray.Num() > 0)
+					{
+						OutPrefabNameArray.Add(PrefabAsset.PackageName);
+						OutUsageArray.Add(MoveTemp(SpriteArray));
+					}
+				}
+			}
+			static bool IsUsingAtlas(const TArray<ULGUISpriteData*>& InSpriteArray, const TArray<ULGUIStaticSpriteAtlasData*>& InAtlasArray)
+			{
+				for (auto Sprite : InSpriteArray)
+				{
+					if (InAtlasArray.Contains(Sprite->GetPackingAtlas()))
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+			/** Log expected drawcall count of prefabs that use these atlases, return the total count */
+			static int32 LogPrefabDrawcall(const TArray<ULGUIStaticSpriteAtlasData*>& InAtlasArray, const TArray<FName>& InPrefabNameArray, const TArray<TArray<ULGUISpriteData*>>& InUsageArray)
+			{
+				int32 TotalCount = 0;
+				for (int i = 0; i < InUsageArray.Num(); i++)
+				{
+					auto& SpriteArray = InUsageArray[i];
+					if (!IsUsingAtlas(SpriteArray, InAtlasArray))continue;
+					auto Count = ULGUIStaticSpriteAtlasData::GetExpectedTextureCount(SpriteArray);
+					TotalCount += Count;
+					UE_LOG(LGUIEditor, Log, TEXT("Prefab: %s, sprite count: %d, expected sprite drawcall: %d"), *InPrefabNameArray[i].ToString(), SpriteArray.Num(), Count);
+				}
+				return TotalCount;
+			}
+			static void ReportPrefabDrawcall(TArray<ULGUIStaticSpriteAtlasData*> InAtlasArray)
+			{
+				TArray<FName> PrefabNameArray;
+				TArray<TArray<ULGUISpriteData*>> UsageArray;
+				CollectPrefabSpriteUsage(PrefabNameArray, UsageArray);
+				auto TotalCount = LogPrefabDrawcall(InAtlasArray, PrefabNameArray, UsageArray);
+				LGUIUtils::EditorNotification(FText::Format(LOCTEXT("ReportPrefabDrawcall_Notify", "Total expected sprite drawcall of prefabs that use selected atlases: {0}, check output log for detail."), TotalCount));
+			}
+			static void RegroupSpritesByPrefabUsage(TArray<ULGUIStaticSpriteAtlasData*> InAtlasArray)
+			{
+				TArray<FName> PrefabNameArray;
+				TArray<TArray<ULGUISpriteData*>> UsageArray;
+				CollectPrefabSpriteUsage(PrefabNameArray, UsageArray);
+				UE_LOG(LGUIEditor, Log, TEXT("Before regroup sprites:"));
+				auto PrevTotalCount = LogPrefabDrawcall(InAtlasArray, PrefabNameArray, UsageArray);
+				if (ULGUIStaticSpriteAtlasData::RegroupSpritesByUsage(InAtlasArray, UsageArray))
+				{
+					UE_LOG(LGUIEditor, Log, TEXT("After regroup sprites:"));
+					auto TotalCount = LogPrefabDrawcall(InAtlasArray, PrefabNameArray, UsageArray);
+					LGUIUtils::EditorNotification(FText::Format(LOCTEXT("RegroupSpritesByPrefabUsage_Notify", "Regroup sprites done, total expected sprite drawcall of prefabs: {0} -> {1}, check output log for detail."), PrevTotalCount, TotalCount));
+				}
+			}
+		};
+
+		const FName LGUIStyleSetName = FLGUIEditorStyle::GetStyleSetName();
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("ReportPrefabDrawcall", "Report Prefab Drawcall"),
+			LOCTEXT("ReportPrefabDrawcall_Tooltip", "Log expected sprite drawcall count of each prefab that use sprites of selected atlases."),
+			FSlateIcon(LGUIStyleSetName, "LGUIEditor.SpriteDataAction"),
+			FUIAction(FExecuteAction::CreateStatic(&LOCAL::ReportPrefabDrawcall, SelectedAssets)),
+			NAME_None,
+			EUserInterfaceActionType::Button);
+
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("RegroupSpritesByPrefabUsage", "Regroup Sprites By Prefab Usage"),
+			LOCTEXT("RegroupSpritesByPrefabUsage_Tooltip", "Reassign sprites of selected atlases, so sprites that used by same prefab are packed into same atlas as much as possible, which reduce drawcall."),
+			FSlateIcon(LGUIStyleSetName, "LGUIEditor.SpriteDataAction"),
+			FUIAction(FExecuteAction::CreateStatic(&LOCAL::RegroupSpritesByPrefabUsage, SelectedAssets)),
+			NAME_None,
+			EUserInterfaceActionType::Button);
+	}
+
 	static TSharedRef<FExtender> OnExtendContentBrowserAssetSelectionMenu(const TArray<FAssetData>& SelectedAssets)
 	{
 		TSharedRef<FExtender> Extender(new FExtender());
@@ -175,6 +311,7 @@ public:
 		// Run thru the assets to determine if any meet our criteria
 		TArray<UTexture2D*> Textures;
 		TArray<ULGUIPrefab*> Prefabs;
+		TArray<ULGUIStaticSpriteAtlasData*> StaticSpriteAtlases;
 		for (auto AssetIt = SelectedAssets.CreateConstIterator(); AssetIt; ++AssetIt)
 		{
 			const FAssetData& Asset = *AssetIt;
@@ -187,6 +324,10 @@ public:
 			{
 				Prefabs.Add(Prefab);
 			}
+			else if (auto StaticSpriteAtlas = Cast<ULGUIStaticSpriteAtlasData>(AssetObject))
+			{
+				StaticSpriteAtlases.Add(StaticSpriteAtlas);
+			}
 		}
 
 		if (Textures.Num() > 0)
@@ -206,6 +347,14 @@ public:
 				nullptr,
 				FMenuExtensionDelegate::CreateStatic(&FLGUIContentBrowserExtensions_Impl::CreatePrefabActionsSubMenu, Prefabs));
 		}
+		if (StaticSpriteAtlases.Num() > 0)
+		{
+			Extender->AddMenuExtension(
+				"GetAssetActions",
+				EExtensionHook::After,
+				nullptr,
+				FMenuExtensionDelegate::CreateStatic(&FLGUIContentBrowserExtensions_Impl::CreateStaticSpriteAtlasActionsSubMenu, StaticSpriteAtlases));
+		}
 
 		return Extender;
 	}
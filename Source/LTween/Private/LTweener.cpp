@@ -11,97 +11,79 @@ ULTweener::ULTweener()
 ULTweener* ULTweener::SetEase(ELTweenEase easetype)
 {
 	if (elapseTime > 0 || startToTween)return this;
+	if (easetype == ELTweenEase::CurveFloat)
+	{
+		tweenFunc.BindUObject(this, &ULTweener::CurveFloat);
+	}
+	else
+	{
+		tweenFunc.BindStatic(GetEaseFunction(easetype));
+	}
+	return this;
+}
+ULTweener::FEaseFunction ULTweener::GetEaseFunction(ELTweenEase easetype)
+{
 	switch (easetype)
 	{
 	case ELTweenEase::Linear:
-		tweenFunc.BindStatic(&ULTweener::Linear);
-		break;
+		return &ULTweener::Linear;
 	case ELTweenEase::InQuad:
-		tweenFunc.BindStatic(&ULTweener::InQuad);
-		break;
+		return &ULTweener::InQuad;
 	case ELTweenEase::OutQuad:
-		tweenFunc.BindStatic(&ULTweener::OutQuad);
-		break;
+		return &ULTweener::OutQuad;
 	case ELTweenEase::InOutQuad:
-		tweenFunc.BindStatic(&ULTweener::InOutQuad);
-		break;
+		return &ULTweener::InOutQuad;
 	case ELTweenEase::InCubic:
-		tweenFunc.BindStatic(&ULTweener::InCubic);
-		break;
+		return &ULTweener::InCubic;
 	case ELTweenEase::OutCubic:
-		tweenFunc.BindStatic(&ULTweener::OutCubic);
-		break;
+		return &ULTweener::OutCubic;
 	case ELTweenEase::InOutCubic:
-		tweenFunc.BindStatic(&ULTweener::InOutCubic);
-		break;
+		return &ULTweener::InOutCubic;
 	case ELTweenEase::InQuart:
-		tweenFunc.BindStatic(&ULTweener::InQuart);
-		break;
+		return &ULTweener::InQuart;
 	case ELTweenEase::OutQuart:
-		tweenFunc.BindStatic(&ULTweener::OutQuart);
-		break;
+		return &ULTweener::OutQuart;
 	case ELTweenEase::InOutQuart:
-		tweenFunc.BindStatic(&ULTweener::InOutQuart);
-		break;
+		return &ULTweener::InOutQuart;
 	case ELTweenEase::InSine:
-		tweenFunc.BindStatic(&ULTweener::InSine);
-		break;
+		return &ULTweener::InSine;
 	case ELTweenEase::OutSine:
-		tweenFunc.BindStatic(&ULTweener::OutSine);
-		break;
+		return &ULTweener::OutSine;
 	case ELTweenEase::InOutSine:
-		tweenFunc.BindStatic(&ULTweener::InOutSine);
-		break;
+		return &ULTweener::InOutSine;
 	case ELTweenEase::InExpo:
-		tweenFunc.BindStatic(&ULTweener::InExpo);
-		break;
+		return &ULTweener::InExpo;
 	case ELTweenEase::OutExpo:
-		tweenFunc.BindStatic(&ULTweener::OutExpo);
-		break;
+		return &ULTweener::OutExpo;
 	case ELTweenEase::InOutExpo:
-		tweenFunc.BindStatic(&ULTweener::InOutExpo);
-		break;
+		return &ULTweener::InOutExpo;
 	case ELTweenEase::InCirc:
-		tweenFunc.BindStatic(&ULTweener::InCirc);
-		break;
+		return &ULTweener::InCirc;
 	case ELTweenEase::OutCirc:
-		tweenFunc.BindStatic(&ULTweener::OutCirc);
-		break;
+		return &ULTweener::OutCirc;
 	case ELTweenEase::InOutCirc:
-		tweenFunc.BindStatic(&ULTweener::InOutCirc);
-		break;
+		return &ULTweener::InOutCirc;
 	case ELTweenEase::InElastic:
-		tweenFunc.BindStatic(&ULTweener::InElastic);
-		break;
+		return &ULTweener::InElastic;
 	case ELTweenEase::OutElastic:
-		tweenFunc.BindStatic(&ULTweener::OutElastic);
-		break;
+		return &ULTweener::OutElastic;
 	case ELTweenEase::InOutElastic:
-		tweenFunc.BindStatic(&ULTweener::InOutElastic);
-		break;
+		return &ULTweener::InOutElastic;
 	case ELTweenEase::InBack:
-		tweenFunc.BindStatic(&ULTweener::InBack);
-		break;
+		return &ULTweener::InBack;
 	case ELTweenEase::OutBack:
-		tweenFunc.BindStatic(&ULTweener::OutBack);
-		break;
+		return &ULTweener::OutBack;
 	case ELTweenEase::InOutBack:
-		tweenFunc.BindStatic(&ULTweener::InOutBack);
-		break;
+		return &ULTweener::InOutBack;
 	case ELTweenEase::InBounce:
-		tweenFunc.BindStatic(&ULTweener::InBounce);
-		break;
+		return &ULTweener::InBounce;
 	case ELTweenEase::OutBounce:
-		tweenFunc.BindStatic(&ULTweener::OutBounce);
-		break;
+		return &ULTweener::OutBounce;
 	case ELTweenEase::InOutBounce:
-		tweenFunc.BindStatic(&ULTweener::InOutBounce);
-		break;
-	case ELTweenEase::CurveFloat:
-		tweenFunc.BindUObject(this, &ULTweener::CurveFloat);
-		break;
+		return &ULTweener::InOutBounce;
+	default:
+		return &ULTweener::Linear;
 	}
-	return this;
 }
 ULTweener* ULTweener::SetDelay(float newDelay)
 {
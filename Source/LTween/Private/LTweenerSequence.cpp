@@ -18,6 +18,7 @@ ULTweenerSequence* ULTweenerSequence::AppendInterval(UObject* WorldContextObject
 		return this;
 	}
 	duration += interval;
+	bTimelineDirty = true;
 	return this;
 }
 ULTweenerSequence* ULTweenerSequence::Insert(UObject* WorldContextObject, float timePosition, ULTweener* tweener)
@@ -52,6 +53,7 @@ ULTweenerSequence* ULTweenerSequence::Insert(UObject* WorldContextObject, float
 	float tweenerTime = tweener->delay + tweener->duration * loopCount;
 	tweener->SetDelay(tweener->delay + timePosition);
 	tweenerList.Add(tweener);
+	bTimelineDirty = true;
 	lastTweenStartTime = timePosition;
 	float inputDuration = tweenerTime + timePosition;
 	if (duration < inputDuration)
@@ -96,6 +98,7 @@ ULTweenerSequence* ULTweenerSequence::Prepend(UObject* WorldContextObject, ULTwe
 		item->SetDelay(item->delay + inputDuration);
 	}
 	tweenerList.Insert(tweener, 0);
+	bTimelineDirty = true;
 	duration += inputDuration;
 	lastTweenStartTime = 0;
 	return this;
@@ -112,6 +115,7 @@ ULTweenerSequence* ULTweenerSequence::PrependInterval(UObject* WorldContextObjec
 	{
 		item->SetDelay(item->delay + interval);
 	}
+	bTimelineDirty = true;
 	duration += interval;
 	lastTweenStartTime += interval;
 	return this;
@@ -132,31 +136,75 @@ ULTweenerSequence* ULTweenerSequence::Join(UObject* WorldContextObject, ULTweene
 	return this->Insert(WorldContextObject, lastTweenStartTime, tweener);
 }
 
-void ULTweenerSequence::TweenAndApplyValue(float currentTime)
+void ULTweenerSequence::CompileTimeline()
 {
-	for(int i = 0; i < tweenerList.Num(); i++)
+	if (!bTimelineDirty)return;
+	bTimelineDirty = false;
+	bTimelineReversed = false;
+
+	timeline.Reset(tweenerList.Num());
+	for (int i = 0; i < tweenerList.Num(); i++)
 	{
 		auto& item = tweenerList[i];
-		if (!item->ToNextWithElapsedTime(currentTime))
-		{
-			finishedTweenerList.Add(item);
-			tweenerList.RemoveAt(i);
-			i--;
-		}
+		int loopCount = item->loopType == ELTweenLoop::Once ? 1 : item->maxLoopCount;
+		FLTweenerSequenceTimelineItem timelineItem;
+		timelineItem.TweenerIndex = i;
+		timelineItem.ForwardStartTime = item->delay;
+		timelineItem.ReverseStartTime = duration - (item->delay + item->duration * loopCount);
+		timeline.Add(timelineItem);
+	}
+	//stable sort, so tweeners with same start time keep the order they are added
+	timeline.StableSort([](const FLTweenerSequenceTimelineItem& A, const FLTweenerSequenceTimelineItem& B) {
+		return A.ForwardStartTime < B.ForwardStartTime;
+		});
+	reverseTimeline.Reset(timeline.Num());
+	for (int i = 0; i < timeline.Num(); i++)
+	{
+		reverseTimeline.Add(i);
 	}
+	reverseTimeline.StableSort([this](const int32& A, const int32& B) {
+		return timeline[A].ReverseStartTime < timeline[B].ReverseStartTime;
+		});
+	activeTimelineItems.Reset(timeline.Num());
+	nextTimelineItem = 0;
+}
+void ULTweenerSequence::ResetTimelineProgress()
+{
+	activeTimelineItems.Reset();
+	nextTimelineItem = 0;
 }
 
-void ULTweenerSequence::SetOriginValueForRestart()
+void ULTweenerSequence::TweenAndApplyValue(float currentTime)
 {
-	for (auto& item : finishedTweenerList)
+	CompileTimeline();
+	//start tweeners that reach start time. tweener start when elapseTime > delay
+	while (nextTimelineItem < timeline.Num())
 	{
-		//add tweener to tweenerList
-		tweenerList.Add(item);
+		auto timelineItemIndex = GetTimelineItemIndex(nextTimelineItem);
+		if (GetTimelineItemStartTime(timeline[timelineItemIndex]) >= currentTime)break;
+		activeTimelineItems.Add(timelineItemIndex);//no allocation, space is reserved when compile
+		nextTimelineItem++;
+	}
+	//update started tweeners, and remove finished ones in place
+	int32 activeCount = 0;
+	for (int i = 0; i < activeTimelineItems.Num(); i++)
+	{
+		auto timelineItemIndex = activeTimelineItems[i];
+		if (tweenerList[timeline[timelineItemIndex].TweenerIndex]->ToNextWithElapsedTime(currentTime))
+		{
+			activeTimelineItems[activeCount++] = timelineItemIndex;
+		}
 	}
-	finishedTweenerList.Reset();
+	activeTimelineItems.SetNum(activeCount, false);
+}
 
-	for (auto& item : tweenerList)
+void ULTweenerSequence::SetOriginValueForRestart()
+{
+	CompileTimeline();
+	//reverse order of start time, so later tweener can do "SetOriginValueForRestart" ealier, so ealier tweener will get correct start state
+	for (int i = timeline.Num() - 1; i >= 0; i--)
 	{
+		auto& item = tweenerList[timeline[GetTimelineItemIndex(i)].TweenerIndex];
 		if (item->elapseTime > 0 || item->startToTween)
 		{
 			item->SetOriginValueForRestart();//if tween already start, then we can call "SetOriginValueForRestart"
@@ -167,29 +215,32 @@ void ULTweenerSequence::SetOriginValueForRestart()
 		item->loopCycleCount = 0;
 		item->reverseTween = false;
 	}
+	ResetTimelineProgress();
 }
 
 void ULTweenerSequence::SetValueForIncremental()
 {
-	for (auto& item : finishedTweenerList)
+	CompileTimeline();
+	for (int i = timeline.Num() - 1; i >= 0; i--)
 	{
+		auto& item = tweenerList[timeline[GetTimelineItemIndex(i)].TweenerIndex];
 		item->SetValueForIncremental();
 		//set parameter to initial
 		item->elapseTime = 0;
 		item->loopCycleCount = 0;
 		item->reverseTween = false;
 		item->TweenAndApplyValue(0);
-
-		//add tweener to tweenerList
-		tweenerList.Add(item);
 	}
-	finishedTweenerList.Reset();
+	ResetTimelineProgress();
 }
 void ULTweenerSequence::SetValueForYoyo()
 {
-	this->reverseTween = !this->reverseTween;//reverse it again, so it will keep value false, because we only need to reverse tweenerList
-	for (auto& item : finishedTweenerList)
+	CompileTimeline();
+	this->reverseTween = !this->reverseTween;//reverse it again, so it will keep value false, because we only need to reverse tweeners
+	bTimelineReversed = !bTimelineReversed;
+	for (auto& timelineItem : timeline)
 	{
+		auto& item = tweenerList[timelineItem.TweenerIndex];
 		if (item->loopType != ELTweenLoop::Yoyo)//if it is already yoyo, then we no need to change reverseTween for it
 		{
 			item->reverseTween = !item->reverseTween;
@@ -198,30 +249,54 @@ void ULTweenerSequence::SetValueForYoyo()
 		//set parameter to initial
 		item->elapseTime = 0;
 		item->loopCycleCount = 0;
-		//flip tweener
-		int loopCount = item->loopType == ELTweenLoop::Once ? 1 : item->maxLoopCount;
-		float tweenerDelay = duration - (item->delay + item->duration * loopCount);
-		item->delay = tweenerDelay;
-
-		//add tweener to tweenerList
-		tweenerList.Add(item);
+		//flip tweener, use precompiled time so the order is always same as timeline
+		item->delay = GetTimelineItemStartTime(timelineItem);
 	}
-	finishedTweenerList.Reset();
+	ResetTimelineProgress();
 }
 void ULTweenerSequence::SetValueForRestart()
 {
-	for (auto& item : finishedTweenerList)
+	CompileTimeline();
+	for (int i = timeline.Num() - 1; i >= 0; i--)
 	{
+		auto& item = tweenerList[timeline[GetTimelineItemIndex(i)].TweenerIndex];
 		//set parameter to initial
 		item->elapseTime = 0;
 		item->loopCycleCount = 0;
 		item->reverseTween = false;
 		item->TweenAndApplyValue(0);
+	}
+	ResetTimelineProgress();
+}
+void ULTweenerSequence::ResetForRestartOrGoto()
+{
+	CompileTimeline();
+	//reset parameter to initial
+	if (this->loopType == ELTweenLoop::Yoyo)
+	{
+		if (loopCycleCount % 2 != 0)//this means current is yoyo back, then we should reverse it
+		{
+			this->reverseTween = true;
+			this->SetValueForYoyo();
+		}
+	}
+	this->loopCycleCount = 0;
 
-		//add tweener to tweenerList
-		tweenerList.Add(item);
+	//reverse order of start time, so later tweener can do "SetOriginValueForRestart" ealier, so ealier tweener will get correct start state
+	for (int i = timeline.Num() - 1; i >= 0; i--)
+	{
+		auto& item = tweenerList[timeline[GetTimelineItemIndex(i)].TweenerIndex];
+		if (item->startToTween)
+		{
+			item->SetOriginValueForRestart();
+			item->TweenAndApplyValue(0);
+		}
+		//set parameter to initial
+		item->elapseTime = 0;
+		item->loopCycleCount = 0;
+		item->reverseTween = false;
 	}
-	finishedTweenerList.Reset();
+	ResetTimelineProgress();
 }
 void ULTweenerSequence::Restart()
 {
@@ -232,46 +307,7 @@ void ULTweenerSequence::Restart()
 	this->isMarkedPause = false;//incase it is paused.
 
 	//reset parameter and value to start
-	{
-		//reset parameter to initial
-		if (this->loopType == ELTweenLoop::Yoyo)
-		{
-			if (loopCycleCount % 2 != 0)//this means current is yoyo back, then we should reverse it
-			{
-				this->reverseTween = true;
-				for (auto& item : tweenerList)
-				{
-					finishedTweenerList.Add(item);
-				}
-				tweenerList.Reset();
-				this->SetValueForYoyo();
-			}
-		}
-		for (auto& item : finishedTweenerList)
-		{
-			tweenerList.Add(item);
-		}
-		finishedTweenerList.Reset();
-		this->loopCycleCount = 0;
-
-		//sort it, so later tweener can do "SetOriginValueForRestart" ealier, so ealier tweener will get correct start state
-		tweenerList.Sort([=](const ULTweener& A, const ULTweener& B) {
-			return A.delay > B.delay;
-			});
-		for (int i = 0; i < tweenerList.Num(); i++)
-		{
-			auto& item = tweenerList[i];
-			if (item->startToTween)
-			{
-				item->SetOriginValueForRestart();
-				item->TweenAndApplyValue(0);
-			}
-			//set parameter to initial
-			item->elapseTime = 0;
-			item->loopCycleCount = 0;
-			item->reverseTween = false;
-		}
-	}
+	ResetForRestartOrGoto();
 
 	this->ToNextWithElapsedTime(0);
 }
@@ -279,48 +315,8 @@ void ULTweenerSequence::Goto(float timePoint)
 {
 	timePoint = FMath::Clamp(timePoint, 0.0f, duration);
 
-	//reset parameter to start, then goto timepoint. these line should be same as lines in "Restart"
-	{
-		//reset parameter to initial
-		if (this->loopType == ELTweenLoop::Yoyo)
-		{
-			if (loopCycleCount % 2 != 0)//mean current is yoyo back, should reverse it
-			{
-				this->reverseTween = true;
-				for (auto& item : tweenerList)
-				{
-					finishedTweenerList.Add(item);
-				}
-				tweenerList.Reset();
-				this->SetValueForYoyo();
-			}
-		}
-		for (auto& item : finishedTweenerList)
-		{
-			tweenerList.Add(item);
-		}
-		finishedTweenerList.Reset();
-		this->loopCycleCount = 0;
-
-		//sort it, so later tweener can do "SetOriginValueForRestart" ealier, so ealier tweener will get correct start state
-		tweenerList.Sort([=](const ULTweener& A, const ULTweener& B) {
-			return A.delay > B.delay;
-			});
-		for (int i = 0; i < tweenerList.Num(); i++)
-		{
-			auto& item = tweenerList[i];
-			if (item->startToTween)
-			{
-				item->SetOriginValueForRestart();
-				item->TweenAndApplyValue(0);
-			}
-			//set parameter to initial
-			item->elapseTime = 0;
-			item->loopCycleCount = 0;
-			item->reverseTween = false;
-		}
-	}
+	//reset parameter to start, then goto timepoint
+	ResetForRestartOrGoto();
 
 	this->ToNextWithElapsedTime(timePoint);
 }
-
@@ -697,5 +697,9 @@ public:
 	}
 	/** Tween use CurveFloat, in range of 0-1. if curveFloat is null, fallback to Linear */
 	float CurveFloat(float c, float b, float t, float d);
+
+	typedef float(*FEaseFunction)(float c, float b, float t, float d);
+	/** Get static tween function for ease type. CurveFloat is not a static function, so will return Linear for it. */
+	static FEaseFunction GetEaseFunction(ELTweenEase easetype);
 #pragma endregion
 };
\ No newline at end of file
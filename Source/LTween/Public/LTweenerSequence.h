@@ -4,14 +4,44 @@
 #include "LTweener.h"
 #include "LTweenerSequence.generated.h"
 
+/** Compiled child tweener's time range in sequence */
+struct FLTweenerSequenceTimelineItem
+{
+	/** Index in tweenerList */
+	int32 TweenerIndex = 0;
+	/** Start time (child's delay) when play forward */
+	float ForwardStartTime = 0;
+	/** Start time (child's delay) when play backward for yoyo */
+	float ReverseStartTime = 0;
+};
+
 UCLASS(BlueprintType)
 class LTWEEN_API ULTweenerSequence:public ULTweener
 {
 	GENERATED_BODY()
 private:
 	UPROPERTY(VisibleAnywhere, Category = LTween)TArray<TObjectPtr<ULTweener>> tweenerList;
-	UPROPERTY(VisibleAnywhere, Category = LTween)TArray<TObjectPtr<ULTweener>> finishedTweenerList;
 	float lastTweenStartTime = 0;
+
+	/** Sorted by ForwardStartTime. Compiled from tweenerList when start, not change after that, so evaluate need no array mutation */
+	TArray<FLTweenerSequenceTimelineItem> timeline;
+	/** Index of timeline, sorted by ReverseStartTime */
+	TArray<int32> reverseTimeline;
+	/** Index of timeline, tweeners that started but not finished */
+	TArray<int32> activeTimelineItems;
+	/** Next timeline item to start, all items before it are started */
+	int32 nextTimelineItem = 0;
+	/** Currently play backward for yoyo */
+	bool bTimelineReversed = false;
+	bool bTimelineDirty = true;
+	void CompileTimeline();
+	/** Get index of timeline in current play direction, ordered by start time */
+	int32 GetTimelineItemIndex(int32 InOrder)const { return bTimelineReversed ? reverseTimeline[InOrder] : InOrder; }
+	float GetTimelineItemStartTime(const FLTweenerSequenceTimelineItem& InItem)const { return bTimelineReversed ? InItem.ReverseStartTime : InItem.ForwardStartTime; }
+	/** Set all tweener to not started */
+	void ResetTimelineProgress();
+	/** Reset parameter and value to start, for Restart and Goto */
+	void ResetForRestartOrGoto();
 public:
 	/**
 	 * Adds the given tween to the end of the Sequence.